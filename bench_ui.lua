@@ -0,0 +1,68 @@
+-- bench_ui.lua  –  immediate vs batched imgui bridge
+-- run: demo bench_ui.lua
+-- Draws WIDGETS text/button rows per frame, switching mode every
+-- FRAMES frames, and prints widgets/ms measured by imgui.bridge_time().
+
+local WIDGETS = 4000
+local FRAMES  = 240
+
+local labels = {}
+for i = 1, WIDGETS // 2 do
+    labels[i] = "Button " .. i
+end
+
+local modes = { "immediate", "batched" }
+local mode, frame, total_ms = 1, 0, 0
+
+local function render_immediate()
+    imgui.SetNextWindowPos({10, 10}, imgui.Cond_Once)
+    imgui.SetNextWindowSize({500, 400}, imgui.Cond_Once)
+    if imgui.BeginWindow("bench_ui") then
+        for i = 1, #labels do
+            imgui.Text("row")
+            if imgui.Button(labels[i]) then
+                print("clicked " .. labels[i])
+            end
+        end
+    end
+    imgui.EndWindow()
+end
+
+local c, r = imgui.cmd, imgui.results
+local OP_BEGIN, OP_END = imgui.OP_BEGIN, imgui.OP_END
+local OP_TEXT, OP_BUTTON = imgui.OP_TEXT, imgui.OP_BUTTON
+local OP_POS, OP_SIZE = imgui.OP_SET_NEXT_WINDOW_POS, imgui.OP_SET_NEXT_WINDOW_SIZE
+local ONCE = imgui.Cond_Once
+
+local function render_batched()
+    -- results of the previous frame
+    for i = 1, #labels do
+        if r[i + 1] then print("clicked " .. labels[i]) end
+    end
+
+    local n = 0
+    c[n+1]=OP_POS  c[n+2]=10  c[n+3]=10  c[n+4]=ONCE  n=n+4
+    c[n+1]=OP_SIZE c[n+2]=500 c[n+3]=400 c[n+4]=ONCE  n=n+4
+    c[n+1]=OP_BEGIN c[n+2]="bench_ui" c[n+3]=1        n=n+3
+    for i = 1, #labels do
+        c[n+1]=OP_TEXT   c[n+2]="row"                 n=n+2
+        c[n+1]=OP_BUTTON c[n+2]=labels[i] c[n+3]=i+1  n=n+3
+    end
+    c[n+1]=OP_END                                     n=n+1
+    c.n = n
+end
+
+function _render()
+    if frame > 0 then
+        total_ms = total_ms + imgui.bridge_time()   -- previous frame
+    end
+    if frame == FRAMES then
+        local ms = total_ms / FRAMES
+        print(string.format("%-9s  %8.3f ms/frame  %10.1f widgets/ms",
+                            modes[mode], ms, WIDGETS / ms))
+        mode, frame, total_ms = mode % 2 + 1, 0, 0
+    end
+    frame = frame + 1
+
+    if mode == 1 then render_immediate() else render_batched() end
+end
@@ -0,0 +1,4368 @@
+#pragma once
+/*
+    #version:1# (machine generated, don't edit!)
+
+    Generated by tools/gen_imgui_lua.py from libs/cimgui/cimgui.h
+
+    374 functions bound, 97 skipped (unsupported types), 661 enum values.
+    Include from module_cimgui.c only - expects check_imvec2(), check_imvec4(),
+    gen_read_floats()/ints(), gen_write_floats()/ints() and gen_text_buffer().
+*/
+
+static int cimgui_gen_ShowDemoWindow(lua_State *L)
+{
+    bool p_open_v = lua_toboolean(L, 1);
+    bool p_open_set = !lua_isnoneornil(L, 1);
+    igShowDemoWindow(p_open_set ? &p_open_v : NULL);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 1;
+}
+
+static int cimgui_gen_ShowMetricsWindow(lua_State *L)
+{
+    bool p_open_v = lua_toboolean(L, 1);
+    bool p_open_set = !lua_isnoneornil(L, 1);
+    igShowMetricsWindow(p_open_set ? &p_open_v : NULL);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 1;
+}
+
+static int cimgui_gen_ShowDebugLogWindow(lua_State *L)
+{
+    bool p_open_v = lua_toboolean(L, 1);
+    bool p_open_set = !lua_isnoneornil(L, 1);
+    igShowDebugLogWindow(p_open_set ? &p_open_v : NULL);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 1;
+}
+
+static int cimgui_gen_ShowIDStackToolWindow(lua_State *L)
+{
+    (void)L;
+    igShowIDStackToolWindow();
+    return 0;
+}
+
+static int cimgui_gen_ShowIDStackToolWindowEx(lua_State *L)
+{
+    bool p_open_v = lua_toboolean(L, 1);
+    bool p_open_set = !lua_isnoneornil(L, 1);
+    igShowIDStackToolWindowEx(p_open_set ? &p_open_v : NULL);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 1;
+}
+
+static int cimgui_gen_ShowAboutWindow(lua_State *L)
+{
+    bool p_open_v = lua_toboolean(L, 1);
+    bool p_open_set = !lua_isnoneornil(L, 1);
+    igShowAboutWindow(p_open_set ? &p_open_v : NULL);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 1;
+}
+
+static int cimgui_gen_ShowStyleSelector(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igShowStyleSelector(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_ShowFontSelector(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    igShowFontSelector(label);
+    return 0;
+}
+
+static int cimgui_gen_ShowUserGuide(lua_State *L)
+{
+    (void)L;
+    igShowUserGuide();
+    return 0;
+}
+
+static int cimgui_gen_GetVersion(lua_State *L)
+{
+    const char* ret = igGetVersion();
+    lua_pushstring(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_Begin(lua_State *L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    bool p_open_v = lua_toboolean(L, 2);
+    bool p_open_set = !lua_isnoneornil(L, 2);
+    ImGuiWindowFlags flags = (ImGuiWindowFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igBegin(name, p_open_set ? &p_open_v : NULL, flags);
+    lua_pushboolean(L, ret);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 2;
+}
+
+static int cimgui_gen_End(lua_State *L)
+{
+    (void)L;
+    igEnd();
+    return 0;
+}
+
+static int cimgui_gen_BeginChild(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImVec2 size = lua_isnoneornil(L, 2) ? (ImVec2){ 0, 0 } : check_imvec2(L, 2);
+    ImGuiChildFlags child_flags = (ImGuiChildFlags)luaL_optinteger(L, 3, 0);
+    ImGuiWindowFlags window_flags = (ImGuiWindowFlags)luaL_optinteger(L, 4, 0);
+    bool ret = igBeginChild(str_id, size, child_flags, window_flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginChildID(lua_State *L)
+{
+    ImGuiID id = (ImGuiID)luaL_checkinteger(L, 1);
+    ImVec2 size = lua_isnoneornil(L, 2) ? (ImVec2){ 0, 0 } : check_imvec2(L, 2);
+    ImGuiChildFlags child_flags = (ImGuiChildFlags)luaL_optinteger(L, 3, 0);
+    ImGuiWindowFlags window_flags = (ImGuiWindowFlags)luaL_optinteger(L, 4, 0);
+    bool ret = igBeginChildID(id, size, child_flags, window_flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndChild(lua_State *L)
+{
+    (void)L;
+    igEndChild();
+    return 0;
+}
+
+static int cimgui_gen_IsWindowAppearing(lua_State *L)
+{
+    bool ret = igIsWindowAppearing();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsWindowCollapsed(lua_State *L)
+{
+    bool ret = igIsWindowCollapsed();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsWindowFocused(lua_State *L)
+{
+    ImGuiFocusedFlags flags = (ImGuiFocusedFlags)luaL_optinteger(L, 1, 0);
+    bool ret = igIsWindowFocused(flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsWindowHovered(lua_State *L)
+{
+    ImGuiHoveredFlags flags = (ImGuiHoveredFlags)luaL_optinteger(L, 1, 0);
+    bool ret = igIsWindowHovered(flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetWindowPos(lua_State *L)
+{
+    ImVec2 ret = igGetWindowPos();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetWindowSize(lua_State *L)
+{
+    ImVec2 ret = igGetWindowSize();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetWindowWidth(lua_State *L)
+{
+    float ret = igGetWindowWidth();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetWindowHeight(lua_State *L)
+{
+    float ret = igGetWindowHeight();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetNextWindowPos(lua_State *L)
+{
+    ImVec2 pos = check_imvec2(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    igSetNextWindowPos(pos, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetNextWindowPosEx(lua_State *L)
+{
+    ImVec2 pos = check_imvec2(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    ImVec2 pivot = lua_isnoneornil(L, 3) ? (ImVec2){ 0, 0 } : check_imvec2(L, 3);
+    igSetNextWindowPosEx(pos, cond, pivot);
+    return 0;
+}
+
+static int cimgui_gen_SetNextWindowSize(lua_State *L)
+{
+    ImVec2 size = check_imvec2(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    igSetNextWindowSize(size, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetNextWindowContentSize(lua_State *L)
+{
+    ImVec2 size = check_imvec2(L, 1);
+    igSetNextWindowContentSize(size);
+    return 0;
+}
+
+static int cimgui_gen_SetNextWindowCollapsed(lua_State *L)
+{
+    bool collapsed = lua_toboolean(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    igSetNextWindowCollapsed(collapsed, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetNextWindowFocus(lua_State *L)
+{
+    (void)L;
+    igSetNextWindowFocus();
+    return 0;
+}
+
+static int cimgui_gen_SetNextWindowScroll(lua_State *L)
+{
+    ImVec2 scroll = check_imvec2(L, 1);
+    igSetNextWindowScroll(scroll);
+    return 0;
+}
+
+static int cimgui_gen_SetNextWindowBgAlpha(lua_State *L)
+{
+    float alpha = (float)luaL_checknumber(L, 1);
+    igSetNextWindowBgAlpha(alpha);
+    return 0;
+}
+
+static int cimgui_gen_SetWindowPos(lua_State *L)
+{
+    ImVec2 pos = check_imvec2(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    igSetWindowPos(pos, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetWindowSize(lua_State *L)
+{
+    ImVec2 size = check_imvec2(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    igSetWindowSize(size, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetWindowCollapsed(lua_State *L)
+{
+    bool collapsed = lua_toboolean(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    igSetWindowCollapsed(collapsed, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetWindowFocus(lua_State *L)
+{
+    (void)L;
+    igSetWindowFocus();
+    return 0;
+}
+
+static int cimgui_gen_SetWindowPosStr(lua_State *L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    ImVec2 pos = check_imvec2(L, 2);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 3, 0);
+    igSetWindowPosStr(name, pos, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetWindowSizeStr(lua_State *L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    ImVec2 size = check_imvec2(L, 2);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 3, 0);
+    igSetWindowSizeStr(name, size, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetWindowCollapsedStr(lua_State *L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    bool collapsed = lua_toboolean(L, 2);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 3, 0);
+    igSetWindowCollapsedStr(name, collapsed, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetWindowFocusStr(lua_State *L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    igSetWindowFocusStr(name);
+    return 0;
+}
+
+static int cimgui_gen_GetScrollX(lua_State *L)
+{
+    float ret = igGetScrollX();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetScrollY(lua_State *L)
+{
+    float ret = igGetScrollY();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetScrollX(lua_State *L)
+{
+    float scroll_x = (float)luaL_checknumber(L, 1);
+    igSetScrollX(scroll_x);
+    return 0;
+}
+
+static int cimgui_gen_SetScrollY(lua_State *L)
+{
+    float scroll_y = (float)luaL_checknumber(L, 1);
+    igSetScrollY(scroll_y);
+    return 0;
+}
+
+static int cimgui_gen_GetScrollMaxX(lua_State *L)
+{
+    float ret = igGetScrollMaxX();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetScrollMaxY(lua_State *L)
+{
+    float ret = igGetScrollMaxY();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetScrollHereX(lua_State *L)
+{
+    float center_x_ratio = (float)luaL_optnumber(L, 1, 0.5f);
+    igSetScrollHereX(center_x_ratio);
+    return 0;
+}
+
+static int cimgui_gen_SetScrollHereY(lua_State *L)
+{
+    float center_y_ratio = (float)luaL_optnumber(L, 1, 0.5f);
+    igSetScrollHereY(center_y_ratio);
+    return 0;
+}
+
+static int cimgui_gen_SetScrollFromPosX(lua_State *L)
+{
+    float local_x = (float)luaL_checknumber(L, 1);
+    float center_x_ratio = (float)luaL_optnumber(L, 2, 0.5f);
+    igSetScrollFromPosX(local_x, center_x_ratio);
+    return 0;
+}
+
+static int cimgui_gen_SetScrollFromPosY(lua_State *L)
+{
+    float local_y = (float)luaL_checknumber(L, 1);
+    float center_y_ratio = (float)luaL_optnumber(L, 2, 0.5f);
+    igSetScrollFromPosY(local_y, center_y_ratio);
+    return 0;
+}
+
+static int cimgui_gen_PopFont(lua_State *L)
+{
+    (void)L;
+    igPopFont();
+    return 0;
+}
+
+static int cimgui_gen_GetFontSize(lua_State *L)
+{
+    float ret = igGetFontSize();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_PushStyleColor(lua_State *L)
+{
+    ImGuiCol idx = (ImGuiCol)luaL_checkinteger(L, 1);
+    ImU32 col = (ImU32)luaL_checkinteger(L, 2);
+    igPushStyleColor(idx, col);
+    return 0;
+}
+
+static int cimgui_gen_PushStyleColorImVec4(lua_State *L)
+{
+    ImGuiCol idx = (ImGuiCol)luaL_checkinteger(L, 1);
+    ImVec4 col = check_imvec4(L, 2);
+    igPushStyleColorImVec4(idx, col);
+    return 0;
+}
+
+static int cimgui_gen_PopStyleColor(lua_State *L)
+{
+    (void)L;
+    igPopStyleColor();
+    return 0;
+}
+
+static int cimgui_gen_PopStyleColorEx(lua_State *L)
+{
+    int count = (int)luaL_optinteger(L, 1, 1);
+    igPopStyleColorEx(count);
+    return 0;
+}
+
+static int cimgui_gen_PushStyleVar(lua_State *L)
+{
+    ImGuiStyleVar idx = (ImGuiStyleVar)luaL_checkinteger(L, 1);
+    float val = (float)luaL_checknumber(L, 2);
+    igPushStyleVar(idx, val);
+    return 0;
+}
+
+static int cimgui_gen_PushStyleVarImVec2(lua_State *L)
+{
+    ImGuiStyleVar idx = (ImGuiStyleVar)luaL_checkinteger(L, 1);
+    ImVec2 val = check_imvec2(L, 2);
+    igPushStyleVarImVec2(idx, val);
+    return 0;
+}
+
+static int cimgui_gen_PushStyleVarX(lua_State *L)
+{
+    ImGuiStyleVar idx = (ImGuiStyleVar)luaL_checkinteger(L, 1);
+    float val_x = (float)luaL_checknumber(L, 2);
+    igPushStyleVarX(idx, val_x);
+    return 0;
+}
+
+static int cimgui_gen_PushStyleVarY(lua_State *L)
+{
+    ImGuiStyleVar idx = (ImGuiStyleVar)luaL_checkinteger(L, 1);
+    float val_y = (float)luaL_checknumber(L, 2);
+    igPushStyleVarY(idx, val_y);
+    return 0;
+}
+
+static int cimgui_gen_PopStyleVar(lua_State *L)
+{
+    (void)L;
+    igPopStyleVar();
+    return 0;
+}
+
+static int cimgui_gen_PopStyleVarEx(lua_State *L)
+{
+    int count = (int)luaL_optinteger(L, 1, 1);
+    igPopStyleVarEx(count);
+    return 0;
+}
+
+static int cimgui_gen_PushItemFlag(lua_State *L)
+{
+    ImGuiItemFlags option = (ImGuiItemFlags)luaL_checkinteger(L, 1);
+    bool enabled = lua_toboolean(L, 2);
+    igPushItemFlag(option, enabled);
+    return 0;
+}
+
+static int cimgui_gen_PopItemFlag(lua_State *L)
+{
+    (void)L;
+    igPopItemFlag();
+    return 0;
+}
+
+static int cimgui_gen_PushItemWidth(lua_State *L)
+{
+    float item_width = (float)luaL_checknumber(L, 1);
+    igPushItemWidth(item_width);
+    return 0;
+}
+
+static int cimgui_gen_PopItemWidth(lua_State *L)
+{
+    (void)L;
+    igPopItemWidth();
+    return 0;
+}
+
+static int cimgui_gen_SetNextItemWidth(lua_State *L)
+{
+    float item_width = (float)luaL_checknumber(L, 1);
+    igSetNextItemWidth(item_width);
+    return 0;
+}
+
+static int cimgui_gen_CalcItemWidth(lua_State *L)
+{
+    float ret = igCalcItemWidth();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_PushTextWrapPos(lua_State *L)
+{
+    float wrap_local_pos_x = (float)luaL_optnumber(L, 1, 0.0f);
+    igPushTextWrapPos(wrap_local_pos_x);
+    return 0;
+}
+
+static int cimgui_gen_PopTextWrapPos(lua_State *L)
+{
+    (void)L;
+    igPopTextWrapPos();
+    return 0;
+}
+
+static int cimgui_gen_GetFontTexUvWhitePixel(lua_State *L)
+{
+    ImVec2 ret = igGetFontTexUvWhitePixel();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetColorU32(lua_State *L)
+{
+    ImGuiCol idx = (ImGuiCol)luaL_checkinteger(L, 1);
+    ImU32 ret = igGetColorU32(idx);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetColorU32Ex(lua_State *L)
+{
+    ImGuiCol idx = (ImGuiCol)luaL_checkinteger(L, 1);
+    float alpha_mul = (float)luaL_optnumber(L, 2, 1.0f);
+    ImU32 ret = igGetColorU32Ex(idx, alpha_mul);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetColorU32ImVec4(lua_State *L)
+{
+    ImVec4 col = check_imvec4(L, 1);
+    ImU32 ret = igGetColorU32ImVec4(col);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetColorU32ImU32(lua_State *L)
+{
+    ImU32 col = (ImU32)luaL_checkinteger(L, 1);
+    ImU32 ret = igGetColorU32ImU32(col);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetColorU32ImU32Ex(lua_State *L)
+{
+    ImU32 col = (ImU32)luaL_checkinteger(L, 1);
+    float alpha_mul = (float)luaL_optnumber(L, 2, 1.0f);
+    ImU32 ret = igGetColorU32ImU32Ex(col, alpha_mul);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetCursorScreenPos(lua_State *L)
+{
+    ImVec2 ret = igGetCursorScreenPos();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_SetCursorScreenPos(lua_State *L)
+{
+    ImVec2 pos = check_imvec2(L, 1);
+    igSetCursorScreenPos(pos);
+    return 0;
+}
+
+static int cimgui_gen_GetContentRegionAvail(lua_State *L)
+{
+    ImVec2 ret = igGetContentRegionAvail();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetCursorPos(lua_State *L)
+{
+    ImVec2 ret = igGetCursorPos();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetCursorPosX(lua_State *L)
+{
+    float ret = igGetCursorPosX();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetCursorPosY(lua_State *L)
+{
+    float ret = igGetCursorPosY();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetCursorPos(lua_State *L)
+{
+    ImVec2 local_pos = check_imvec2(L, 1);
+    igSetCursorPos(local_pos);
+    return 0;
+}
+
+static int cimgui_gen_SetCursorPosX(lua_State *L)
+{
+    float local_x = (float)luaL_checknumber(L, 1);
+    igSetCursorPosX(local_x);
+    return 0;
+}
+
+static int cimgui_gen_SetCursorPosY(lua_State *L)
+{
+    float local_y = (float)luaL_checknumber(L, 1);
+    igSetCursorPosY(local_y);
+    return 0;
+}
+
+static int cimgui_gen_GetCursorStartPos(lua_State *L)
+{
+    ImVec2 ret = igGetCursorStartPos();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_Separator(lua_State *L)
+{
+    (void)L;
+    igSeparator();
+    return 0;
+}
+
+static int cimgui_gen_SameLine(lua_State *L)
+{
+    (void)L;
+    igSameLine();
+    return 0;
+}
+
+static int cimgui_gen_SameLineEx(lua_State *L)
+{
+    float offset_from_start_x = (float)luaL_optnumber(L, 1, 0.0f);
+    float spacing = (float)luaL_optnumber(L, 2, -1.0f);
+    igSameLineEx(offset_from_start_x, spacing);
+    return 0;
+}
+
+static int cimgui_gen_NewLine(lua_State *L)
+{
+    (void)L;
+    igNewLine();
+    return 0;
+}
+
+static int cimgui_gen_Spacing(lua_State *L)
+{
+    (void)L;
+    igSpacing();
+    return 0;
+}
+
+static int cimgui_gen_Dummy(lua_State *L)
+{
+    ImVec2 size = check_imvec2(L, 1);
+    igDummy(size);
+    return 0;
+}
+
+static int cimgui_gen_Indent(lua_State *L)
+{
+    (void)L;
+    igIndent();
+    return 0;
+}
+
+static int cimgui_gen_IndentEx(lua_State *L)
+{
+    float indent_w = (float)luaL_optnumber(L, 1, 0.0f);
+    igIndentEx(indent_w);
+    return 0;
+}
+
+static int cimgui_gen_Unindent(lua_State *L)
+{
+    (void)L;
+    igUnindent();
+    return 0;
+}
+
+static int cimgui_gen_UnindentEx(lua_State *L)
+{
+    float indent_w = (float)luaL_optnumber(L, 1, 0.0f);
+    igUnindentEx(indent_w);
+    return 0;
+}
+
+static int cimgui_gen_BeginGroup(lua_State *L)
+{
+    (void)L;
+    igBeginGroup();
+    return 0;
+}
+
+static int cimgui_gen_EndGroup(lua_State *L)
+{
+    (void)L;
+    igEndGroup();
+    return 0;
+}
+
+static int cimgui_gen_AlignTextToFramePadding(lua_State *L)
+{
+    (void)L;
+    igAlignTextToFramePadding();
+    return 0;
+}
+
+static int cimgui_gen_GetTextLineHeight(lua_State *L)
+{
+    float ret = igGetTextLineHeight();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetTextLineHeightWithSpacing(lua_State *L)
+{
+    float ret = igGetTextLineHeightWithSpacing();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetFrameHeight(lua_State *L)
+{
+    float ret = igGetFrameHeight();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetFrameHeightWithSpacing(lua_State *L)
+{
+    float ret = igGetFrameHeightWithSpacing();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_PushID(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    igPushID(str_id);
+    return 0;
+}
+
+static int cimgui_gen_PushIDStr(lua_State *L)
+{
+    const char* str_id_begin = luaL_checkstring(L, 1);
+    igPushIDStr(str_id_begin, NULL);
+    return 0;
+}
+
+static int cimgui_gen_PushIDInt(lua_State *L)
+{
+    int int_id = (int)luaL_checkinteger(L, 1);
+    igPushIDInt(int_id);
+    return 0;
+}
+
+static int cimgui_gen_PopID(lua_State *L)
+{
+    (void)L;
+    igPopID();
+    return 0;
+}
+
+static int cimgui_gen_GetID(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImGuiID ret = igGetID(str_id);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetIDStr(lua_State *L)
+{
+    const char* str_id_begin = luaL_checkstring(L, 1);
+    ImGuiID ret = igGetIDStr(str_id_begin, NULL);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetIDInt(lua_State *L)
+{
+    int int_id = (int)luaL_checkinteger(L, 1);
+    ImGuiID ret = igGetIDInt(int_id);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_TextUnformatted(lua_State *L)
+{
+    const char* text = luaL_checkstring(L, 1);
+    igTextUnformatted(text);
+    return 0;
+}
+
+static int cimgui_gen_TextUnformattedEx(lua_State *L)
+{
+    const char* text = luaL_checkstring(L, 1);
+    igTextUnformattedEx(text, NULL);
+    return 0;
+}
+
+static int cimgui_gen_Text(lua_State *L)
+{
+    const char* fmt = luaL_checkstring(L, 1);
+    igText("%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_TextColored(lua_State *L)
+{
+    ImVec4 col = check_imvec4(L, 1);
+    const char* fmt = luaL_checkstring(L, 2);
+    igTextColored(col, "%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_TextDisabled(lua_State *L)
+{
+    const char* fmt = luaL_checkstring(L, 1);
+    igTextDisabled("%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_TextWrapped(lua_State *L)
+{
+    const char* fmt = luaL_checkstring(L, 1);
+    igTextWrapped("%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_LabelText(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    const char* fmt = luaL_checkstring(L, 2);
+    igLabelText(label, "%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_BulletText(lua_State *L)
+{
+    const char* fmt = luaL_checkstring(L, 1);
+    igBulletText("%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_SeparatorText(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    igSeparatorText(label);
+    return 0;
+}
+
+static int cimgui_gen_Button(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igButton(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_ButtonEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImVec2 size = lua_isnoneornil(L, 2) ? (ImVec2){ 0, 0 } : check_imvec2(L, 2);
+    bool ret = igButtonEx(label, size);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SmallButton(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igSmallButton(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InvisibleButton(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImVec2 size = check_imvec2(L, 2);
+    ImGuiButtonFlags flags = (ImGuiButtonFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igInvisibleButton(str_id, size, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_ArrowButton(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImGuiDir dir = (ImGuiDir)luaL_checkinteger(L, 2);
+    bool ret = igArrowButton(str_id, dir);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_Checkbox(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool v_v = lua_toboolean(L, 2);
+    bool ret = igCheckbox(label, &v_v);
+    lua_pushboolean(L, ret);
+    lua_pushboolean(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_CheckboxFlagsIntPtr(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int flags_v = (int)luaL_optinteger(L, 2, 0);
+    int flags_value = (int)luaL_checkinteger(L, 3);
+    bool ret = igCheckboxFlagsIntPtr(label, &flags_v, flags_value);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)flags_v);
+    return 2;
+}
+
+static int cimgui_gen_CheckboxFlagsUintPtr(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    unsigned int flags_v = (unsigned int)luaL_optinteger(L, 2, 0);
+    unsigned int flags_value = (unsigned int)luaL_checkinteger(L, 3);
+    bool ret = igCheckboxFlagsUintPtr(label, &flags_v, flags_value);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)flags_v);
+    return 2;
+}
+
+static int cimgui_gen_RadioButton(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool active = lua_toboolean(L, 2);
+    bool ret = igRadioButton(label, active);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_RadioButtonIntPtr(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_v = (int)luaL_optinteger(L, 2, 0);
+    int v_button = (int)luaL_checkinteger(L, 3);
+    bool ret = igRadioButtonIntPtr(label, &v_v, v_button);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_ProgressBar(lua_State *L)
+{
+    float fraction = (float)luaL_checknumber(L, 1);
+    ImVec2 size_arg = lua_isnoneornil(L, 2) ? (ImVec2){ -FLT_MIN, 0 } : check_imvec2(L, 2);
+    const char* overlay = lua_tostring(L, 3);
+    igProgressBar(fraction, size_arg, overlay);
+    return 0;
+}
+
+static int cimgui_gen_Bullet(lua_State *L)
+{
+    (void)L;
+    igBullet();
+    return 0;
+}
+
+static int cimgui_gen_TextLink(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igTextLink(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TextLinkOpenURL(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igTextLinkOpenURL(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TextLinkOpenURLEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    const char* url = lua_tostring(L, 2);
+    bool ret = igTextLinkOpenURLEx(label, url);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginCombo(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    const char* preview_value = luaL_checkstring(L, 2);
+    ImGuiComboFlags flags = (ImGuiComboFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igBeginCombo(label, preview_value, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndCombo(lua_State *L)
+{
+    (void)L;
+    igEndCombo();
+    return 0;
+}
+
+static int cimgui_gen_Combo(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int current_item_v = (int)luaL_optinteger(L, 2, 0);
+    const char* items_separated_by_zeros = luaL_checkstring(L, 3);
+    bool ret = igCombo(label, &current_item_v, items_separated_by_zeros);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)current_item_v);
+    return 2;
+}
+
+static int cimgui_gen_ComboEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int current_item_v = (int)luaL_optinteger(L, 2, 0);
+    const char* items_separated_by_zeros = luaL_checkstring(L, 3);
+    int popup_max_height_in_items = (int)luaL_optinteger(L, 4, -1);
+    bool ret = igComboEx(label, &current_item_v, items_separated_by_zeros, popup_max_height_in_items);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)current_item_v);
+    return 2;
+}
+
+static int cimgui_gen_DragFloat(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_v = (float)luaL_optnumber(L, 2, 0);
+    bool ret = igDragFloat(label, &v_v);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_DragFloatEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_v = (float)luaL_optnumber(L, 2, 0);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    float v_min = (float)luaL_optnumber(L, 4, 0.0f);
+    float v_max = (float)luaL_optnumber(L, 5, 0.0f);
+    const char* format = luaL_optstring(L, 6, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragFloatEx(label, &v_v, v_speed, v_min, v_max, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_DragFloat2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[2];
+    gen_read_floats(L, 2, v, 2);
+    bool ret = igDragFloat2(label, v);
+    gen_write_floats(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragFloat2Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[2];
+    gen_read_floats(L, 2, v, 2);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    float v_min = (float)luaL_optnumber(L, 4, 0.0f);
+    float v_max = (float)luaL_optnumber(L, 5, 0.0f);
+    const char* format = luaL_optstring(L, 6, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragFloat2Ex(label, v, v_speed, v_min, v_max, format, flags);
+    gen_write_floats(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragFloat3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[3];
+    gen_read_floats(L, 2, v, 3);
+    bool ret = igDragFloat3(label, v);
+    gen_write_floats(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragFloat3Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[3];
+    gen_read_floats(L, 2, v, 3);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    float v_min = (float)luaL_optnumber(L, 4, 0.0f);
+    float v_max = (float)luaL_optnumber(L, 5, 0.0f);
+    const char* format = luaL_optstring(L, 6, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragFloat3Ex(label, v, v_speed, v_min, v_max, format, flags);
+    gen_write_floats(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragFloat4(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[4];
+    gen_read_floats(L, 2, v, 4);
+    bool ret = igDragFloat4(label, v);
+    gen_write_floats(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragFloat4Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[4];
+    gen_read_floats(L, 2, v, 4);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    float v_min = (float)luaL_optnumber(L, 4, 0.0f);
+    float v_max = (float)luaL_optnumber(L, 5, 0.0f);
+    const char* format = luaL_optstring(L, 6, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragFloat4Ex(label, v, v_speed, v_min, v_max, format, flags);
+    gen_write_floats(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragFloatRange2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_current_min_v = (float)luaL_optnumber(L, 2, 0);
+    float v_current_max_v = (float)luaL_optnumber(L, 3, 0);
+    bool ret = igDragFloatRange2(label, &v_current_min_v, &v_current_max_v);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_current_min_v);
+    lua_pushnumber(L, v_current_max_v);
+    return 3;
+}
+
+static int cimgui_gen_DragFloatRange2Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_current_min_v = (float)luaL_optnumber(L, 2, 0);
+    float v_current_max_v = (float)luaL_optnumber(L, 3, 0);
+    float v_speed = (float)luaL_optnumber(L, 4, 1.0f);
+    float v_min = (float)luaL_optnumber(L, 5, 0.0f);
+    float v_max = (float)luaL_optnumber(L, 6, 0.0f);
+    const char* format = luaL_optstring(L, 7, "%.3f");
+    const char* format_max = lua_tostring(L, 8);
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 9, 0);
+    bool ret = igDragFloatRange2Ex(label, &v_current_min_v, &v_current_max_v, v_speed, v_min, v_max, format, format_max, flags);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_current_min_v);
+    lua_pushnumber(L, v_current_max_v);
+    return 3;
+}
+
+static int cimgui_gen_DragInt(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_v = (int)luaL_optinteger(L, 2, 0);
+    bool ret = igDragInt(label, &v_v);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_DragIntEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_v = (int)luaL_optinteger(L, 2, 0);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    int v_min = (int)luaL_optinteger(L, 4, 0);
+    int v_max = (int)luaL_optinteger(L, 5, 0);
+    const char* format = luaL_optstring(L, 6, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragIntEx(label, &v_v, v_speed, v_min, v_max, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_DragInt2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[2];
+    gen_read_ints(L, 2, v, 2);
+    bool ret = igDragInt2(label, v);
+    gen_write_ints(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragInt2Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[2];
+    gen_read_ints(L, 2, v, 2);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    int v_min = (int)luaL_optinteger(L, 4, 0);
+    int v_max = (int)luaL_optinteger(L, 5, 0);
+    const char* format = luaL_optstring(L, 6, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragInt2Ex(label, v, v_speed, v_min, v_max, format, flags);
+    gen_write_ints(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragInt3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[3];
+    gen_read_ints(L, 2, v, 3);
+    bool ret = igDragInt3(label, v);
+    gen_write_ints(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragInt3Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[3];
+    gen_read_ints(L, 2, v, 3);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    int v_min = (int)luaL_optinteger(L, 4, 0);
+    int v_max = (int)luaL_optinteger(L, 5, 0);
+    const char* format = luaL_optstring(L, 6, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragInt3Ex(label, v, v_speed, v_min, v_max, format, flags);
+    gen_write_ints(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragInt4(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[4];
+    gen_read_ints(L, 2, v, 4);
+    bool ret = igDragInt4(label, v);
+    gen_write_ints(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragInt4Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[4];
+    gen_read_ints(L, 2, v, 4);
+    float v_speed = (float)luaL_optnumber(L, 3, 1.0f);
+    int v_min = (int)luaL_optinteger(L, 4, 0);
+    int v_max = (int)luaL_optinteger(L, 5, 0);
+    const char* format = luaL_optstring(L, 6, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igDragInt4Ex(label, v, v_speed, v_min, v_max, format, flags);
+    gen_write_ints(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_DragIntRange2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_current_min_v = (int)luaL_optinteger(L, 2, 0);
+    int v_current_max_v = (int)luaL_optinteger(L, 3, 0);
+    bool ret = igDragIntRange2(label, &v_current_min_v, &v_current_max_v);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_current_min_v);
+    lua_pushinteger(L, (lua_Integer)v_current_max_v);
+    return 3;
+}
+
+static int cimgui_gen_DragIntRange2Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_current_min_v = (int)luaL_optinteger(L, 2, 0);
+    int v_current_max_v = (int)luaL_optinteger(L, 3, 0);
+    float v_speed = (float)luaL_optnumber(L, 4, 1.0f);
+    int v_min = (int)luaL_optinteger(L, 5, 0);
+    int v_max = (int)luaL_optinteger(L, 6, 0);
+    const char* format = luaL_optstring(L, 7, "%d");
+    const char* format_max = lua_tostring(L, 8);
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 9, 0);
+    bool ret = igDragIntRange2Ex(label, &v_current_min_v, &v_current_max_v, v_speed, v_min, v_max, format, format_max, flags);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_current_min_v);
+    lua_pushinteger(L, (lua_Integer)v_current_max_v);
+    return 3;
+}
+
+static int cimgui_gen_SliderFloat(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_v = (float)luaL_optnumber(L, 2, 0);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    bool ret = igSliderFloat(label, &v_v, v_min, v_max);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_SliderFloatEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_v = (float)luaL_optnumber(L, 2, 0);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    const char* format = luaL_optstring(L, 5, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderFloatEx(label, &v_v, v_min, v_max, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_SliderFloat2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[2];
+    gen_read_floats(L, 2, v, 2);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    bool ret = igSliderFloat2(label, v, v_min, v_max);
+    gen_write_floats(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderFloat2Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[2];
+    gen_read_floats(L, 2, v, 2);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    const char* format = luaL_optstring(L, 5, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderFloat2Ex(label, v, v_min, v_max, format, flags);
+    gen_write_floats(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderFloat3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[3];
+    gen_read_floats(L, 2, v, 3);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    bool ret = igSliderFloat3(label, v, v_min, v_max);
+    gen_write_floats(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderFloat3Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[3];
+    gen_read_floats(L, 2, v, 3);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    const char* format = luaL_optstring(L, 5, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderFloat3Ex(label, v, v_min, v_max, format, flags);
+    gen_write_floats(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderFloat4(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[4];
+    gen_read_floats(L, 2, v, 4);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    bool ret = igSliderFloat4(label, v, v_min, v_max);
+    gen_write_floats(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderFloat4Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[4];
+    gen_read_floats(L, 2, v, 4);
+    float v_min = (float)luaL_checknumber(L, 3);
+    float v_max = (float)luaL_checknumber(L, 4);
+    const char* format = luaL_optstring(L, 5, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderFloat4Ex(label, v, v_min, v_max, format, flags);
+    gen_write_floats(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderAngle(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_rad_v = (float)luaL_optnumber(L, 2, 0);
+    bool ret = igSliderAngle(label, &v_rad_v);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_rad_v);
+    return 2;
+}
+
+static int cimgui_gen_SliderAngleEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_rad_v = (float)luaL_optnumber(L, 2, 0);
+    float v_degrees_min = (float)luaL_optnumber(L, 3, -360.0f);
+    float v_degrees_max = (float)luaL_optnumber(L, 4, +360.0f);
+    const char* format = luaL_optstring(L, 5, "%.0f deg");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderAngleEx(label, &v_rad_v, v_degrees_min, v_degrees_max, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_rad_v);
+    return 2;
+}
+
+static int cimgui_gen_SliderInt(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_v = (int)luaL_optinteger(L, 2, 0);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    bool ret = igSliderInt(label, &v_v, v_min, v_max);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_SliderIntEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_v = (int)luaL_optinteger(L, 2, 0);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    const char* format = luaL_optstring(L, 5, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderIntEx(label, &v_v, v_min, v_max, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_SliderInt2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[2];
+    gen_read_ints(L, 2, v, 2);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    bool ret = igSliderInt2(label, v, v_min, v_max);
+    gen_write_ints(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderInt2Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[2];
+    gen_read_ints(L, 2, v, 2);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    const char* format = luaL_optstring(L, 5, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderInt2Ex(label, v, v_min, v_max, format, flags);
+    gen_write_ints(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderInt3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[3];
+    gen_read_ints(L, 2, v, 3);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    bool ret = igSliderInt3(label, v, v_min, v_max);
+    gen_write_ints(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderInt3Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[3];
+    gen_read_ints(L, 2, v, 3);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    const char* format = luaL_optstring(L, 5, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderInt3Ex(label, v, v_min, v_max, format, flags);
+    gen_write_ints(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderInt4(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[4];
+    gen_read_ints(L, 2, v, 4);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    bool ret = igSliderInt4(label, v, v_min, v_max);
+    gen_write_ints(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SliderInt4Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[4];
+    gen_read_ints(L, 2, v, 4);
+    int v_min = (int)luaL_checkinteger(L, 3);
+    int v_max = (int)luaL_checkinteger(L, 4);
+    const char* format = luaL_optstring(L, 5, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igSliderInt4Ex(label, v, v_min, v_max, format, flags);
+    gen_write_ints(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_VSliderFloat(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImVec2 size = check_imvec2(L, 2);
+    float v_v = (float)luaL_optnumber(L, 3, 0);
+    float v_min = (float)luaL_checknumber(L, 4);
+    float v_max = (float)luaL_checknumber(L, 5);
+    bool ret = igVSliderFloat(label, size, &v_v, v_min, v_max);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_VSliderFloatEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImVec2 size = check_imvec2(L, 2);
+    float v_v = (float)luaL_optnumber(L, 3, 0);
+    float v_min = (float)luaL_checknumber(L, 4);
+    float v_max = (float)luaL_checknumber(L, 5);
+    const char* format = luaL_optstring(L, 6, "%.3f");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igVSliderFloatEx(label, size, &v_v, v_min, v_max, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_VSliderInt(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImVec2 size = check_imvec2(L, 2);
+    int v_v = (int)luaL_optinteger(L, 3, 0);
+    int v_min = (int)luaL_checkinteger(L, 4);
+    int v_max = (int)luaL_checkinteger(L, 5);
+    bool ret = igVSliderInt(label, size, &v_v, v_min, v_max);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_VSliderIntEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImVec2 size = check_imvec2(L, 2);
+    int v_v = (int)luaL_optinteger(L, 3, 0);
+    int v_min = (int)luaL_checkinteger(L, 4);
+    int v_max = (int)luaL_checkinteger(L, 5);
+    const char* format = luaL_optstring(L, 6, "%d");
+    ImGuiSliderFlags flags = (ImGuiSliderFlags)luaL_optinteger(L, 7, 0);
+    bool ret = igVSliderIntEx(label, size, &v_v, v_min, v_max, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_InputText(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    size_t buf_len;
+    const char* buf_in = luaL_checklstring(L, 2, &buf_len);
+    char* buf = gen_text_buffer(buf_in, buf_len);
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igInputText(label, buf, CIMGUI_LUA_TEXT_CAPACITY, flags);
+    lua_pushboolean(L, ret);
+    lua_pushstring(L, buf);
+    return 2;
+}
+
+static int cimgui_gen_InputTextMultiline(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    size_t buf_len;
+    const char* buf_in = luaL_checklstring(L, 2, &buf_len);
+    char* buf = gen_text_buffer(buf_in, buf_len);
+    bool ret = igInputTextMultiline(label, buf, CIMGUI_LUA_TEXT_CAPACITY);
+    lua_pushboolean(L, ret);
+    lua_pushstring(L, buf);
+    return 2;
+}
+
+static int cimgui_gen_InputTextWithHint(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    const char* hint = luaL_checkstring(L, 2);
+    size_t buf_len;
+    const char* buf_in = luaL_checklstring(L, 3, &buf_len);
+    char* buf = gen_text_buffer(buf_in, buf_len);
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 4, 0);
+    bool ret = igInputTextWithHint(label, hint, buf, CIMGUI_LUA_TEXT_CAPACITY, flags);
+    lua_pushboolean(L, ret);
+    lua_pushstring(L, buf);
+    return 2;
+}
+
+static int cimgui_gen_InputFloat(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_v = (float)luaL_optnumber(L, 2, 0);
+    bool ret = igInputFloat(label, &v_v);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_InputFloatEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v_v = (float)luaL_optnumber(L, 2, 0);
+    float step = (float)luaL_optnumber(L, 3, 0.0f);
+    float step_fast = (float)luaL_optnumber(L, 4, 0.0f);
+    const char* format = luaL_optstring(L, 5, "%.3f");
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igInputFloatEx(label, &v_v, step, step_fast, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_InputFloat2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[2];
+    gen_read_floats(L, 2, v, 2);
+    bool ret = igInputFloat2(label, v);
+    gen_write_floats(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputFloat2Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[2];
+    gen_read_floats(L, 2, v, 2);
+    const char* format = luaL_optstring(L, 3, "%.3f");
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 4, 0);
+    bool ret = igInputFloat2Ex(label, v, format, flags);
+    gen_write_floats(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputFloat3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[3];
+    gen_read_floats(L, 2, v, 3);
+    bool ret = igInputFloat3(label, v);
+    gen_write_floats(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputFloat3Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[3];
+    gen_read_floats(L, 2, v, 3);
+    const char* format = luaL_optstring(L, 3, "%.3f");
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 4, 0);
+    bool ret = igInputFloat3Ex(label, v, format, flags);
+    gen_write_floats(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputFloat4(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[4];
+    gen_read_floats(L, 2, v, 4);
+    bool ret = igInputFloat4(label, v);
+    gen_write_floats(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputFloat4Ex(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float v[4];
+    gen_read_floats(L, 2, v, 4);
+    const char* format = luaL_optstring(L, 3, "%.3f");
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 4, 0);
+    bool ret = igInputFloat4Ex(label, v, format, flags);
+    gen_write_floats(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputInt(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_v = (int)luaL_optinteger(L, 2, 0);
+    bool ret = igInputInt(label, &v_v);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_InputIntEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v_v = (int)luaL_optinteger(L, 2, 0);
+    int step = (int)luaL_optinteger(L, 3, 1);
+    int step_fast = (int)luaL_optinteger(L, 4, 100);
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 5, 0);
+    bool ret = igInputIntEx(label, &v_v, step, step_fast, flags);
+    lua_pushboolean(L, ret);
+    lua_pushinteger(L, (lua_Integer)v_v);
+    return 2;
+}
+
+static int cimgui_gen_InputInt2(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[2];
+    gen_read_ints(L, 2, v, 2);
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igInputInt2(label, v, flags);
+    gen_write_ints(L, 2, v, 2);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputInt3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[3];
+    gen_read_ints(L, 2, v, 3);
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igInputInt3(label, v, flags);
+    gen_write_ints(L, 2, v, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputInt4(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    int v[4];
+    gen_read_ints(L, 2, v, 4);
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igInputInt4(label, v, flags);
+    gen_write_ints(L, 2, v, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_InputDouble(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    double v_v = (double)luaL_optnumber(L, 2, 0);
+    bool ret = igInputDouble(label, &v_v);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_InputDoubleEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    double v_v = (double)luaL_optnumber(L, 2, 0);
+    double step = (double)luaL_optnumber(L, 3, 0.0);
+    double step_fast = (double)luaL_optnumber(L, 4, 0.0);
+    const char* format = luaL_optstring(L, 5, "%.6f");
+    ImGuiInputTextFlags flags = (ImGuiInputTextFlags)luaL_optinteger(L, 6, 0);
+    bool ret = igInputDoubleEx(label, &v_v, step, step_fast, format, flags);
+    lua_pushboolean(L, ret);
+    lua_pushnumber(L, v_v);
+    return 2;
+}
+
+static int cimgui_gen_ColorEdit3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float col[3];
+    gen_read_floats(L, 2, col, 3);
+    ImGuiColorEditFlags flags = (ImGuiColorEditFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igColorEdit3(label, col, flags);
+    gen_write_floats(L, 2, col, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_ColorEdit4(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float col[4];
+    gen_read_floats(L, 2, col, 4);
+    ImGuiColorEditFlags flags = (ImGuiColorEditFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igColorEdit4(label, col, flags);
+    gen_write_floats(L, 2, col, 4);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_ColorPicker3(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    float col[3];
+    gen_read_floats(L, 2, col, 3);
+    ImGuiColorEditFlags flags = (ImGuiColorEditFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igColorPicker3(label, col, flags);
+    gen_write_floats(L, 2, col, 3);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_ColorButton(lua_State *L)
+{
+    const char* desc_id = luaL_checkstring(L, 1);
+    ImVec4 col = check_imvec4(L, 2);
+    ImGuiColorEditFlags flags = (ImGuiColorEditFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igColorButton(desc_id, col, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_ColorButtonEx(lua_State *L)
+{
+    const char* desc_id = luaL_checkstring(L, 1);
+    ImVec4 col = check_imvec4(L, 2);
+    ImGuiColorEditFlags flags = (ImGuiColorEditFlags)luaL_optinteger(L, 3, 0);
+    ImVec2 size = lua_isnoneornil(L, 4) ? (ImVec2){ 0, 0 } : check_imvec2(L, 4);
+    bool ret = igColorButtonEx(desc_id, col, flags, size);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetColorEditOptions(lua_State *L)
+{
+    ImGuiColorEditFlags flags = (ImGuiColorEditFlags)luaL_checkinteger(L, 1);
+    igSetColorEditOptions(flags);
+    return 0;
+}
+
+static int cimgui_gen_TreeNode(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igTreeNode(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TreeNodeStr(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    const char* fmt = luaL_checkstring(L, 2);
+    bool ret = igTreeNodeStr(str_id, "%s", fmt);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TreeNodeEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImGuiTreeNodeFlags flags = (ImGuiTreeNodeFlags)luaL_optinteger(L, 2, 0);
+    bool ret = igTreeNodeEx(label, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TreeNodeExStr(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImGuiTreeNodeFlags flags = (ImGuiTreeNodeFlags)luaL_checkinteger(L, 2);
+    const char* fmt = luaL_checkstring(L, 3);
+    bool ret = igTreeNodeExStr(str_id, flags, "%s", fmt);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TreePush(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    igTreePush(str_id);
+    return 0;
+}
+
+static int cimgui_gen_TreePop(lua_State *L)
+{
+    (void)L;
+    igTreePop();
+    return 0;
+}
+
+static int cimgui_gen_GetTreeNodeToLabelSpacing(lua_State *L)
+{
+    float ret = igGetTreeNodeToLabelSpacing();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_CollapsingHeader(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImGuiTreeNodeFlags flags = (ImGuiTreeNodeFlags)luaL_optinteger(L, 2, 0);
+    bool ret = igCollapsingHeader(label, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_CollapsingHeaderBoolPtr(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool p_visible_v = lua_toboolean(L, 2);
+    ImGuiTreeNodeFlags flags = (ImGuiTreeNodeFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igCollapsingHeaderBoolPtr(label, &p_visible_v, flags);
+    lua_pushboolean(L, ret);
+    lua_pushboolean(L, p_visible_v);
+    return 2;
+}
+
+static int cimgui_gen_SetNextItemOpen(lua_State *L)
+{
+    bool is_open = lua_toboolean(L, 1);
+    ImGuiCond cond = (ImGuiCond)luaL_optinteger(L, 2, 0);
+    igSetNextItemOpen(is_open, cond);
+    return 0;
+}
+
+static int cimgui_gen_SetNextItemStorageID(lua_State *L)
+{
+    ImGuiID storage_id = (ImGuiID)luaL_checkinteger(L, 1);
+    igSetNextItemStorageID(storage_id);
+    return 0;
+}
+
+static int cimgui_gen_Selectable(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igSelectable(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SelectableEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool selected = lua_isnoneornil(L, 2) ? false : lua_toboolean(L, 2);
+    ImGuiSelectableFlags flags = (ImGuiSelectableFlags)luaL_optinteger(L, 3, 0);
+    ImVec2 size = lua_isnoneornil(L, 4) ? (ImVec2){ 0, 0 } : check_imvec2(L, 4);
+    bool ret = igSelectableEx(label, selected, flags, size);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SelectableBoolPtr(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool p_selected_v = lua_toboolean(L, 2);
+    ImGuiSelectableFlags flags = (ImGuiSelectableFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igSelectableBoolPtr(label, &p_selected_v, flags);
+    lua_pushboolean(L, ret);
+    lua_pushboolean(L, p_selected_v);
+    return 2;
+}
+
+static int cimgui_gen_SelectableBoolPtrEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool p_selected_v = lua_toboolean(L, 2);
+    ImGuiSelectableFlags flags = (ImGuiSelectableFlags)luaL_optinteger(L, 3, 0);
+    ImVec2 size = lua_isnoneornil(L, 4) ? (ImVec2){ 0, 0 } : check_imvec2(L, 4);
+    bool ret = igSelectableBoolPtrEx(label, &p_selected_v, flags, size);
+    lua_pushboolean(L, ret);
+    lua_pushboolean(L, p_selected_v);
+    return 2;
+}
+
+static int cimgui_gen_IsItemToggledSelection(lua_State *L)
+{
+    bool ret = igIsItemToggledSelection();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginListBox(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImVec2 size = lua_isnoneornil(L, 2) ? (ImVec2){ 0, 0 } : check_imvec2(L, 2);
+    bool ret = igBeginListBox(label, size);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndListBox(lua_State *L)
+{
+    (void)L;
+    igEndListBox();
+    return 0;
+}
+
+static int cimgui_gen_BeginMenuBar(lua_State *L)
+{
+    bool ret = igBeginMenuBar();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndMenuBar(lua_State *L)
+{
+    (void)L;
+    igEndMenuBar();
+    return 0;
+}
+
+static int cimgui_gen_BeginMainMenuBar(lua_State *L)
+{
+    bool ret = igBeginMainMenuBar();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndMainMenuBar(lua_State *L)
+{
+    (void)L;
+    igEndMainMenuBar();
+    return 0;
+}
+
+static int cimgui_gen_BeginMenu(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igBeginMenu(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginMenuEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool enabled = lua_isnoneornil(L, 2) ? true : lua_toboolean(L, 2);
+    bool ret = igBeginMenuEx(label, enabled);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndMenu(lua_State *L)
+{
+    (void)L;
+    igEndMenu();
+    return 0;
+}
+
+static int cimgui_gen_MenuItem(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool ret = igMenuItem(label);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_MenuItemEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    const char* shortcut = lua_tostring(L, 2);
+    bool selected = lua_isnoneornil(L, 3) ? false : lua_toboolean(L, 3);
+    bool enabled = lua_isnoneornil(L, 4) ? true : lua_toboolean(L, 4);
+    bool ret = igMenuItemEx(label, shortcut, selected, enabled);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_MenuItemBoolPtr(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    const char* shortcut = luaL_checkstring(L, 2);
+    bool p_selected_v = lua_toboolean(L, 3);
+    bool enabled = lua_isnoneornil(L, 4) ? true : lua_toboolean(L, 4);
+    bool ret = igMenuItemBoolPtr(label, shortcut, &p_selected_v, enabled);
+    lua_pushboolean(L, ret);
+    lua_pushboolean(L, p_selected_v);
+    return 2;
+}
+
+static int cimgui_gen_BeginTooltip(lua_State *L)
+{
+    bool ret = igBeginTooltip();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndTooltip(lua_State *L)
+{
+    (void)L;
+    igEndTooltip();
+    return 0;
+}
+
+static int cimgui_gen_SetTooltip(lua_State *L)
+{
+    const char* fmt = luaL_checkstring(L, 1);
+    igSetTooltip("%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_BeginItemTooltip(lua_State *L)
+{
+    bool ret = igBeginItemTooltip();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetItemTooltip(lua_State *L)
+{
+    const char* fmt = luaL_checkstring(L, 1);
+    igSetItemTooltip("%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_BeginPopup(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImGuiWindowFlags flags = (ImGuiWindowFlags)luaL_optinteger(L, 2, 0);
+    bool ret = igBeginPopup(str_id, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginPopupModal(lua_State *L)
+{
+    const char* name = luaL_checkstring(L, 1);
+    bool p_open_v = lua_toboolean(L, 2);
+    bool p_open_set = !lua_isnoneornil(L, 2);
+    ImGuiWindowFlags flags = (ImGuiWindowFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igBeginPopupModal(name, p_open_set ? &p_open_v : NULL, flags);
+    lua_pushboolean(L, ret);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 2;
+}
+
+static int cimgui_gen_EndPopup(lua_State *L)
+{
+    (void)L;
+    igEndPopup();
+    return 0;
+}
+
+static int cimgui_gen_OpenPopup(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImGuiPopupFlags popup_flags = (ImGuiPopupFlags)luaL_optinteger(L, 2, 0);
+    igOpenPopup(str_id, popup_flags);
+    return 0;
+}
+
+static int cimgui_gen_OpenPopupID(lua_State *L)
+{
+    ImGuiID id = (ImGuiID)luaL_checkinteger(L, 1);
+    ImGuiPopupFlags popup_flags = (ImGuiPopupFlags)luaL_optinteger(L, 2, 0);
+    igOpenPopupID(id, popup_flags);
+    return 0;
+}
+
+static int cimgui_gen_OpenPopupOnItemClick(lua_State *L)
+{
+    const char* str_id = lua_tostring(L, 1);
+    ImGuiPopupFlags popup_flags = (ImGuiPopupFlags)luaL_optinteger(L, 2, 1);
+    igOpenPopupOnItemClick(str_id, popup_flags);
+    return 0;
+}
+
+static int cimgui_gen_CloseCurrentPopup(lua_State *L)
+{
+    (void)L;
+    igCloseCurrentPopup();
+    return 0;
+}
+
+static int cimgui_gen_BeginPopupContextItem(lua_State *L)
+{
+    bool ret = igBeginPopupContextItem();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginPopupContextItemEx(lua_State *L)
+{
+    const char* str_id = lua_tostring(L, 1);
+    ImGuiPopupFlags popup_flags = (ImGuiPopupFlags)luaL_optinteger(L, 2, 1);
+    bool ret = igBeginPopupContextItemEx(str_id, popup_flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginPopupContextWindow(lua_State *L)
+{
+    bool ret = igBeginPopupContextWindow();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginPopupContextWindowEx(lua_State *L)
+{
+    const char* str_id = lua_tostring(L, 1);
+    ImGuiPopupFlags popup_flags = (ImGuiPopupFlags)luaL_optinteger(L, 2, 1);
+    bool ret = igBeginPopupContextWindowEx(str_id, popup_flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginPopupContextVoid(lua_State *L)
+{
+    bool ret = igBeginPopupContextVoid();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginPopupContextVoidEx(lua_State *L)
+{
+    const char* str_id = lua_tostring(L, 1);
+    ImGuiPopupFlags popup_flags = (ImGuiPopupFlags)luaL_optinteger(L, 2, 1);
+    bool ret = igBeginPopupContextVoidEx(str_id, popup_flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsPopupOpen(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImGuiPopupFlags flags = (ImGuiPopupFlags)luaL_optinteger(L, 2, 0);
+    bool ret = igIsPopupOpen(str_id, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginTable(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    int columns = (int)luaL_checkinteger(L, 2);
+    ImGuiTableFlags flags = (ImGuiTableFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igBeginTable(str_id, columns, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginTableEx(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    int columns = (int)luaL_checkinteger(L, 2);
+    ImGuiTableFlags flags = (ImGuiTableFlags)luaL_optinteger(L, 3, 0);
+    ImVec2 outer_size = lua_isnoneornil(L, 4) ? (ImVec2){ 0.0f, 0.0f } : check_imvec2(L, 4);
+    float inner_width = (float)luaL_optnumber(L, 5, 0.0f);
+    bool ret = igBeginTableEx(str_id, columns, flags, outer_size, inner_width);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndTable(lua_State *L)
+{
+    (void)L;
+    igEndTable();
+    return 0;
+}
+
+static int cimgui_gen_TableNextRow(lua_State *L)
+{
+    (void)L;
+    igTableNextRow();
+    return 0;
+}
+
+static int cimgui_gen_TableNextRowEx(lua_State *L)
+{
+    ImGuiTableRowFlags row_flags = (ImGuiTableRowFlags)luaL_optinteger(L, 1, 0);
+    float min_row_height = (float)luaL_optnumber(L, 2, 0.0f);
+    igTableNextRowEx(row_flags, min_row_height);
+    return 0;
+}
+
+static int cimgui_gen_TableNextColumn(lua_State *L)
+{
+    bool ret = igTableNextColumn();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TableSetColumnIndex(lua_State *L)
+{
+    int column_n = (int)luaL_checkinteger(L, 1);
+    bool ret = igTableSetColumnIndex(column_n);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TableSetupColumn(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImGuiTableColumnFlags flags = (ImGuiTableColumnFlags)luaL_optinteger(L, 2, 0);
+    igTableSetupColumn(label, flags);
+    return 0;
+}
+
+static int cimgui_gen_TableSetupColumnEx(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImGuiTableColumnFlags flags = (ImGuiTableColumnFlags)luaL_optinteger(L, 2, 0);
+    float init_width_or_weight = (float)luaL_optnumber(L, 3, 0.0f);
+    ImGuiID user_id = (ImGuiID)luaL_optinteger(L, 4, 0);
+    igTableSetupColumnEx(label, flags, init_width_or_weight, user_id);
+    return 0;
+}
+
+static int cimgui_gen_TableSetupScrollFreeze(lua_State *L)
+{
+    int cols = (int)luaL_checkinteger(L, 1);
+    int rows = (int)luaL_checkinteger(L, 2);
+    igTableSetupScrollFreeze(cols, rows);
+    return 0;
+}
+
+static int cimgui_gen_TableHeader(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    igTableHeader(label);
+    return 0;
+}
+
+static int cimgui_gen_TableHeadersRow(lua_State *L)
+{
+    (void)L;
+    igTableHeadersRow();
+    return 0;
+}
+
+static int cimgui_gen_TableAngledHeadersRow(lua_State *L)
+{
+    (void)L;
+    igTableAngledHeadersRow();
+    return 0;
+}
+
+static int cimgui_gen_TableGetColumnCount(lua_State *L)
+{
+    int ret = igTableGetColumnCount();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_TableGetColumnIndex(lua_State *L)
+{
+    int ret = igTableGetColumnIndex();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_TableGetRowIndex(lua_State *L)
+{
+    int ret = igTableGetRowIndex();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_TableGetColumnName(lua_State *L)
+{
+    int column_n = (int)luaL_optinteger(L, 1, -1);
+    const char* ret = igTableGetColumnName(column_n);
+    lua_pushstring(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_TableGetColumnFlags(lua_State *L)
+{
+    int column_n = (int)luaL_optinteger(L, 1, -1);
+    ImGuiTableColumnFlags ret = igTableGetColumnFlags(column_n);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_TableSetColumnEnabled(lua_State *L)
+{
+    int column_n = (int)luaL_checkinteger(L, 1);
+    bool v = lua_toboolean(L, 2);
+    igTableSetColumnEnabled(column_n, v);
+    return 0;
+}
+
+static int cimgui_gen_TableGetHoveredColumn(lua_State *L)
+{
+    int ret = igTableGetHoveredColumn();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_TableSetBgColor(lua_State *L)
+{
+    ImGuiTableBgTarget target = (ImGuiTableBgTarget)luaL_checkinteger(L, 1);
+    ImU32 color = (ImU32)luaL_checkinteger(L, 2);
+    int column_n = (int)luaL_optinteger(L, 3, -1);
+    igTableSetBgColor(target, color, column_n);
+    return 0;
+}
+
+static int cimgui_gen_Columns(lua_State *L)
+{
+    (void)L;
+    igColumns();
+    return 0;
+}
+
+static int cimgui_gen_ColumnsEx(lua_State *L)
+{
+    int count = (int)luaL_optinteger(L, 1, 1);
+    const char* id = lua_tostring(L, 2);
+    bool borders = lua_isnoneornil(L, 3) ? true : lua_toboolean(L, 3);
+    igColumnsEx(count, id, borders);
+    return 0;
+}
+
+static int cimgui_gen_NextColumn(lua_State *L)
+{
+    (void)L;
+    igNextColumn();
+    return 0;
+}
+
+static int cimgui_gen_GetColumnIndex(lua_State *L)
+{
+    int ret = igGetColumnIndex();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetColumnWidth(lua_State *L)
+{
+    int column_index = (int)luaL_optinteger(L, 1, -1);
+    float ret = igGetColumnWidth(column_index);
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetColumnWidth(lua_State *L)
+{
+    int column_index = (int)luaL_checkinteger(L, 1);
+    float width = (float)luaL_checknumber(L, 2);
+    igSetColumnWidth(column_index, width);
+    return 0;
+}
+
+static int cimgui_gen_GetColumnOffset(lua_State *L)
+{
+    int column_index = (int)luaL_optinteger(L, 1, -1);
+    float ret = igGetColumnOffset(column_index);
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetColumnOffset(lua_State *L)
+{
+    int column_index = (int)luaL_checkinteger(L, 1);
+    float offset_x = (float)luaL_checknumber(L, 2);
+    igSetColumnOffset(column_index, offset_x);
+    return 0;
+}
+
+static int cimgui_gen_GetColumnsCount(lua_State *L)
+{
+    int ret = igGetColumnsCount();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_BeginTabBar(lua_State *L)
+{
+    const char* str_id = luaL_checkstring(L, 1);
+    ImGuiTabBarFlags flags = (ImGuiTabBarFlags)luaL_optinteger(L, 2, 0);
+    bool ret = igBeginTabBar(str_id, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndTabBar(lua_State *L)
+{
+    (void)L;
+    igEndTabBar();
+    return 0;
+}
+
+static int cimgui_gen_BeginTabItem(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    bool p_open_v = lua_toboolean(L, 2);
+    bool p_open_set = !lua_isnoneornil(L, 2);
+    ImGuiTabItemFlags flags = (ImGuiTabItemFlags)luaL_optinteger(L, 3, 0);
+    bool ret = igBeginTabItem(label, p_open_set ? &p_open_v : NULL, flags);
+    lua_pushboolean(L, ret);
+    if (p_open_set) lua_pushboolean(L, p_open_v); else lua_pushnil(L);
+    return 2;
+}
+
+static int cimgui_gen_EndTabItem(lua_State *L)
+{
+    (void)L;
+    igEndTabItem();
+    return 0;
+}
+
+static int cimgui_gen_TabItemButton(lua_State *L)
+{
+    const char* label = luaL_checkstring(L, 1);
+    ImGuiTabItemFlags flags = (ImGuiTabItemFlags)luaL_optinteger(L, 2, 0);
+    bool ret = igTabItemButton(label, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetTabItemClosed(lua_State *L)
+{
+    const char* tab_or_docked_window_label = luaL_checkstring(L, 1);
+    igSetTabItemClosed(tab_or_docked_window_label);
+    return 0;
+}
+
+static int cimgui_gen_LogToTTY(lua_State *L)
+{
+    int auto_open_depth = (int)luaL_optinteger(L, 1, -1);
+    igLogToTTY(auto_open_depth);
+    return 0;
+}
+
+static int cimgui_gen_LogToFile(lua_State *L)
+{
+    int auto_open_depth = (int)luaL_optinteger(L, 1, -1);
+    const char* filename = lua_tostring(L, 2);
+    igLogToFile(auto_open_depth, filename);
+    return 0;
+}
+
+static int cimgui_gen_LogToClipboard(lua_State *L)
+{
+    int auto_open_depth = (int)luaL_optinteger(L, 1, -1);
+    igLogToClipboard(auto_open_depth);
+    return 0;
+}
+
+static int cimgui_gen_LogFinish(lua_State *L)
+{
+    (void)L;
+    igLogFinish();
+    return 0;
+}
+
+static int cimgui_gen_LogButtons(lua_State *L)
+{
+    (void)L;
+    igLogButtons();
+    return 0;
+}
+
+static int cimgui_gen_LogText(lua_State *L)
+{
+    const char* fmt = luaL_checkstring(L, 1);
+    igLogText("%s", fmt);
+    return 0;
+}
+
+static int cimgui_gen_BeginDragDropSource(lua_State *L)
+{
+    ImGuiDragDropFlags flags = (ImGuiDragDropFlags)luaL_optinteger(L, 1, 0);
+    bool ret = igBeginDragDropSource(flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndDragDropSource(lua_State *L)
+{
+    (void)L;
+    igEndDragDropSource();
+    return 0;
+}
+
+static int cimgui_gen_BeginDragDropTarget(lua_State *L)
+{
+    bool ret = igBeginDragDropTarget();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_EndDragDropTarget(lua_State *L)
+{
+    (void)L;
+    igEndDragDropTarget();
+    return 0;
+}
+
+static int cimgui_gen_BeginDisabled(lua_State *L)
+{
+    bool disabled = lua_isnoneornil(L, 1) ? true : lua_toboolean(L, 1);
+    igBeginDisabled(disabled);
+    return 0;
+}
+
+static int cimgui_gen_EndDisabled(lua_State *L)
+{
+    (void)L;
+    igEndDisabled();
+    return 0;
+}
+
+static int cimgui_gen_PushClipRect(lua_State *L)
+{
+    ImVec2 clip_rect_min = check_imvec2(L, 1);
+    ImVec2 clip_rect_max = check_imvec2(L, 2);
+    bool intersect_with_current_clip_rect = lua_toboolean(L, 3);
+    igPushClipRect(clip_rect_min, clip_rect_max, intersect_with_current_clip_rect);
+    return 0;
+}
+
+static int cimgui_gen_PopClipRect(lua_State *L)
+{
+    (void)L;
+    igPopClipRect();
+    return 0;
+}
+
+static int cimgui_gen_SetItemDefaultFocus(lua_State *L)
+{
+    (void)L;
+    igSetItemDefaultFocus();
+    return 0;
+}
+
+static int cimgui_gen_SetKeyboardFocusHere(lua_State *L)
+{
+    (void)L;
+    igSetKeyboardFocusHere();
+    return 0;
+}
+
+static int cimgui_gen_SetKeyboardFocusHereEx(lua_State *L)
+{
+    int offset = (int)luaL_optinteger(L, 1, 0);
+    igSetKeyboardFocusHereEx(offset);
+    return 0;
+}
+
+static int cimgui_gen_SetNavCursorVisible(lua_State *L)
+{
+    bool visible = lua_toboolean(L, 1);
+    igSetNavCursorVisible(visible);
+    return 0;
+}
+
+static int cimgui_gen_SetNextItemAllowOverlap(lua_State *L)
+{
+    (void)L;
+    igSetNextItemAllowOverlap();
+    return 0;
+}
+
+static int cimgui_gen_IsItemHovered(lua_State *L)
+{
+    ImGuiHoveredFlags flags = (ImGuiHoveredFlags)luaL_optinteger(L, 1, 0);
+    bool ret = igIsItemHovered(flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemActive(lua_State *L)
+{
+    bool ret = igIsItemActive();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemFocused(lua_State *L)
+{
+    bool ret = igIsItemFocused();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemClicked(lua_State *L)
+{
+    bool ret = igIsItemClicked();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemClickedEx(lua_State *L)
+{
+    ImGuiMouseButton mouse_button = (ImGuiMouseButton)luaL_optinteger(L, 1, 0);
+    bool ret = igIsItemClickedEx(mouse_button);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemVisible(lua_State *L)
+{
+    bool ret = igIsItemVisible();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemEdited(lua_State *L)
+{
+    bool ret = igIsItemEdited();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemActivated(lua_State *L)
+{
+    bool ret = igIsItemActivated();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemDeactivated(lua_State *L)
+{
+    bool ret = igIsItemDeactivated();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemDeactivatedAfterEdit(lua_State *L)
+{
+    bool ret = igIsItemDeactivatedAfterEdit();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsItemToggledOpen(lua_State *L)
+{
+    bool ret = igIsItemToggledOpen();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsAnyItemHovered(lua_State *L)
+{
+    bool ret = igIsAnyItemHovered();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsAnyItemActive(lua_State *L)
+{
+    bool ret = igIsAnyItemActive();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsAnyItemFocused(lua_State *L)
+{
+    bool ret = igIsAnyItemFocused();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetItemID(lua_State *L)
+{
+    ImGuiID ret = igGetItemID();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetItemRectMin(lua_State *L)
+{
+    ImVec2 ret = igGetItemRectMin();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetItemRectMax(lua_State *L)
+{
+    ImVec2 ret = igGetItemRectMax();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetItemRectSize(lua_State *L)
+{
+    ImVec2 ret = igGetItemRectSize();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_IsRectVisibleBySize(lua_State *L)
+{
+    ImVec2 size = check_imvec2(L, 1);
+    bool ret = igIsRectVisibleBySize(size);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsRectVisible(lua_State *L)
+{
+    ImVec2 rect_min = check_imvec2(L, 1);
+    ImVec2 rect_max = check_imvec2(L, 2);
+    bool ret = igIsRectVisible(rect_min, rect_max);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetTime(lua_State *L)
+{
+    double ret = igGetTime();
+    lua_pushnumber(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetFrameCount(lua_State *L)
+{
+    int ret = igGetFrameCount();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetStyleColorName(lua_State *L)
+{
+    ImGuiCol idx = (ImGuiCol)luaL_checkinteger(L, 1);
+    const char* ret = igGetStyleColorName(idx);
+    lua_pushstring(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_CalcTextSize(lua_State *L)
+{
+    const char* text = luaL_checkstring(L, 1);
+    ImVec2 ret = igCalcTextSize(text);
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_CalcTextSizeEx(lua_State *L)
+{
+    const char* text = luaL_checkstring(L, 1);
+    bool hide_text_after_double_hash = lua_isnoneornil(L, 2) ? false : lua_toboolean(L, 2);
+    float wrap_width = (float)luaL_optnumber(L, 3, -1.0f);
+    ImVec2 ret = igCalcTextSizeEx(text, NULL, hide_text_after_double_hash, wrap_width);
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_ColorConvertU32ToFloat4(lua_State *L)
+{
+    ImU32 in = (ImU32)luaL_checkinteger(L, 1);
+    ImVec4 ret = igColorConvertU32ToFloat4(in);
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    lua_pushnumber(L, ret.z);
+    lua_pushnumber(L, ret.w);
+    return 4;
+}
+
+static int cimgui_gen_ColorConvertFloat4ToU32(lua_State *L)
+{
+    ImVec4 in = check_imvec4(L, 1);
+    ImU32 ret = igColorConvertFloat4ToU32(in);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_ColorConvertRGBtoHSV(lua_State *L)
+{
+    float r = (float)luaL_checknumber(L, 1);
+    float g = (float)luaL_checknumber(L, 2);
+    float b = (float)luaL_checknumber(L, 3);
+    float out_h_v = (float)luaL_optnumber(L, 4, 0);
+    float out_s_v = (float)luaL_optnumber(L, 5, 0);
+    float out_v_v = (float)luaL_optnumber(L, 6, 0);
+    igColorConvertRGBtoHSV(r, g, b, &out_h_v, &out_s_v, &out_v_v);
+    lua_pushnumber(L, out_h_v);
+    lua_pushnumber(L, out_s_v);
+    lua_pushnumber(L, out_v_v);
+    return 3;
+}
+
+static int cimgui_gen_ColorConvertHSVtoRGB(lua_State *L)
+{
+    float h = (float)luaL_checknumber(L, 1);
+    float s = (float)luaL_checknumber(L, 2);
+    float v = (float)luaL_checknumber(L, 3);
+    float out_r_v = (float)luaL_optnumber(L, 4, 0);
+    float out_g_v = (float)luaL_optnumber(L, 5, 0);
+    float out_b_v = (float)luaL_optnumber(L, 6, 0);
+    igColorConvertHSVtoRGB(h, s, v, &out_r_v, &out_g_v, &out_b_v);
+    lua_pushnumber(L, out_r_v);
+    lua_pushnumber(L, out_g_v);
+    lua_pushnumber(L, out_b_v);
+    return 3;
+}
+
+static int cimgui_gen_IsKeyDown(lua_State *L)
+{
+    ImGuiKey key = (ImGuiKey)luaL_checkinteger(L, 1);
+    bool ret = igIsKeyDown(key);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsKeyPressed(lua_State *L)
+{
+    ImGuiKey key = (ImGuiKey)luaL_checkinteger(L, 1);
+    bool ret = igIsKeyPressed(key);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsKeyPressedEx(lua_State *L)
+{
+    ImGuiKey key = (ImGuiKey)luaL_checkinteger(L, 1);
+    bool repeat = lua_isnoneornil(L, 2) ? true : lua_toboolean(L, 2);
+    bool ret = igIsKeyPressedEx(key, repeat);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsKeyReleased(lua_State *L)
+{
+    ImGuiKey key = (ImGuiKey)luaL_checkinteger(L, 1);
+    bool ret = igIsKeyReleased(key);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsKeyChordPressed(lua_State *L)
+{
+    ImGuiKeyChord key_chord = (ImGuiKeyChord)luaL_checkinteger(L, 1);
+    bool ret = igIsKeyChordPressed(key_chord);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetKeyPressedAmount(lua_State *L)
+{
+    ImGuiKey key = (ImGuiKey)luaL_checkinteger(L, 1);
+    float repeat_delay = (float)luaL_checknumber(L, 2);
+    float rate = (float)luaL_checknumber(L, 3);
+    int ret = igGetKeyPressedAmount(key, repeat_delay, rate);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_GetKeyName(lua_State *L)
+{
+    ImGuiKey key = (ImGuiKey)luaL_checkinteger(L, 1);
+    const char* ret = igGetKeyName(key);
+    lua_pushstring(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetNextFrameWantCaptureKeyboard(lua_State *L)
+{
+    bool want_capture_keyboard = lua_toboolean(L, 1);
+    igSetNextFrameWantCaptureKeyboard(want_capture_keyboard);
+    return 0;
+}
+
+static int cimgui_gen_Shortcut(lua_State *L)
+{
+    ImGuiKeyChord key_chord = (ImGuiKeyChord)luaL_checkinteger(L, 1);
+    ImGuiInputFlags flags = (ImGuiInputFlags)luaL_optinteger(L, 2, 0);
+    bool ret = igShortcut(key_chord, flags);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetNextItemShortcut(lua_State *L)
+{
+    ImGuiKeyChord key_chord = (ImGuiKeyChord)luaL_checkinteger(L, 1);
+    ImGuiInputFlags flags = (ImGuiInputFlags)luaL_optinteger(L, 2, 0);
+    igSetNextItemShortcut(key_chord, flags);
+    return 0;
+}
+
+static int cimgui_gen_SetItemKeyOwner(lua_State *L)
+{
+    ImGuiKey key = (ImGuiKey)luaL_checkinteger(L, 1);
+    igSetItemKeyOwner(key);
+    return 0;
+}
+
+static int cimgui_gen_IsMouseDown(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    bool ret = igIsMouseDown(button);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsMouseClicked(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    bool ret = igIsMouseClicked(button);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsMouseClickedEx(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    bool repeat = lua_isnoneornil(L, 2) ? false : lua_toboolean(L, 2);
+    bool ret = igIsMouseClickedEx(button, repeat);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsMouseReleased(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    bool ret = igIsMouseReleased(button);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsMouseDoubleClicked(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    bool ret = igIsMouseDoubleClicked(button);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsMouseReleasedWithDelay(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    float delay = (float)luaL_checknumber(L, 2);
+    bool ret = igIsMouseReleasedWithDelay(button, delay);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetMouseClickedCount(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    int ret = igGetMouseClickedCount(button);
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_IsMouseHoveringRect(lua_State *L)
+{
+    ImVec2 r_min = check_imvec2(L, 1);
+    ImVec2 r_max = check_imvec2(L, 2);
+    bool ret = igIsMouseHoveringRect(r_min, r_max);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsMouseHoveringRectEx(lua_State *L)
+{
+    ImVec2 r_min = check_imvec2(L, 1);
+    ImVec2 r_max = check_imvec2(L, 2);
+    bool clip = lua_isnoneornil(L, 3) ? true : lua_toboolean(L, 3);
+    bool ret = igIsMouseHoveringRectEx(r_min, r_max, clip);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_IsAnyMouseDown(lua_State *L)
+{
+    bool ret = igIsAnyMouseDown();
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetMousePos(lua_State *L)
+{
+    ImVec2 ret = igGetMousePos();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_GetMousePosOnOpeningCurrentPopup(lua_State *L)
+{
+    ImVec2 ret = igGetMousePosOnOpeningCurrentPopup();
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_IsMouseDragging(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_checkinteger(L, 1);
+    float lock_threshold = (float)luaL_optnumber(L, 2, -1.0f);
+    bool ret = igIsMouseDragging(button, lock_threshold);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_GetMouseDragDelta(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_optinteger(L, 1, 0);
+    float lock_threshold = (float)luaL_optnumber(L, 2, -1.0f);
+    ImVec2 ret = igGetMouseDragDelta(button, lock_threshold);
+    lua_pushnumber(L, ret.x);
+    lua_pushnumber(L, ret.y);
+    return 2;
+}
+
+static int cimgui_gen_ResetMouseDragDelta(lua_State *L)
+{
+    (void)L;
+    igResetMouseDragDelta();
+    return 0;
+}
+
+static int cimgui_gen_ResetMouseDragDeltaEx(lua_State *L)
+{
+    ImGuiMouseButton button = (ImGuiMouseButton)luaL_optinteger(L, 1, 0);
+    igResetMouseDragDeltaEx(button);
+    return 0;
+}
+
+static int cimgui_gen_GetMouseCursor(lua_State *L)
+{
+    ImGuiMouseCursor ret = igGetMouseCursor();
+    lua_pushinteger(L, (lua_Integer)ret);
+    return 1;
+}
+
+static int cimgui_gen_SetMouseCursor(lua_State *L)
+{
+    ImGuiMouseCursor cursor_type = (ImGuiMouseCursor)luaL_checkinteger(L, 1);
+    igSetMouseCursor(cursor_type);
+    return 0;
+}
+
+static int cimgui_gen_SetNextFrameWantCaptureMouse(lua_State *L)
+{
+    bool want_capture_mouse = lua_toboolean(L, 1);
+    igSetNextFrameWantCaptureMouse(want_capture_mouse);
+    return 0;
+}
+
+static int cimgui_gen_GetClipboardText(lua_State *L)
+{
+    const char* ret = igGetClipboardText();
+    lua_pushstring(L, ret);
+    return 1;
+}
+
+static int cimgui_gen_SetClipboardText(lua_State *L)
+{
+    const char* text = luaL_checkstring(L, 1);
+    igSetClipboardText(text);
+    return 0;
+}
+
+static int cimgui_gen_LoadIniSettingsFromDisk(lua_State *L)
+{
+    const char* ini_filename = luaL_checkstring(L, 1);
+    igLoadIniSettingsFromDisk(ini_filename);
+    return 0;
+}
+
+static int cimgui_gen_LoadIniSettingsFromMemory(lua_State *L)
+{
+    const char* ini_data = luaL_checkstring(L, 1);
+    size_t ini_size = (size_t)luaL_optinteger(L, 2, 0);
+    igLoadIniSettingsFromMemory(ini_data, ini_size);
+    return 0;
+}
+
+static int cimgui_gen_SaveIniSettingsToDisk(lua_State *L)
+{
+    const char* ini_filename = luaL_checkstring(L, 1);
+    igSaveIniSettingsToDisk(ini_filename);
+    return 0;
+}
+
+static int cimgui_gen_SaveIniSettingsToMemory(lua_State *L)
+{
+    size_t out_ini_size_v = (size_t)luaL_optinteger(L, 1, 0);
+    bool out_ini_size_set = !lua_isnoneornil(L, 1);
+    const char* ret = igSaveIniSettingsToMemory(out_ini_size_set ? &out_ini_size_v : NULL);
+    lua_pushstring(L, ret);
+    if (out_ini_size_set) lua_pushinteger(L, (lua_Integer)out_ini_size_v); else lua_pushnil(L);
+    return 2;
+}
+
+static int cimgui_gen_DebugTextEncoding(lua_State *L)
+{
+    const char* text = luaL_checkstring(L, 1);
+    igDebugTextEncoding(text);
+    return 0;
+}
+
+static int cimgui_gen_DebugFlashStyleColor(lua_State *L)
+{
+    ImGuiCol idx = (ImGuiCol)luaL_checkinteger(L, 1);
+    igDebugFlashStyleColor(idx);
+    return 0;
+}
+
+static int cimgui_gen_DebugStartItemPicker(lua_State *L)
+{
+    (void)L;
+    igDebugStartItemPicker();
+    return 0;
+}
+
+static int cimgui_gen_DebugCheckVersionAndDataLayout(lua_State *L)
+{
+    const char* version_str = luaL_checkstring(L, 1);
+    size_t sz_io = (size_t)luaL_checkinteger(L, 2);
+    size_t sz_style = (size_t)luaL_checkinteger(L, 3);
+    size_t sz_vec2 = (size_t)luaL_checkinteger(L, 4);
+    size_t sz_vec4 = (size_t)luaL_checkinteger(L, 5);
+    size_t sz_drawvert = (size_t)luaL_checkinteger(L, 6);
+    size_t sz_drawidx = (size_t)luaL_checkinteger(L, 7);
+    bool ret = igDebugCheckVersionAndDataLayout(version_str, sz_io, sz_style, sz_vec2, sz_vec4, sz_drawvert, sz_drawidx);
+    lua_pushboolean(L, ret);
+    return 1;
+}
+
+static const luaL_Reg cimgui_gen_funcs[] = {
+    { "ShowDemoWindow", cimgui_gen_ShowDemoWindow },
+    { "ShowMetricsWindow", cimgui_gen_ShowMetricsWindow },
+    { "ShowDebugLogWindow", cimgui_gen_ShowDebugLogWindow },
+    { "ShowIDStackToolWindow", cimgui_gen_ShowIDStackToolWindow },
+    { "ShowIDStackToolWindowEx", cimgui_gen_ShowIDStackToolWindowEx },
+    { "ShowAboutWindow", cimgui_gen_ShowAboutWindow },
+    { "ShowStyleSelector", cimgui_gen_ShowStyleSelector },
+    { "ShowFontSelector", cimgui_gen_ShowFontSelector },
+    { "ShowUserGuide", cimgui_gen_ShowUserGuide },
+    { "GetVersion", cimgui_gen_GetVersion },
+    { "Begin", cimgui_gen_Begin },
+    { "End", cimgui_gen_End },
+    { "BeginChild", cimgui_gen_BeginChild },
+    { "BeginChildID", cimgui_gen_BeginChildID },
+    { "EndChild", cimgui_gen_EndChild },
+    { "IsWindowAppearing", cimgui_gen_IsWindowAppearing },
+    { "IsWindowCollapsed", cimgui_gen_IsWindowCollapsed },
+    { "IsWindowFocused", cimgui_gen_IsWindowFocused },
+    { "IsWindowHovered", cimgui_gen_IsWindowHovered },
+    { "GetWindowPos", cimgui_gen_GetWindowPos },
+    { "GetWindowSize", cimgui_gen_GetWindowSize },
+    { "GetWindowWidth", cimgui_gen_GetWindowWidth },
+    { "GetWindowHeight", cimgui_gen_GetWindowHeight },
+    { "SetNextWindowPos", cimgui_gen_SetNextWindowPos },
+    { "SetNextWindowPosEx", cimgui_gen_SetNextWindowPosEx },
+    { "SetNextWindowSize", cimgui_gen_SetNextWindowSize },
+    { "SetNextWindowContentSize", cimgui_gen_SetNextWindowContentSize },
+    { "SetNextWindowCollapsed", cimgui_gen_SetNextWindowCollapsed },
+    { "SetNextWindowFocus", cimgui_gen_SetNextWindowFocus },
+    { "SetNextWindowScroll", cimgui_gen_SetNextWindowScroll },
+    { "SetNextWindowBgAlpha", cimgui_gen_SetNextWindowBgAlpha },
+    { "SetWindowPos", cimgui_gen_SetWindowPos },
+    { "SetWindowSize", cimgui_gen_SetWindowSize },
+    { "SetWindowCollapsed", cimgui_gen_SetWindowCollapsed },
+    { "SetWindowFocus", cimgui_gen_SetWindowFocus },
+    { "SetWindowPosStr", cimgui_gen_SetWindowPosStr },
+    { "SetWindowSizeStr", cimgui_gen_SetWindowSizeStr },
+    { "SetWindowCollapsedStr", cimgui_gen_SetWindowCollapsedStr },
+    { "SetWindowFocusStr", cimgui_gen_SetWindowFocusStr },
+    { "GetScrollX", cimgui_gen_GetScrollX },
+    { "GetScrollY", cimgui_gen_GetScrollY },
+    { "SetScrollX", cimgui_gen_SetScrollX },
+    { "SetScrollY", cimgui_gen_SetScrollY },
+    { "GetScrollMaxX", cimgui_gen_GetScrollMaxX },
+    { "GetScrollMaxY", cimgui_gen_GetScrollMaxY },
+    { "SetScrollHereX", cimgui_gen_SetScrollHereX },
+    { "SetScrollHereY", cimgui_gen_SetScrollHereY },
+    { "SetScrollFromPosX", cimgui_gen_SetScrollFromPosX },
+    { "SetScrollFromPosY", cimgui_gen_SetScrollFromPosY },
+    { "PopFont", cimgui_gen_PopFont },
+    { "GetFontSize", cimgui_gen_GetFontSize },
+    { "PushStyleColor", cimgui_gen_PushStyleColor },
+    { "PushStyleColorImVec4", cimgui_gen_PushStyleColorImVec4 },
+    { "PopStyleColor", cimgui_gen_PopStyleColor },
+    { "PopStyleColorEx", cimgui_gen_PopStyleColorEx },
+    { "PushStyleVar", cimgui_gen_PushStyleVar },
+    { "PushStyleVarImVec2", cimgui_gen_PushStyleVarImVec2 },
+    { "PushStyleVarX", cimgui_gen_PushStyleVarX },
+    { "PushStyleVarY", cimgui_gen_PushStyleVarY },
+    { "PopStyleVar", cimgui_gen_PopStyleVar },
+    { "PopStyleVarEx", cimgui_gen_PopStyleVarEx },
+    { "PushItemFlag", cimgui_gen_PushItemFlag },
+    { "PopItemFlag", cimgui_gen_PopItemFlag },
+    { "PushItemWidth", cimgui_gen_PushItemWidth },
+    { "PopItemWidth", cimgui_gen_PopItemWidth },
+    { "SetNextItemWidth", cimgui_gen_SetNextItemWidth },
+    { "CalcItemWidth", cimgui_gen_CalcItemWidth },
+    { "PushTextWrapPos", cimgui_gen_PushTextWrapPos },
+    { "PopTextWrapPos", cimgui_gen_PopTextWrapPos },
+    { "GetFontTexUvWhitePixel", cimgui_gen_GetFontTexUvWhitePixel },
+    { "GetColorU32", cimgui_gen_GetColorU32 },
+    { "GetColorU32Ex", cimgui_gen_GetColorU32Ex },
+    { "GetColorU32ImVec4", cimgui_gen_GetColorU32ImVec4 },
+    { "GetColorU32ImU32", cimgui_gen_GetColorU32ImU32 },
+    { "GetColorU32ImU32Ex", cimgui_gen_GetColorU32ImU32Ex },
+    { "GetCursorScreenPos", cimgui_gen_GetCursorScreenPos },
+    { "SetCursorScreenPos", cimgui_gen_SetCursorScreenPos },
+    { "GetContentRegionAvail", cimgui_gen_GetContentRegionAvail },
+    { "GetCursorPos", cimgui_gen_GetCursorPos },
+    { "GetCursorPosX", cimgui_gen_GetCursorPosX },
+    { "GetCursorPosY", cimgui_gen_GetCursorPosY },
+    { "SetCursorPos", cimgui_gen_SetCursorPos },
+    { "SetCursorPosX", cimgui_gen_SetCursorPosX },
+    { "SetCursorPosY", cimgui_gen_SetCursorPosY },
+    { "GetCursorStartPos", cimgui_gen_GetCursorStartPos },
+    { "Separator", cimgui_gen_Separator },
+    { "SameLine", cimgui_gen_SameLine },
+    { "SameLineEx", cimgui_gen_SameLineEx },
+    { "NewLine", cimgui_gen_NewLine },
+    { "Spacing", cimgui_gen_Spacing },
+    { "Dummy", cimgui_gen_Dummy },
+    { "Indent", cimgui_gen_Indent },
+    { "IndentEx", cimgui_gen_IndentEx },
+    { "Unindent", cimgui_gen_Unindent },
+    { "UnindentEx", cimgui_gen_UnindentEx },
+    { "BeginGroup", cimgui_gen_BeginGroup },
+    { "EndGroup", cimgui_gen_EndGroup },
+    { "AlignTextToFramePadding", cimgui_gen_AlignTextToFramePadding },
+    { "GetTextLineHeight", cimgui_gen_GetTextLineHeight },
+    { "GetTextLineHeightWithSpacing", cimgui_gen_GetTextLineHeightWithSpacing },
+    { "GetFrameHeight", cimgui_gen_GetFrameHeight },
+    { "GetFrameHeightWithSpacing", cimgui_gen_GetFrameHeightWithSpacing },
+    { "PushID", cimgui_gen_PushID },
+    { "PushIDStr", cimgui_gen_PushIDStr },
+    { "PushIDInt", cimgui_gen_PushIDInt },
+    { "PopID", cimgui_gen_PopID },
+    { "GetID", cimgui_gen_GetID },
+    { "GetIDStr", cimgui_gen_GetIDStr },
+    { "GetIDInt", cimgui_gen_GetIDInt },
+    { "TextUnformatted", cimgui_gen_TextUnformatted },
+    { "TextUnformattedEx", cimgui_gen_TextUnformattedEx },
+    { "Text", cimgui_gen_Text },
+    { "TextColored", cimgui_gen_TextColored },
+    { "TextDisabled", cimgui_gen_TextDisabled },
+    { "TextWrapped", cimgui_gen_TextWrapped },
+    { "LabelText", cimgui_gen_LabelText },
+    { "BulletText", cimgui_gen_BulletText },
+    { "SeparatorText", cimgui_gen_SeparatorText },
+    { "Button", cimgui_gen_Button },
+    { "ButtonEx", cimgui_gen_ButtonEx },
+    { "SmallButton", cimgui_gen_SmallButton },
+    { "InvisibleButton", cimgui_gen_InvisibleButton },
+    { "ArrowButton", cimgui_gen_ArrowButton },
+    { "Checkbox", cimgui_gen_Checkbox },
+    { "CheckboxFlagsIntPtr", cimgui_gen_CheckboxFlagsIntPtr },
+    { "CheckboxFlagsUintPtr", cimgui_gen_CheckboxFlagsUintPtr },
+    { "RadioButton", cimgui_gen_RadioButton },
+    { "RadioButtonIntPtr", cimgui_gen_RadioButtonIntPtr },
+    { "ProgressBar", cimgui_gen_ProgressBar },
+    { "Bullet", cimgui_gen_Bullet },
+    { "TextLink", cimgui_gen_TextLink },
+    { "TextLinkOpenURL", cimgui_gen_TextLinkOpenURL },
+    { "TextLinkOpenURLEx", cimgui_gen_TextLinkOpenURLEx },
+    { "BeginCombo", cimgui_gen_BeginCombo },
+    { "EndCombo", cimgui_gen_EndCombo },
+    { "Combo", cimgui_gen_Combo },
+    { "ComboEx", cimgui_gen_ComboEx },
+    { "DragFloat", cimgui_gen_DragFloat },
+    { "DragFloatEx", cimgui_gen_DragFloatEx },
+    { "DragFloat2", cimgui_gen_DragFloat2 },
+    { "DragFloat2Ex", cimgui_gen_DragFloat2Ex },
+    { "DragFloat3", cimgui_gen_DragFloat3 },
+    { "DragFloat3Ex", cimgui_gen_DragFloat3Ex },
+    { "DragFloat4", cimgui_gen_DragFloat4 },
+    { "DragFloat4Ex", cimgui_gen_DragFloat4Ex },
+    { "DragFloatRange2", cimgui_gen_DragFloatRange2 },
+    { "DragFloatRange2Ex", cimgui_gen_DragFloatRange2Ex },
+    { "DragInt", cimgui_gen_DragInt },
+    { "DragIntEx", cimgui_gen_DragIntEx },
+    { "DragInt2", cimgui_gen_DragInt2 },
+    { "DragInt2Ex", cimgui_gen_DragInt2Ex },
+    { "DragInt3", cimgui_gen_DragInt3 },
+    { "DragInt3Ex", cimgui_gen_DragInt3Ex },
+    { "DragInt4", cimgui_gen_DragInt4 },
+    { "DragInt4Ex", cimgui_gen_DragInt4Ex },
+    { "DragIntRange2", cimgui_gen_DragIntRange2 },
+    { "DragIntRange2Ex", cimgui_gen_DragIntRange2Ex },
+    { "SliderFloat", cimgui_gen_SliderFloat },
+    { "SliderFloatEx", cimgui_gen_SliderFloatEx },
+    { "SliderFloat2", cimgui_gen_SliderFloat2 },
+    { "SliderFloat2Ex", cimgui_gen_SliderFloat2Ex },
+    { "SliderFloat3", cimgui_gen_SliderFloat3 },
+    { "SliderFloat3Ex", cimgui_gen_SliderFloat3Ex },
+    { "SliderFloat4", cimgui_gen_SliderFloat4 },
+    { "SliderFloat4Ex", cimgui_gen_SliderFloat4Ex },
+    { "SliderAngle", cimgui_gen_SliderAngle },
+    { "SliderAngleEx", cimgui_gen_SliderAngleEx },
+    { "SliderInt", cimgui_gen_SliderInt },
+    { "SliderIntEx", cimgui_gen_SliderIntEx },
+    { "SliderInt2", cimgui_gen_SliderInt2 },
+    { "SliderInt2Ex", cimgui_gen_SliderInt2Ex },
+    { "SliderInt3", cimgui_gen_SliderInt3 },
+    { "SliderInt3Ex", cimgui_gen_SliderInt3Ex },
+    { "SliderInt4", cimgui_gen_SliderInt4 },
+    { "SliderInt4Ex", cimgui_gen_SliderInt4Ex },
+    { "VSliderFloat", cimgui_gen_VSliderFloat },
+    { "VSliderFloatEx", cimgui_gen_VSliderFloatEx },
+    { "VSliderInt", cimgui_gen_VSliderInt },
+    { "VSliderIntEx", cimgui_gen_VSliderIntEx },
+    { "InputText", cimgui_gen_InputText },
+    { "InputTextMultiline", cimgui_gen_InputTextMultiline },
+    { "InputTextWithHint", cimgui_gen_InputTextWithHint },
+    { "InputFloat", cimgui_gen_InputFloat },
+    { "InputFloatEx", cimgui_gen_InputFloatEx },
+    { "InputFloat2", cimgui_gen_InputFloat2 },
+    { "InputFloat2Ex", cimgui_gen_InputFloat2Ex },
+    { "InputFloat3", cimgui_gen_InputFloat3 },
+    { "InputFloat3Ex", cimgui_gen_InputFloat3Ex },
+    { "InputFloat4", cimgui_gen_InputFloat4 },
+    { "InputFloat4Ex", cimgui_gen_InputFloat4Ex },
+    { "InputInt", cimgui_gen_InputInt },
+    { "InputIntEx", cimgui_gen_InputIntEx },
+    { "InputInt2", cimgui_gen_InputInt2 },
+    { "InputInt3", cimgui_gen_InputInt3 },
+    { "InputInt4", cimgui_gen_InputInt4 },
+    { "InputDouble", cimgui_gen_InputDouble },
+    { "InputDoubleEx", cimgui_gen_InputDoubleEx },
+    { "ColorEdit3", cimgui_gen_ColorEdit3 },
+    { "ColorEdit4", cimgui_gen_ColorEdit4 },
+    { "ColorPicker3", cimgui_gen_ColorPicker3 },
+    { "ColorButton", cimgui_gen_ColorButton },
+    { "ColorButtonEx", cimgui_gen_ColorButtonEx },
+    { "SetColorEditOptions", cimgui_gen_SetColorEditOptions },
+    { "TreeNode", cimgui_gen_TreeNode },
+    { "TreeNodeStr", cimgui_gen_TreeNodeStr },
+    { "TreeNodeEx", cimgui_gen_TreeNodeEx },
+    { "TreeNodeExStr", cimgui_gen_TreeNodeExStr },
+    { "TreePush", cimgui_gen_TreePush },
+    { "TreePop", cimgui_gen_TreePop },
+    { "GetTreeNodeToLabelSpacing", cimgui_gen_GetTreeNodeToLabelSpacing },
+    { "CollapsingHeader", cimgui_gen_CollapsingHeader },
+    { "CollapsingHeaderBoolPtr", cimgui_gen_CollapsingHeaderBoolPtr },
+    { "SetNextItemOpen", cimgui_gen_SetNextItemOpen },
+    { "SetNextItemStorageID", cimgui_gen_SetNextItemStorageID },
+    { "Selectable", cimgui_gen_Selectable },
+    { "SelectableEx", cimgui_gen_SelectableEx },
+    { "SelectableBoolPtr", cimgui_gen_SelectableBoolPtr },
+    { "SelectableBoolPtrEx", cimgui_gen_SelectableBoolPtrEx },
+    { "IsItemToggledSelection", cimgui_gen_IsItemToggledSelection },
+    { "BeginListBox", cimgui_gen_BeginListBox },
+    { "EndListBox", cimgui_gen_EndListBox },
+    { "BeginMenuBar", cimgui_gen_BeginMenuBar },
+    { "EndMenuBar", cimgui_gen_EndMenuBar },
+    { "BeginMainMenuBar", cimgui_gen_BeginMainMenuBar },
+    { "EndMainMenuBar", cimgui_gen_EndMainMenuBar },
+    { "BeginMenu", cimgui_gen_BeginMenu },
+    { "BeginMenuEx", cimgui_gen_BeginMenuEx },
+    { "EndMenu", cimgui_gen_EndMenu },
+    { "MenuItem", cimgui_gen_MenuItem },
+    { "MenuItemEx", cimgui_gen_MenuItemEx },
+    { "MenuItemBoolPtr", cimgui_gen_MenuItemBoolPtr },
+    { "BeginTooltip", cimgui_gen_BeginTooltip },
+    { "EndTooltip", cimgui_gen_EndTooltip },
+    { "SetTooltip", cimgui_gen_SetTooltip },
+    { "BeginItemTooltip", cimgui_gen_BeginItemTooltip },
+    { "SetItemTooltip", cimgui_gen_SetItemTooltip },
+    { "BeginPopup", cimgui_gen_BeginPopup },
+    { "BeginPopupModal", cimgui_gen_BeginPopupModal },
+    { "EndPopup", cimgui_gen_EndPopup },
+    { "OpenPopup", cimgui_gen_OpenPopup },
+    { "OpenPopupID", cimgui_gen_OpenPopupID },
+    { "OpenPopupOnItemClick", cimgui_gen_OpenPopupOnItemClick },
+    { "CloseCurrentPopup", cimgui_gen_CloseCurrentPopup },
+    { "BeginPopupContextItem", cimgui_gen_BeginPopupContextItem },
+    { "BeginPopupContextItemEx", cimgui_gen_BeginPopupContextItemEx },
+    { "BeginPopupContextWindow", cimgui_gen_BeginPopupContextWindow },
+    { "BeginPopupContextWindowEx", cimgui_gen_BeginPopupContextWindowEx },
+    { "BeginPopupContextVoid", cimgui_gen_BeginPopupContextVoid },
+    { "BeginPopupContextVoidEx", cimgui_gen_BeginPopupContextVoidEx },
+    { "IsPopupOpen", cimgui_gen_IsPopupOpen },
+    { "BeginTable", cimgui_gen_BeginTable },
+    { "BeginTableEx", cimgui_gen_BeginTableEx },
+    { "EndTable", cimgui_gen_EndTable },
+    { "TableNextRow", cimgui_gen_TableNextRow },
+    { "TableNextRowEx", cimgui_gen_TableNextRowEx },
+    { "TableNextColumn", cimgui_gen_TableNextColumn },
+    { "TableSetColumnIndex", cimgui_gen_TableSetColumnIndex },
+    { "TableSetupColumn", cimgui_gen_TableSetupColumn },
+    { "TableSetupColumnEx", cimgui_gen_TableSetupColumnEx },
+    { "TableSetupScrollFreeze", cimgui_gen_TableSetupScrollFreeze },
+    { "TableHeader", cimgui_gen_TableHeader },
+    { "TableHeadersRow", cimgui_gen_TableHeadersRow },
+    { "TableAngledHeadersRow", cimgui_gen_TableAngledHeadersRow },
+    { "TableGetColumnCount", cimgui_gen_TableGetColumnCount },
+    { "TableGetColumnIndex", cimgui_gen_TableGetColumnIndex },
+    { "TableGetRowIndex", cimgui_gen_TableGetRowIndex },
+    { "TableGetColumnName", cimgui_gen_TableGetColumnName },
+    { "TableGetColumnFlags", cimgui_gen_TableGetColumnFlags },
+    { "TableSetColumnEnabled", cimgui_gen_TableSetColumnEnabled },
+    { "TableGetHoveredColumn", cimgui_gen_TableGetHoveredColumn },
+    { "TableSetBgColor", cimgui_gen_TableSetBgColor },
+    { "Columns", cimgui_gen_Columns },
+    { "ColumnsEx", cimgui_gen_ColumnsEx },
+    { "NextColumn", cimgui_gen_NextColumn },
+    { "GetColumnIndex", cimgui_gen_GetColumnIndex },
+    { "GetColumnWidth", cimgui_gen_GetColumnWidth },
+    { "SetColumnWidth", cimgui_gen_SetColumnWidth },
+    { "GetColumnOffset", cimgui_gen_GetColumnOffset },
+    { "SetColumnOffset", cimgui_gen_SetColumnOffset },
+    { "GetColumnsCount", cimgui_gen_GetColumnsCount },
+    { "BeginTabBar", cimgui_gen_BeginTabBar },
+    { "EndTabBar", cimgui_gen_EndTabBar },
+    { "BeginTabItem", cimgui_gen_BeginTabItem },
+    { "EndTabItem", cimgui_gen_EndTabItem },
+    { "TabItemButton", cimgui_gen_TabItemButton },
+    { "SetTabItemClosed", cimgui_gen_SetTabItemClosed },
+    { "LogToTTY", cimgui_gen_LogToTTY },
+    { "LogToFile", cimgui_gen_LogToFile },
+    { "LogToClipboard", cimgui_gen_LogToClipboard },
+    { "LogFinish", cimgui_gen_LogFinish },
+    { "LogButtons", cimgui_gen_LogButtons },
+    { "LogText", cimgui_gen_LogText },
+    { "BeginDragDropSource", cimgui_gen_BeginDragDropSource },
+    { "EndDragDropSource", cimgui_gen_EndDragDropSource },
+    { "BeginDragDropTarget", cimgui_gen_BeginDragDropTarget },
+    { "EndDragDropTarget", cimgui_gen_EndDragDropTarget },
+    { "BeginDisabled", cimgui_gen_BeginDisabled },
+    { "EndDisabled", cimgui_gen_EndDisabled },
+    { "PushClipRect", cimgui_gen_PushClipRect },
+    { "PopClipRect", cimgui_gen_PopClipRect },
+    { "SetItemDefaultFocus", cimgui_gen_SetItemDefaultFocus },
+    { "SetKeyboardFocusHere", cimgui_gen_SetKeyboardFocusHere },
+    { "SetKeyboardFocusHereEx", cimgui_gen_SetKeyboardFocusHereEx },
+    { "SetNavCursorVisible", cimgui_gen_SetNavCursorVisible },
+    { "SetNextItemAllowOverlap", cimgui_gen_SetNextItemAllowOverlap },
+    { "IsItemHovered", cimgui_gen_IsItemHovered },
+    { "IsItemActive", cimgui_gen_IsItemActive },
+    { "IsItemFocused", cimgui_gen_IsItemFocused },
+    { "IsItemClicked", cimgui_gen_IsItemClicked },
+    { "IsItemClickedEx", cimgui_gen_IsItemClickedEx },
+    { "IsItemVisible", cimgui_gen_IsItemVisible },
+    { "IsItemEdited", cimgui_gen_IsItemEdited },
+    { "IsItemActivated", cimgui_gen_IsItemActivated },
+    { "IsItemDeactivated", cimgui_gen_IsItemDeactivated },
+    { "IsItemDeactivatedAfterEdit", cimgui_gen_IsItemDeactivatedAfterEdit },
+    { "IsItemToggledOpen", cimgui_gen_IsItemToggledOpen },
+    { "IsAnyItemHovered", cimgui_gen_IsAnyItemHovered },
+    { "IsAnyItemActive", cimgui_gen_IsAnyItemActive },
+    { "IsAnyItemFocused", cimgui_gen_IsAnyItemFocused },
+    { "GetItemID", cimgui_gen_GetItemID },
+    { "GetItemRectMin", cimgui_gen_GetItemRectMin },
+    { "GetItemRectMax", cimgui_gen_GetItemRectMax },
+    { "GetItemRectSize", cimgui_gen_GetItemRectSize },
+    { "IsRectVisibleBySize", cimgui_gen_IsRectVisibleBySize },
+    { "IsRectVisible", cimgui_gen_IsRectVisible },
+    { "GetTime", cimgui_gen_GetTime },
+    { "GetFrameCount", cimgui_gen_GetFrameCount },
+    { "GetStyleColorName", cimgui_gen_GetStyleColorName },
+    { "CalcTextSize", cimgui_gen_CalcTextSize },
+    { "CalcTextSizeEx", cimgui_gen_CalcTextSizeEx },
+    { "ColorConvertU32ToFloat4", cimgui_gen_ColorConvertU32ToFloat4 },
+    { "ColorConvertFloat4ToU32", cimgui_gen_ColorConvertFloat4ToU32 },
+    { "ColorConvertRGBtoHSV", cimgui_gen_ColorConvertRGBtoHSV },
+    { "ColorConvertHSVtoRGB", cimgui_gen_ColorConvertHSVtoRGB },
+    { "IsKeyDown", cimgui_gen_IsKeyDown },
+    { "IsKeyPressed", cimgui_gen_IsKeyPressed },
+    { "IsKeyPressedEx", cimgui_gen_IsKeyPressedEx },
+    { "IsKeyReleased", cimgui_gen_IsKeyReleased },
+    { "IsKeyChordPressed", cimgui_gen_IsKeyChordPressed },
+    { "GetKeyPressedAmount", cimgui_gen_GetKeyPressedAmount },
+    { "GetKeyName", cimgui_gen_GetKeyName },
+    { "SetNextFrameWantCaptureKeyboard", cimgui_gen_SetNextFrameWantCaptureKeyboard },
+    { "Shortcut", cimgui_gen_Shortcut },
+    { "SetNextItemShortcut", cimgui_gen_SetNextItemShortcut },
+    { "SetItemKeyOwner", cimgui_gen_SetItemKeyOwner },
+    { "IsMouseDown", cimgui_gen_IsMouseDown },
+    { "IsMouseClicked", cimgui_gen_IsMouseClicked },
+    { "IsMouseClickedEx", cimgui_gen_IsMouseClickedEx },
+    { "IsMouseReleased", cimgui_gen_IsMouseReleased },
+    { "IsMouseDoubleClicked", cimgui_gen_IsMouseDoubleClicked },
+    { "IsMouseReleasedWithDelay", cimgui_gen_IsMouseReleasedWithDelay },
+    { "GetMouseClickedCount", cimgui_gen_GetMouseClickedCount },
+    { "IsMouseHoveringRect", cimgui_gen_IsMouseHoveringRect },
+    { "IsMouseHoveringRectEx", cimgui_gen_IsMouseHoveringRectEx },
+    { "IsAnyMouseDown", cimgui_gen_IsAnyMouseDown },
+    { "GetMousePos", cimgui_gen_GetMousePos },
+    { "GetMousePosOnOpeningCurrentPopup", cimgui_gen_GetMousePosOnOpeningCurrentPopup },
+    { "IsMouseDragging", cimgui_gen_IsMouseDragging },
+    { "GetMouseDragDelta", cimgui_gen_GetMouseDragDelta },
+    { "ResetMouseDragDelta", cimgui_gen_ResetMouseDragDelta },
+    { "ResetMouseDragDeltaEx", cimgui_gen_ResetMouseDragDeltaEx },
+    { "GetMouseCursor", cimgui_gen_GetMouseCursor },
+    { "SetMouseCursor", cimgui_gen_SetMouseCursor },
+    { "SetNextFrameWantCaptureMouse", cimgui_gen_SetNextFrameWantCaptureMouse },
+    { "GetClipboardText", cimgui_gen_GetClipboardText },
+    { "SetClipboardText", cimgui_gen_SetClipboardText },
+    { "LoadIniSettingsFromDisk", cimgui_gen_LoadIniSettingsFromDisk },
+    { "LoadIniSettingsFromMemory", cimgui_gen_LoadIniSettingsFromMemory },
+    { "SaveIniSettingsToDisk", cimgui_gen_SaveIniSettingsToDisk },
+    { "SaveIniSettingsToMemory", cimgui_gen_SaveIniSettingsToMemory },
+    { "DebugTextEncoding", cimgui_gen_DebugTextEncoding },
+    { "DebugFlashStyleColor", cimgui_gen_DebugFlashStyleColor },
+    { "DebugStartItemPicker", cimgui_gen_DebugStartItemPicker },
+    { "DebugCheckVersionAndDataLayout", cimgui_gen_DebugCheckVersionAndDataLayout },
+    { NULL, NULL }
+};
+
+static const struct { const char *name; lua_Integer value; } cimgui_gen_enums[] = {
+    { "WindowFlags_None", ImGuiWindowFlags_None },
+    { "WindowFlags_NoTitleBar", ImGuiWindowFlags_NoTitleBar },
+    { "WindowFlags_NoResize", ImGuiWindowFlags_NoResize },
+    { "WindowFlags_NoMove", ImGuiWindowFlags_NoMove },
+    { "WindowFlags_NoScrollbar", ImGuiWindowFlags_NoScrollbar },
+    { "WindowFlags_NoScrollWithMouse", ImGuiWindowFlags_NoScrollWithMouse },
+    { "WindowFlags_NoCollapse", ImGuiWindowFlags_NoCollapse },
+    { "WindowFlags_AlwaysAutoResize", ImGuiWindowFlags_AlwaysAutoResize },
+    { "WindowFlags_NoBackground", ImGuiWindowFlags_NoBackground },
+    { "WindowFlags_NoSavedSettings", ImGuiWindowFlags_NoSavedSettings },
+    { "WindowFlags_NoMouseInputs", ImGuiWindowFlags_NoMouseInputs },
+    { "WindowFlags_MenuBar", ImGuiWindowFlags_MenuBar },
+    { "WindowFlags_HorizontalScrollbar", ImGuiWindowFlags_HorizontalScrollbar },
+    { "WindowFlags_NoFocusOnAppearing", ImGuiWindowFlags_NoFocusOnAppearing },
+    { "WindowFlags_NoBringToFrontOnFocus", ImGuiWindowFlags_NoBringToFrontOnFocus },
+    { "WindowFlags_AlwaysVerticalScrollbar", ImGuiWindowFlags_AlwaysVerticalScrollbar },
+    { "WindowFlags_AlwaysHorizontalScrollbar", ImGuiWindowFlags_AlwaysHorizontalScrollbar },
+    { "WindowFlags_NoNavInputs", ImGuiWindowFlags_NoNavInputs },
+    { "WindowFlags_NoNavFocus", ImGuiWindowFlags_NoNavFocus },
+    { "WindowFlags_UnsavedDocument", ImGuiWindowFlags_UnsavedDocument },
+    { "WindowFlags_NoNav", ImGuiWindowFlags_NoNav },
+    { "WindowFlags_NoDecoration", ImGuiWindowFlags_NoDecoration },
+    { "WindowFlags_NoInputs", ImGuiWindowFlags_NoInputs },
+    { "WindowFlags_ChildWindow", ImGuiWindowFlags_ChildWindow },
+    { "WindowFlags_Tooltip", ImGuiWindowFlags_Tooltip },
+    { "WindowFlags_Popup", ImGuiWindowFlags_Popup },
+    { "WindowFlags_Modal", ImGuiWindowFlags_Modal },
+    { "WindowFlags_ChildMenu", ImGuiWindowFlags_ChildMenu },
+    { "ChildFlags_None", ImGuiChildFlags_None },
+    { "ChildFlags_Borders", ImGuiChildFlags_Borders },
+    { "ChildFlags_AlwaysUseWindowPadding", ImGuiChildFlags_AlwaysUseWindowPadding },
+    { "ChildFlags_ResizeX", ImGuiChildFlags_ResizeX },
+    { "ChildFlags_ResizeY", ImGuiChildFlags_ResizeY },
+    { "ChildFlags_AutoResizeX", ImGuiChildFlags_AutoResizeX },
+    { "ChildFlags_AutoResizeY", ImGuiChildFlags_AutoResizeY },
+    { "ChildFlags_AlwaysAutoResize", ImGuiChildFlags_AlwaysAutoResize },
+    { "ChildFlags_FrameStyle", ImGuiChildFlags_FrameStyle },
+    { "ChildFlags_NavFlattened", ImGuiChildFlags_NavFlattened },
+    { "ItemFlags_None", ImGuiItemFlags_None },
+    { "ItemFlags_NoTabStop", ImGuiItemFlags_NoTabStop },
+    { "ItemFlags_NoNav", ImGuiItemFlags_NoNav },
+    { "ItemFlags_NoNavDefaultFocus", ImGuiItemFlags_NoNavDefaultFocus },
+    { "ItemFlags_ButtonRepeat", ImGuiItemFlags_ButtonRepeat },
+    { "ItemFlags_AutoClosePopups", ImGuiItemFlags_AutoClosePopups },
+    { "ItemFlags_AllowDuplicateId", ImGuiItemFlags_AllowDuplicateId },
+    { "InputTextFlags_None", ImGuiInputTextFlags_None },
+    { "InputTextFlags_CharsDecimal", ImGuiInputTextFlags_CharsDecimal },
+    { "InputTextFlags_CharsHexadecimal", ImGuiInputTextFlags_CharsHexadecimal },
+    { "InputTextFlags_CharsScientific", ImGuiInputTextFlags_CharsScientific },
+    { "InputTextFlags_CharsUppercase", ImGuiInputTextFlags_CharsUppercase },
+    { "InputTextFlags_CharsNoBlank", ImGuiInputTextFlags_CharsNoBlank },
+    { "InputTextFlags_AllowTabInput", ImGuiInputTextFlags_AllowTabInput },
+    { "InputTextFlags_EnterReturnsTrue", ImGuiInputTextFlags_EnterReturnsTrue },
+    { "InputTextFlags_EscapeClearsAll", ImGuiInputTextFlags_EscapeClearsAll },
+    { "InputTextFlags_CtrlEnterForNewLine", ImGuiInputTextFlags_CtrlEnterForNewLine },
+    { "InputTextFlags_ReadOnly", ImGuiInputTextFlags_ReadOnly },
+    { "InputTextFlags_Password", ImGuiInputTextFlags_Password },
+    { "InputTextFlags_AlwaysOverwrite", ImGuiInputTextFlags_AlwaysOverwrite },
+    { "InputTextFlags_AutoSelectAll", ImGuiInputTextFlags_AutoSelectAll },
+    { "InputTextFlags_ParseEmptyRefVal", ImGuiInputTextFlags_ParseEmptyRefVal },
+    { "InputTextFlags_DisplayEmptyRefVal", ImGuiInputTextFlags_DisplayEmptyRefVal },
+    { "InputTextFlags_NoHorizontalScroll", ImGuiInputTextFlags_NoHorizontalScroll },
+    { "InputTextFlags_NoUndoRedo", ImGuiInputTextFlags_NoUndoRedo },
+    { "InputTextFlags_ElideLeft", ImGuiInputTextFlags_ElideLeft },
+    { "InputTextFlags_CallbackCompletion", ImGuiInputTextFlags_CallbackCompletion },
+    { "InputTextFlags_CallbackHistory", ImGuiInputTextFlags_CallbackHistory },
+    { "InputTextFlags_CallbackAlways", ImGuiInputTextFlags_CallbackAlways },
+    { "InputTextFlags_CallbackCharFilter", ImGuiInputTextFlags_CallbackCharFilter },
+    { "InputTextFlags_CallbackResize", ImGuiInputTextFlags_CallbackResize },
+    { "InputTextFlags_CallbackEdit", ImGuiInputTextFlags_CallbackEdit },
+    { "TreeNodeFlags_None", ImGuiTreeNodeFlags_None },
+    { "TreeNodeFlags_Selected", ImGuiTreeNodeFlags_Selected },
+    { "TreeNodeFlags_Framed", ImGuiTreeNodeFlags_Framed },
+    { "TreeNodeFlags_AllowOverlap", ImGuiTreeNodeFlags_AllowOverlap },
+    { "TreeNodeFlags_NoTreePushOnOpen", ImGuiTreeNodeFlags_NoTreePushOnOpen },
+    { "TreeNodeFlags_NoAutoOpenOnLog", ImGuiTreeNodeFlags_NoAutoOpenOnLog },
+    { "TreeNodeFlags_DefaultOpen", ImGuiTreeNodeFlags_DefaultOpen },
+    { "TreeNodeFlags_OpenOnDoubleClick", ImGuiTreeNodeFlags_OpenOnDoubleClick },
+    { "TreeNodeFlags_OpenOnArrow", ImGuiTreeNodeFlags_OpenOnArrow },
+    { "TreeNodeFlags_Leaf", ImGuiTreeNodeFlags_Leaf },
+    { "TreeNodeFlags_Bullet", ImGuiTreeNodeFlags_Bullet },
+    { "TreeNodeFlags_FramePadding", ImGuiTreeNodeFlags_FramePadding },
+    { "TreeNodeFlags_SpanAvailWidth", ImGuiTreeNodeFlags_SpanAvailWidth },
+    { "TreeNodeFlags_SpanFullWidth", ImGuiTreeNodeFlags_SpanFullWidth },
+    { "TreeNodeFlags_SpanLabelWidth", ImGuiTreeNodeFlags_SpanLabelWidth },
+    { "TreeNodeFlags_SpanAllColumns", ImGuiTreeNodeFlags_SpanAllColumns },
+    { "TreeNodeFlags_LabelSpanAllColumns", ImGuiTreeNodeFlags_LabelSpanAllColumns },
+    { "TreeNodeFlags_NavLeftJumpsToParent", ImGuiTreeNodeFlags_NavLeftJumpsToParent },
+    { "TreeNodeFlags_CollapsingHeader", ImGuiTreeNodeFlags_CollapsingHeader },
+    { "TreeNodeFlags_DrawLinesNone", ImGuiTreeNodeFlags_DrawLinesNone },
+    { "TreeNodeFlags_DrawLinesFull", ImGuiTreeNodeFlags_DrawLinesFull },
+    { "TreeNodeFlags_DrawLinesToNodes", ImGuiTreeNodeFlags_DrawLinesToNodes },
+    { "PopupFlags_None", ImGuiPopupFlags_None },
+    { "PopupFlags_MouseButtonLeft", ImGuiPopupFlags_MouseButtonLeft },
+    { "PopupFlags_MouseButtonRight", ImGuiPopupFlags_MouseButtonRight },
+    { "PopupFlags_MouseButtonMiddle", ImGuiPopupFlags_MouseButtonMiddle },
+    { "PopupFlags_MouseButtonMask_", ImGuiPopupFlags_MouseButtonMask_ },
+    { "PopupFlags_MouseButtonDefault_", ImGuiPopupFlags_MouseButtonDefault_ },
+    { "PopupFlags_NoReopen", ImGuiPopupFlags_NoReopen },
+    { "PopupFlags_NoOpenOverExistingPopup", ImGuiPopupFlags_NoOpenOverExistingPopup },
+    { "PopupFlags_NoOpenOverItems", ImGuiPopupFlags_NoOpenOverItems },
+    { "PopupFlags_AnyPopupId", ImGuiPopupFlags_AnyPopupId },
+    { "PopupFlags_AnyPopupLevel", ImGuiPopupFlags_AnyPopupLevel },
+    { "PopupFlags_AnyPopup", ImGuiPopupFlags_AnyPopup },
+    { "SelectableFlags_None", ImGuiSelectableFlags_None },
+    { "SelectableFlags_NoAutoClosePopups", ImGuiSelectableFlags_NoAutoClosePopups },
+    { "SelectableFlags_SpanAllColumns", ImGuiSelectableFlags_SpanAllColumns },
+    { "SelectableFlags_AllowDoubleClick", ImGuiSelectableFlags_AllowDoubleClick },
+    { "SelectableFlags_Disabled", ImGuiSelectableFlags_Disabled },
+    { "SelectableFlags_AllowOverlap", ImGuiSelectableFlags_AllowOverlap },
+    { "SelectableFlags_Highlight", ImGuiSelectableFlags_Highlight },
+    { "ComboFlags_None", ImGuiComboFlags_None },
+    { "ComboFlags_PopupAlignLeft", ImGuiComboFlags_PopupAlignLeft },
+    { "ComboFlags_HeightSmall", ImGuiComboFlags_HeightSmall },
+    { "ComboFlags_HeightRegular", ImGuiComboFlags_HeightRegular },
+    { "ComboFlags_HeightLarge", ImGuiComboFlags_HeightLarge },
+    { "ComboFlags_HeightLargest", ImGuiComboFlags_HeightLargest },
+    { "ComboFlags_NoArrowButton", ImGuiComboFlags_NoArrowButton },
+    { "ComboFlags_NoPreview", ImGuiComboFlags_NoPreview },
+    { "ComboFlags_WidthFitPreview", ImGuiComboFlags_WidthFitPreview },
+    { "ComboFlags_HeightMask_", ImGuiComboFlags_HeightMask_ },
+    { "TabBarFlags_None", ImGuiTabBarFlags_None },
+    { "TabBarFlags_Reorderable", ImGuiTabBarFlags_Reorderable },
+    { "TabBarFlags_AutoSelectNewTabs", ImGuiTabBarFlags_AutoSelectNewTabs },
+    { "TabBarFlags_TabListPopupButton", ImGuiTabBarFlags_TabListPopupButton },
+    { "TabBarFlags_NoCloseWithMiddleMouseButton", ImGuiTabBarFlags_NoCloseWithMiddleMouseButton },
+    { "TabBarFlags_NoTabListScrollingButtons", ImGuiTabBarFlags_NoTabListScrollingButtons },
+    { "TabBarFlags_NoTooltip", ImGuiTabBarFlags_NoTooltip },
+    { "TabBarFlags_DrawSelectedOverline", ImGuiTabBarFlags_DrawSelectedOverline },
+    { "TabBarFlags_FittingPolicyMixed", ImGuiTabBarFlags_FittingPolicyMixed },
+    { "TabBarFlags_FittingPolicyShrink", ImGuiTabBarFlags_FittingPolicyShrink },
+    { "TabBarFlags_FittingPolicyScroll", ImGuiTabBarFlags_FittingPolicyScroll },
+    { "TabBarFlags_FittingPolicyMask_", ImGuiTabBarFlags_FittingPolicyMask_ },
+    { "TabBarFlags_FittingPolicyDefault_", ImGuiTabBarFlags_FittingPolicyDefault_ },
+    { "TabItemFlags_None", ImGuiTabItemFlags_None },
+    { "TabItemFlags_UnsavedDocument", ImGuiTabItemFlags_UnsavedDocument },
+    { "TabItemFlags_SetSelected", ImGuiTabItemFlags_SetSelected },
+    { "TabItemFlags_NoCloseWithMiddleMouseButton", ImGuiTabItemFlags_NoCloseWithMiddleMouseButton },
+    { "TabItemFlags_NoPushId", ImGuiTabItemFlags_NoPushId },
+    { "TabItemFlags_NoTooltip", ImGuiTabItemFlags_NoTooltip },
+    { "TabItemFlags_NoReorder", ImGuiTabItemFlags_NoReorder },
+    { "TabItemFlags_Leading", ImGuiTabItemFlags_Leading },
+    { "TabItemFlags_Trailing", ImGuiTabItemFlags_Trailing },
+    { "TabItemFlags_NoAssumedClosure", ImGuiTabItemFlags_NoAssumedClosure },
+    { "FocusedFlags_None", ImGuiFocusedFlags_None },
+    { "FocusedFlags_ChildWindows", ImGuiFocusedFlags_ChildWindows },
+    { "FocusedFlags_RootWindow", ImGuiFocusedFlags_RootWindow },
+    { "FocusedFlags_AnyWindow", ImGuiFocusedFlags_AnyWindow },
+    { "FocusedFlags_NoPopupHierarchy", ImGuiFocusedFlags_NoPopupHierarchy },
+    { "FocusedFlags_RootAndChildWindows", ImGuiFocusedFlags_RootAndChildWindows },
+    { "HoveredFlags_None", ImGuiHoveredFlags_None },
+    { "HoveredFlags_ChildWindows", ImGuiHoveredFlags_ChildWindows },
+    { "HoveredFlags_RootWindow", ImGuiHoveredFlags_RootWindow },
+    { "HoveredFlags_AnyWindow", ImGuiHoveredFlags_AnyWindow },
+    { "HoveredFlags_NoPopupHierarchy", ImGuiHoveredFlags_NoPopupHierarchy },
+    { "HoveredFlags_AllowWhenBlockedByPopup", ImGuiHoveredFlags_AllowWhenBlockedByPopup },
+    { "HoveredFlags_AllowWhenBlockedByActiveItem", ImGuiHoveredFlags_AllowWhenBlockedByActiveItem },
+    { "HoveredFlags_AllowWhenOverlappedByItem", ImGuiHoveredFlags_AllowWhenOverlappedByItem },
+    { "HoveredFlags_AllowWhenOverlappedByWindow", ImGuiHoveredFlags_AllowWhenOverlappedByWindow },
+    { "HoveredFlags_AllowWhenDisabled", ImGuiHoveredFlags_AllowWhenDisabled },
+    { "HoveredFlags_NoNavOverride", ImGuiHoveredFlags_NoNavOverride },
+    { "HoveredFlags_AllowWhenOverlapped", ImGuiHoveredFlags_AllowWhenOverlapped },
+    { "HoveredFlags_RectOnly", ImGuiHoveredFlags_RectOnly },
+    { "HoveredFlags_RootAndChildWindows", ImGuiHoveredFlags_RootAndChildWindows },
+    { "HoveredFlags_ForTooltip", ImGuiHoveredFlags_ForTooltip },
+    { "HoveredFlags_Stationary", ImGuiHoveredFlags_Stationary },
+    { "HoveredFlags_DelayNone", ImGuiHoveredFlags_DelayNone },
+    { "HoveredFlags_DelayShort", ImGuiHoveredFlags_DelayShort },
+    { "HoveredFlags_DelayNormal", ImGuiHoveredFlags_DelayNormal },
+    { "HoveredFlags_NoSharedDelay", ImGuiHoveredFlags_NoSharedDelay },
+    { "DragDropFlags_None", ImGuiDragDropFlags_None },
+    { "DragDropFlags_SourceNoPreviewTooltip", ImGuiDragDropFlags_SourceNoPreviewTooltip },
+    { "DragDropFlags_SourceNoDisableHover", ImGuiDragDropFlags_SourceNoDisableHover },
+    { "DragDropFlags_SourceNoHoldToOpenOthers", ImGuiDragDropFlags_SourceNoHoldToOpenOthers },
+    { "DragDropFlags_SourceAllowNullID", ImGuiDragDropFlags_SourceAllowNullID },
+    { "DragDropFlags_SourceExtern", ImGuiDragDropFlags_SourceExtern },
+    { "DragDropFlags_PayloadAutoExpire", ImGuiDragDropFlags_PayloadAutoExpire },
+    { "DragDropFlags_PayloadNoCrossContext", ImGuiDragDropFlags_PayloadNoCrossContext },
+    { "DragDropFlags_PayloadNoCrossProcess", ImGuiDragDropFlags_PayloadNoCrossProcess },
+    { "DragDropFlags_AcceptBeforeDelivery", ImGuiDragDropFlags_AcceptBeforeDelivery },
+    { "DragDropFlags_AcceptNoDrawDefaultRect", ImGuiDragDropFlags_AcceptNoDrawDefaultRect },
+    { "DragDropFlags_AcceptNoPreviewTooltip", ImGuiDragDropFlags_AcceptNoPreviewTooltip },
+    { "DragDropFlags_AcceptPeekOnly", ImGuiDragDropFlags_AcceptPeekOnly },
+    { "DataType_S8", ImGuiDataType_S8 },
+    { "DataType_U8", ImGuiDataType_U8 },
+    { "DataType_S16", ImGuiDataType_S16 },
+    { "DataType_U16", ImGuiDataType_U16 },
+    { "DataType_S32", ImGuiDataType_S32 },
+    { "DataType_U32", ImGuiDataType_U32 },
+    { "DataType_S64", ImGuiDataType_S64 },
+    { "DataType_U64", ImGuiDataType_U64 },
+    { "DataType_Float", ImGuiDataType_Float },
+    { "DataType_Double", ImGuiDataType_Double },
+    { "DataType_Bool", ImGuiDataType_Bool },
+    { "DataType_String", ImGuiDataType_String },
+    { "DataType_COUNT", ImGuiDataType_COUNT },
+    { "Dir_None", ImGuiDir_None },
+    { "Dir_Left", ImGuiDir_Left },
+    { "Dir_Right", ImGuiDir_Right },
+    { "Dir_Up", ImGuiDir_Up },
+    { "Dir_Down", ImGuiDir_Down },
+    { "Dir_COUNT", ImGuiDir_COUNT },
+    { "SortDirection_None", ImGuiSortDirection_None },
+    { "SortDirection_Ascending", ImGuiSortDirection_Ascending },
+    { "SortDirection_Descending", ImGuiSortDirection_Descending },
+    { "Key_None", ImGuiKey_None },
+    { "Key_NamedKey_BEGIN", ImGuiKey_NamedKey_BEGIN },
+    { "Key_Tab", ImGuiKey_Tab },
+    { "Key_LeftArrow", ImGuiKey_LeftArrow },
+    { "Key_RightArrow", ImGuiKey_RightArrow },
+    { "Key_UpArrow", ImGuiKey_UpArrow },
+    { "Key_DownArrow", ImGuiKey_DownArrow },
+    { "Key_PageUp", ImGuiKey_PageUp },
+    { "Key_PageDown", ImGuiKey_PageDown },
+    { "Key_Home", ImGuiKey_Home },
+    { "Key_End", ImGuiKey_End },
+    { "Key_Insert", ImGuiKey_Insert },
+    { "Key_Delete", ImGuiKey_Delete },
+    { "Key_Backspace", ImGuiKey_Backspace },
+    { "Key_Space", ImGuiKey_Space },
+    { "Key_Enter", ImGuiKey_Enter },
+    { "Key_Escape", ImGuiKey_Escape },
+    { "Key_LeftCtrl", ImGuiKey_LeftCtrl },
+    { "Key_LeftShift", ImGuiKey_LeftShift },
+    { "Key_LeftAlt", ImGuiKey_LeftAlt },
+    { "Key_LeftSuper", ImGuiKey_LeftSuper },
+    { "Key_RightCtrl", ImGuiKey_RightCtrl },
+    { "Key_RightShift", ImGuiKey_RightShift },
+    { "Key_RightAlt", ImGuiKey_RightAlt },
+    { "Key_RightSuper", ImGuiKey_RightSuper },
+    { "Key_Menu", ImGuiKey_Menu },
+    { "Key_0", ImGuiKey_0 },
+    { "Key_1", ImGuiKey_1 },
+    { "Key_2", ImGuiKey_2 },
+    { "Key_3", ImGuiKey_3 },
+    { "Key_4", ImGuiKey_4 },
+    { "Key_5", ImGuiKey_5 },
+    { "Key_6", ImGuiKey_6 },
+    { "Key_7", ImGuiKey_7 },
+    { "Key_8", ImGuiKey_8 },
+    { "Key_9", ImGuiKey_9 },
+    { "Key_A", ImGuiKey_A },
+    { "Key_B", ImGuiKey_B },
+    { "Key_C", ImGuiKey_C },
+    { "Key_D", ImGuiKey_D },
+    { "Key_E", ImGuiKey_E },
+    { "Key_F", ImGuiKey_F },
+    { "Key_G", ImGuiKey_G },
+    { "Key_H", ImGuiKey_H },
+    { "Key_I", ImGuiKey_I },
+    { "Key_J", ImGuiKey_J },
+    { "Key_K", ImGuiKey_K },
+    { "Key_L", ImGuiKey_L },
+    { "Key_M", ImGuiKey_M },
+    { "Key_N", ImGuiKey_N },
+    { "Key_O", ImGuiKey_O },
+    { "Key_P", ImGuiKey_P },
+    { "Key_Q", ImGuiKey_Q },
+    { "Key_R", ImGuiKey_R },
+    { "Key_S", ImGuiKey_S },
+    { "Key_T", ImGuiKey_T },
+    { "Key_U", ImGuiKey_U },
+    { "Key_V", ImGuiKey_V },
+    { "Key_W", ImGuiKey_W },
+    { "Key_X", ImGuiKey_X },
+    { "Key_Y", ImGuiKey_Y },
+    { "Key_Z", ImGuiKey_Z },
+    { "Key_F1", ImGuiKey_F1 },
+    { "Key_F2", ImGuiKey_F2 },
+    { "Key_F3", ImGuiKey_F3 },
+    { "Key_F4", ImGuiKey_F4 },
+    { "Key_F5", ImGuiKey_F5 },
+    { "Key_F6", ImGuiKey_F6 },
+    { "Key_F7", ImGuiKey_F7 },
+    { "Key_F8", ImGuiKey_F8 },
+    { "Key_F9", ImGuiKey_F9 },
+    { "Key_F10", ImGuiKey_F10 },
+    { "Key_F11", ImGuiKey_F11 },
+    { "Key_F12", ImGuiKey_F12 },
+    { "Key_F13", ImGuiKey_F13 },
+    { "Key_F14", ImGuiKey_F14 },
+    { "Key_F15", ImGuiKey_F15 },
+    { "Key_F16", ImGuiKey_F16 },
+    { "Key_F17", ImGuiKey_F17 },
+    { "Key_F18", ImGuiKey_F18 },
+    { "Key_F19", ImGuiKey_F19 },
+    { "Key_F20", ImGuiKey_F20 },
+    { "Key_F21", ImGuiKey_F21 },
+    { "Key_F22", ImGuiKey_F22 },
+    { "Key_F23", ImGuiKey_F23 },
+    { "Key_F24", ImGuiKey_F24 },
+    { "Key_Apostrophe", ImGuiKey_Apostrophe },
+    { "Key_Comma", ImGuiKey_Comma },
+    { "Key_Minus", ImGuiKey_Minus },
+    { "Key_Period", ImGuiKey_Period },
+    { "Key_Slash", ImGuiKey_Slash },
+    { "Key_Semicolon", ImGuiKey_Semicolon },
+    { "Key_Equal", ImGuiKey_Equal },
+    { "Key_LeftBracket", ImGuiKey_LeftBracket },
+    { "Key_Backslash", ImGuiKey_Backslash },
+    { "Key_RightBracket", ImGuiKey_RightBracket },
+    { "Key_GraveAccent", ImGuiKey_GraveAccent },
+    { "Key_CapsLock", ImGuiKey_CapsLock },
+    { "Key_ScrollLock", ImGuiKey_ScrollLock },
+    { "Key_NumLock", ImGuiKey_NumLock },
+    { "Key_PrintScreen", ImGuiKey_PrintScreen },
+    { "Key_Pause", ImGuiKey_Pause },
+    { "Key_Keypad0", ImGuiKey_Keypad0 },
+    { "Key_Keypad1", ImGuiKey_Keypad1 },
+    { "Key_Keypad2", ImGuiKey_Keypad2 },
+    { "Key_Keypad3", ImGuiKey_Keypad3 },
+    { "Key_Keypad4", ImGuiKey_Keypad4 },
+    { "Key_Keypad5", ImGuiKey_Keypad5 },
+    { "Key_Keypad6", ImGuiKey_Keypad6 },
+    { "Key_Keypad7", ImGuiKey_Keypad7 },
+    { "Key_Keypad8", ImGuiKey_Keypad8 },
+    { "Key_Keypad9", ImGuiKey_Keypad9 },
+    { "Key_KeypadDecimal", ImGuiKey_KeypadDecimal },
+    { "Key_KeypadDivide", ImGuiKey_KeypadDivide },
+    { "Key_KeypadMultiply", ImGuiKey_KeypadMultiply },
+    { "Key_KeypadSubtract", ImGuiKey_KeypadSubtract },
+    { "Key_KeypadAdd", ImGuiKey_KeypadAdd },
+    { "Key_KeypadEnter", ImGuiKey_KeypadEnter },
+    { "Key_KeypadEqual", ImGuiKey_KeypadEqual },
+    { "Key_AppBack", ImGuiKey_AppBack },
+    { "Key_AppForward", ImGuiKey_AppForward },
+    { "Key_Oem102", ImGuiKey_Oem102 },
+    { "Key_GamepadStart", ImGuiKey_GamepadStart },
+    { "Key_GamepadBack", ImGuiKey_GamepadBack },
+    { "Key_GamepadFaceLeft", ImGuiKey_GamepadFaceLeft },
+    { "Key_GamepadFaceRight", ImGuiKey_GamepadFaceRight },
+    { "Key_GamepadFaceUp", ImGuiKey_GamepadFaceUp },
+    { "Key_GamepadFaceDown", ImGuiKey_GamepadFaceDown },
+    { "Key_GamepadDpadLeft", ImGuiKey_GamepadDpadLeft },
+    { "Key_GamepadDpadRight", ImGuiKey_GamepadDpadRight },
+    { "Key_GamepadDpadUp", ImGuiKey_GamepadDpadUp },
+    { "Key_GamepadDpadDown", ImGuiKey_GamepadDpadDown },
+    { "Key_GamepadL1", ImGuiKey_GamepadL1 },
+    { "Key_GamepadR1", ImGuiKey_GamepadR1 },
+    { "Key_GamepadL2", ImGuiKey_GamepadL2 },
+    { "Key_GamepadR2", ImGuiKey_GamepadR2 },
+    { "Key_GamepadL3", ImGuiKey_GamepadL3 },
+    { "Key_GamepadR3", ImGuiKey_GamepadR3 },
+    { "Key_GamepadLStickLeft", ImGuiKey_GamepadLStickLeft },
+    { "Key_GamepadLStickRight", ImGuiKey_GamepadLStickRight },
+    { "Key_GamepadLStickUp", ImGuiKey_GamepadLStickUp },
+    { "Key_GamepadLStickDown", ImGuiKey_GamepadLStickDown },
+    { "Key_GamepadRStickLeft", ImGuiKey_GamepadRStickLeft },
+    { "Key_GamepadRStickRight", ImGuiKey_GamepadRStickRight },
+    { "Key_GamepadRStickUp", ImGuiKey_GamepadRStickUp },
+    { "Key_GamepadRStickDown", ImGuiKey_GamepadRStickDown },
+    { "Key_MouseLeft", ImGuiKey_MouseLeft },
+    { "Key_MouseRight", ImGuiKey_MouseRight },
+    { "Key_MouseMiddle", ImGuiKey_MouseMiddle },
+    { "Key_MouseX1", ImGuiKey_MouseX1 },
+    { "Key_MouseX2", ImGuiKey_MouseX2 },
+    { "Key_MouseWheelX", ImGuiKey_MouseWheelX },
+    { "Key_MouseWheelY", ImGuiKey_MouseWheelY },
+    { "Key_ReservedForModCtrl", ImGuiKey_ReservedForModCtrl },
+    { "Key_ReservedForModShift", ImGuiKey_ReservedForModShift },
+    { "Key_ReservedForModAlt", ImGuiKey_ReservedForModAlt },
+    { "Key_ReservedForModSuper", ImGuiKey_ReservedForModSuper },
+    { "Key_NamedKey_END", ImGuiKey_NamedKey_END },
+    { "Key_NamedKey_COUNT", ImGuiKey_NamedKey_COUNT },
+    { "Mod_None", ImGuiMod_None },
+    { "Mod_Ctrl", ImGuiMod_Ctrl },
+    { "Mod_Shift", ImGuiMod_Shift },
+    { "Mod_Alt", ImGuiMod_Alt },
+    { "Mod_Super", ImGuiMod_Super },
+    { "Mod_Mask_", ImGuiMod_Mask_ },
+    { "InputFlags_None", ImGuiInputFlags_None },
+    { "InputFlags_Repeat", ImGuiInputFlags_Repeat },
+    { "InputFlags_RouteActive", ImGuiInputFlags_RouteActive },
+    { "InputFlags_RouteFocused", ImGuiInputFlags_RouteFocused },
+    { "InputFlags_RouteGlobal", ImGuiInputFlags_RouteGlobal },
+    { "InputFlags_RouteAlways", ImGuiInputFlags_RouteAlways },
+    { "InputFlags_RouteOverFocused", ImGuiInputFlags_RouteOverFocused },
+    { "InputFlags_RouteOverActive", ImGuiInputFlags_RouteOverActive },
+    { "InputFlags_RouteUnlessBgFocused", ImGuiInputFlags_RouteUnlessBgFocused },
+    { "InputFlags_RouteFromRootWindow", ImGuiInputFlags_RouteFromRootWindow },
+    { "InputFlags_Tooltip", ImGuiInputFlags_Tooltip },
+    { "ConfigFlags_None", ImGuiConfigFlags_None },
+    { "ConfigFlags_NavEnableKeyboard", ImGuiConfigFlags_NavEnableKeyboard },
+    { "ConfigFlags_NavEnableGamepad", ImGuiConfigFlags_NavEnableGamepad },
+    { "ConfigFlags_NoMouse", ImGuiConfigFlags_NoMouse },
+    { "ConfigFlags_NoMouseCursorChange", ImGuiConfigFlags_NoMouseCursorChange },
+    { "ConfigFlags_NoKeyboard", ImGuiConfigFlags_NoKeyboard },
+    { "ConfigFlags_IsSRGB", ImGuiConfigFlags_IsSRGB },
+    { "ConfigFlags_IsTouchScreen", ImGuiConfigFlags_IsTouchScreen },
+    { "BackendFlags_None", ImGuiBackendFlags_None },
+    { "BackendFlags_HasGamepad", ImGuiBackendFlags_HasGamepad },
+    { "BackendFlags_HasMouseCursors", ImGuiBackendFlags_HasMouseCursors },
+    { "BackendFlags_HasSetMousePos", ImGuiBackendFlags_HasSetMousePos },
+    { "BackendFlags_RendererHasVtxOffset", ImGuiBackendFlags_RendererHasVtxOffset },
+    { "BackendFlags_RendererHasTextures", ImGuiBackendFlags_RendererHasTextures },
+    { "Col_Text", ImGuiCol_Text },
+    { "Col_TextDisabled", ImGuiCol_TextDisabled },
+    { "Col_WindowBg", ImGuiCol_WindowBg },
+    { "Col_ChildBg", ImGuiCol_ChildBg },
+    { "Col_PopupBg", ImGuiCol_PopupBg },
+    { "Col_Border", ImGuiCol_Border },
+    { "Col_BorderShadow", ImGuiCol_BorderShadow },
+    { "Col_FrameBg", ImGuiCol_FrameBg },
+    { "Col_FrameBgHovered", ImGuiCol_FrameBgHovered },
+    { "Col_FrameBgActive", ImGuiCol_FrameBgActive },
+    { "Col_TitleBg", ImGuiCol_TitleBg },
+    { "Col_TitleBgActive", ImGuiCol_TitleBgActive },
+    { "Col_TitleBgCollapsed", ImGuiCol_TitleBgCollapsed },
+    { "Col_MenuBarBg", ImGuiCol_MenuBarBg },
+    { "Col_ScrollbarBg", ImGuiCol_ScrollbarBg },
+    { "Col_ScrollbarGrab", ImGuiCol_ScrollbarGrab },
+    { "Col_ScrollbarGrabHovered", ImGuiCol_ScrollbarGrabHovered },
+    { "Col_ScrollbarGrabActive", ImGuiCol_ScrollbarGrabActive },
+    { "Col_CheckMark", ImGuiCol_CheckMark },
+    { "Col_SliderGrab", ImGuiCol_SliderGrab },
+    { "Col_SliderGrabActive", ImGuiCol_SliderGrabActive },
+    { "Col_Button", ImGuiCol_Button },
+    { "Col_ButtonHovered", ImGuiCol_ButtonHovered },
+    { "Col_ButtonActive", ImGuiCol_ButtonActive },
+    { "Col_Header", ImGuiCol_Header },
+    { "Col_HeaderHovered", ImGuiCol_HeaderHovered },
+    { "Col_HeaderActive", ImGuiCol_HeaderActive },
+    { "Col_Separator", ImGuiCol_Separator },
+    { "Col_SeparatorHovered", ImGuiCol_SeparatorHovered },
+    { "Col_SeparatorActive", ImGuiCol_SeparatorActive },
+    { "Col_ResizeGrip", ImGuiCol_ResizeGrip },
+    { "Col_ResizeGripHovered", ImGuiCol_ResizeGripHovered },
+    { "Col_ResizeGripActive", ImGuiCol_ResizeGripActive },
+    { "Col_InputTextCursor", ImGuiCol_InputTextCursor },
+    { "Col_TabHovered", ImGuiCol_TabHovered },
+    { "Col_Tab", ImGuiCol_Tab },
+    { "Col_TabSelected", ImGuiCol_TabSelected },
+    { "Col_TabSelectedOverline", ImGuiCol_TabSelectedOverline },
+    { "Col_TabDimmed", ImGuiCol_TabDimmed },
+    { "Col_TabDimmedSelected", ImGuiCol_TabDimmedSelected },
+    { "Col_TabDimmedSelectedOverline", ImGuiCol_TabDimmedSelectedOverline },
+    { "Col_PlotLines", ImGuiCol_PlotLines },
+    { "Col_PlotLinesHovered", ImGuiCol_PlotLinesHovered },
+    { "Col_PlotHistogram", ImGuiCol_PlotHistogram },
+    { "Col_PlotHistogramHovered", ImGuiCol_PlotHistogramHovered },
+    { "Col_TableHeaderBg", ImGuiCol_TableHeaderBg },
+    { "Col_TableBorderStrong", ImGuiCol_TableBorderStrong },
+    { "Col_TableBorderLight", ImGuiCol_TableBorderLight },
+    { "Col_TableRowBg", ImGuiCol_TableRowBg },
+    { "Col_TableRowBgAlt", ImGuiCol_TableRowBgAlt },
+    { "Col_TextLink", ImGuiCol_TextLink },
+    { "Col_TextSelectedBg", ImGuiCol_TextSelectedBg },
+    { "Col_TreeLines", ImGuiCol_TreeLines },
+    { "Col_DragDropTarget", ImGuiCol_DragDropTarget },
+    { "Col_NavCursor", ImGuiCol_NavCursor },
+    { "Col_NavWindowingHighlight", ImGuiCol_NavWindowingHighlight },
+    { "Col_NavWindowingDimBg", ImGuiCol_NavWindowingDimBg },
+    { "Col_ModalWindowDimBg", ImGuiCol_ModalWindowDimBg },
+    { "Col_COUNT", ImGuiCol_COUNT },
+    { "StyleVar_Alpha", ImGuiStyleVar_Alpha },
+    { "StyleVar_DisabledAlpha", ImGuiStyleVar_DisabledAlpha },
+    { "StyleVar_WindowPadding", ImGuiStyleVar_WindowPadding },
+    { "StyleVar_WindowRounding", ImGuiStyleVar_WindowRounding },
+    { "StyleVar_WindowBorderSize", ImGuiStyleVar_WindowBorderSize },
+    { "StyleVar_WindowMinSize", ImGuiStyleVar_WindowMinSize },
+    { "StyleVar_WindowTitleAlign", ImGuiStyleVar_WindowTitleAlign },
+    { "StyleVar_ChildRounding", ImGuiStyleVar_ChildRounding },
+    { "StyleVar_ChildBorderSize", ImGuiStyleVar_ChildBorderSize },
+    { "StyleVar_PopupRounding", ImGuiStyleVar_PopupRounding },
+    { "StyleVar_PopupBorderSize", ImGuiStyleVar_PopupBorderSize },
+    { "StyleVar_FramePadding", ImGuiStyleVar_FramePadding },
+    { "StyleVar_FrameRounding", ImGuiStyleVar_FrameRounding },
+    { "StyleVar_FrameBorderSize", ImGuiStyleVar_FrameBorderSize },
+    { "StyleVar_ItemSpacing", ImGuiStyleVar_ItemSpacing },
+    { "StyleVar_ItemInnerSpacing", ImGuiStyleVar_ItemInnerSpacing },
+    { "StyleVar_IndentSpacing", ImGuiStyleVar_IndentSpacing },
+    { "StyleVar_CellPadding", ImGuiStyleVar_CellPadding },
+    { "StyleVar_ScrollbarSize", ImGuiStyleVar_ScrollbarSize },
+    { "StyleVar_ScrollbarRounding", ImGuiStyleVar_ScrollbarRounding },
+    { "StyleVar_GrabMinSize", ImGuiStyleVar_GrabMinSize },
+    { "StyleVar_GrabRounding", ImGuiStyleVar_GrabRounding },
+    { "StyleVar_ImageBorderSize", ImGuiStyleVar_ImageBorderSize },
+    { "StyleVar_TabRounding", ImGuiStyleVar_TabRounding },
+    { "StyleVar_TabBorderSize", ImGuiStyleVar_TabBorderSize },
+    { "StyleVar_TabMinWidthBase", ImGuiStyleVar_TabMinWidthBase },
+    { "StyleVar_TabMinWidthShrink", ImGuiStyleVar_TabMinWidthShrink },
+    { "StyleVar_TabBarBorderSize", ImGuiStyleVar_TabBarBorderSize },
+    { "StyleVar_TabBarOverlineSize", ImGuiStyleVar_TabBarOverlineSize },
+    { "StyleVar_TableAngledHeadersAngle", ImGuiStyleVar_TableAngledHeadersAngle },
+    { "StyleVar_TableAngledHeadersTextAlign", ImGuiStyleVar_TableAngledHeadersTextAlign },
+    { "StyleVar_TreeLinesSize", ImGuiStyleVar_TreeLinesSize },
+    { "StyleVar_TreeLinesRounding", ImGuiStyleVar_TreeLinesRounding },
+    { "StyleVar_ButtonTextAlign", ImGuiStyleVar_ButtonTextAlign },
+    { "StyleVar_SelectableTextAlign", ImGuiStyleVar_SelectableTextAlign },
+    { "StyleVar_SeparatorTextBorderSize", ImGuiStyleVar_SeparatorTextBorderSize },
+    { "StyleVar_SeparatorTextAlign", ImGuiStyleVar_SeparatorTextAlign },
+    { "StyleVar_SeparatorTextPadding", ImGuiStyleVar_SeparatorTextPadding },
+    { "StyleVar_COUNT", ImGuiStyleVar_COUNT },
+    { "ButtonFlags_None", ImGuiButtonFlags_None },
+    { "ButtonFlags_MouseButtonLeft", ImGuiButtonFlags_MouseButtonLeft },
+    { "ButtonFlags_MouseButtonRight", ImGuiButtonFlags_MouseButtonRight },
+    { "ButtonFlags_MouseButtonMiddle", ImGuiButtonFlags_MouseButtonMiddle },
+    { "ButtonFlags_MouseButtonMask_", ImGuiButtonFlags_MouseButtonMask_ },
+    { "ButtonFlags_EnableNav", ImGuiButtonFlags_EnableNav },
+    { "ColorEditFlags_None", ImGuiColorEditFlags_None },
+    { "ColorEditFlags_NoAlpha", ImGuiColorEditFlags_NoAlpha },
+    { "ColorEditFlags_NoPicker", ImGuiColorEditFlags_NoPicker },
+    { "ColorEditFlags_NoOptions", ImGuiColorEditFlags_NoOptions },
+    { "ColorEditFlags_NoSmallPreview", ImGuiColorEditFlags_NoSmallPreview },
+    { "ColorEditFlags_NoInputs", ImGuiColorEditFlags_NoInputs },
+    { "ColorEditFlags_NoTooltip", ImGuiColorEditFlags_NoTooltip },
+    { "ColorEditFlags_NoLabel", ImGuiColorEditFlags_NoLabel },
+    { "ColorEditFlags_NoSidePreview", ImGuiColorEditFlags_NoSidePreview },
+    { "ColorEditFlags_NoDragDrop", ImGuiColorEditFlags_NoDragDrop },
+    { "ColorEditFlags_NoBorder", ImGuiColorEditFlags_NoBorder },
+    { "ColorEditFlags_AlphaOpaque", ImGuiColorEditFlags_AlphaOpaque },
+    { "ColorEditFlags_AlphaNoBg", ImGuiColorEditFlags_AlphaNoBg },
+    { "ColorEditFlags_AlphaPreviewHalf", ImGuiColorEditFlags_AlphaPreviewHalf },
+    { "ColorEditFlags_AlphaBar", ImGuiColorEditFlags_AlphaBar },
+    { "ColorEditFlags_HDR", ImGuiColorEditFlags_HDR },
+    { "ColorEditFlags_DisplayRGB", ImGuiColorEditFlags_DisplayRGB },
+    { "ColorEditFlags_DisplayHSV", ImGuiColorEditFlags_DisplayHSV },
+    { "ColorEditFlags_DisplayHex", ImGuiColorEditFlags_DisplayHex },
+    { "ColorEditFlags_Uint8", ImGuiColorEditFlags_Uint8 },
+    { "ColorEditFlags_Float", ImGuiColorEditFlags_Float },
+    { "ColorEditFlags_PickerHueBar", ImGuiColorEditFlags_PickerHueBar },
+    { "ColorEditFlags_PickerHueWheel", ImGuiColorEditFlags_PickerHueWheel },
+    { "ColorEditFlags_InputRGB", ImGuiColorEditFlags_InputRGB },
+    { "ColorEditFlags_InputHSV", ImGuiColorEditFlags_InputHSV },
+    { "ColorEditFlags_DefaultOptions_", ImGuiColorEditFlags_DefaultOptions_ },
+    { "ColorEditFlags_AlphaMask_", ImGuiColorEditFlags_AlphaMask_ },
+    { "ColorEditFlags_DisplayMask_", ImGuiColorEditFlags_DisplayMask_ },
+    { "ColorEditFlags_DataTypeMask_", ImGuiColorEditFlags_DataTypeMask_ },
+    { "ColorEditFlags_PickerMask_", ImGuiColorEditFlags_PickerMask_ },
+    { "ColorEditFlags_InputMask_", ImGuiColorEditFlags_InputMask_ },
+    { "SliderFlags_None", ImGuiSliderFlags_None },
+    { "SliderFlags_Logarithmic", ImGuiSliderFlags_Logarithmic },
+    { "SliderFlags_NoRoundToFormat", ImGuiSliderFlags_NoRoundToFormat },
+    { "SliderFlags_NoInput", ImGuiSliderFlags_NoInput },
+    { "SliderFlags_WrapAround", ImGuiSliderFlags_WrapAround },
+    { "SliderFlags_ClampOnInput", ImGuiSliderFlags_ClampOnInput },
+    { "SliderFlags_ClampZeroRange", ImGuiSliderFlags_ClampZeroRange },
+    { "SliderFlags_NoSpeedTweaks", ImGuiSliderFlags_NoSpeedTweaks },
+    { "SliderFlags_AlwaysClamp", ImGuiSliderFlags_AlwaysClamp },
+    { "SliderFlags_InvalidMask_", ImGuiSliderFlags_InvalidMask_ },
+    { "MouseButton_Left", ImGuiMouseButton_Left },
+    { "MouseButton_Right", ImGuiMouseButton_Right },
+    { "MouseButton_Middle", ImGuiMouseButton_Middle },
+    { "MouseButton_COUNT", ImGuiMouseButton_COUNT },
+    { "MouseCursor_None", ImGuiMouseCursor_None },
+    { "MouseCursor_Arrow", ImGuiMouseCursor_Arrow },
+    { "MouseCursor_TextInput", ImGuiMouseCursor_TextInput },
+    { "MouseCursor_ResizeAll", ImGuiMouseCursor_ResizeAll },
+    { "MouseCursor_ResizeNS", ImGuiMouseCursor_ResizeNS },
+    { "MouseCursor_ResizeEW", ImGuiMouseCursor_ResizeEW },
+    { "MouseCursor_ResizeNESW", ImGuiMouseCursor_ResizeNESW },
+    { "MouseCursor_ResizeNWSE", ImGuiMouseCursor_ResizeNWSE },
+    { "MouseCursor_Hand", ImGuiMouseCursor_Hand },
+    { "MouseCursor_Wait", ImGuiMouseCursor_Wait },
+    { "MouseCursor_Progress", ImGuiMouseCursor_Progress },
+    { "MouseCursor_NotAllowed", ImGuiMouseCursor_NotAllowed },
+    { "MouseCursor_COUNT", ImGuiMouseCursor_COUNT },
+    { "MouseSource_Mouse", ImGuiMouseSource_Mouse },
+    { "MouseSource_TouchScreen", ImGuiMouseSource_TouchScreen },
+    { "MouseSource_Pen", ImGuiMouseSource_Pen },
+    { "MouseSource_COUNT", ImGuiMouseSource_COUNT },
+    { "Cond_None", ImGuiCond_None },
+    { "Cond_Always", ImGuiCond_Always },
+    { "Cond_Once", ImGuiCond_Once },
+    { "Cond_FirstUseEver", ImGuiCond_FirstUseEver },
+    { "Cond_Appearing", ImGuiCond_Appearing },
+    { "TableFlags_None", ImGuiTableFlags_None },
+    { "TableFlags_Resizable", ImGuiTableFlags_Resizable },
+    { "TableFlags_Reorderable", ImGuiTableFlags_Reorderable },
+    { "TableFlags_Hideable", ImGuiTableFlags_Hideable },
+    { "TableFlags_Sortable", ImGuiTableFlags_Sortable },
+    { "TableFlags_NoSavedSettings", ImGuiTableFlags_NoSavedSettings },
+    { "TableFlags_ContextMenuInBody", ImGuiTableFlags_ContextMenuInBody },
+    { "TableFlags_RowBg", ImGuiTableFlags_RowBg },
+    { "TableFlags_BordersInnerH", ImGuiTableFlags_BordersInnerH },
+    { "TableFlags_BordersOuterH", ImGuiTableFlags_BordersOuterH },
+    { "TableFlags_BordersInnerV", ImGuiTableFlags_BordersInnerV },
+    { "TableFlags_BordersOuterV", ImGuiTableFlags_BordersOuterV },
+    { "TableFlags_BordersH", ImGuiTableFlags_BordersH },
+    { "TableFlags_BordersV", ImGuiTableFlags_BordersV },
+    { "TableFlags_BordersInner", ImGuiTableFlags_BordersInner },
+    { "TableFlags_BordersOuter", ImGuiTableFlags_BordersOuter },
+    { "TableFlags_Borders", ImGuiTableFlags_Borders },
+    { "TableFlags_NoBordersInBody", ImGuiTableFlags_NoBordersInBody },
+    { "TableFlags_NoBordersInBodyUntilResize", ImGuiTableFlags_NoBordersInBodyUntilResize },
+    { "TableFlags_SizingFixedFit", ImGuiTableFlags_SizingFixedFit },
+    { "TableFlags_SizingFixedSame", ImGuiTableFlags_SizingFixedSame },
+    { "TableFlags_SizingStretchProp", ImGuiTableFlags_SizingStretchProp },
+    { "TableFlags_SizingStretchSame", ImGuiTableFlags_SizingStretchSame },
+    { "TableFlags_NoHostExtendX", ImGuiTableFlags_NoHostExtendX },
+    { "TableFlags_NoHostExtendY", ImGuiTableFlags_NoHostExtendY },
+    { "TableFlags_NoKeepColumnsVisible", ImGuiTableFlags_NoKeepColumnsVisible },
+    { "TableFlags_PreciseWidths", ImGuiTableFlags_PreciseWidths },
+    { "TableFlags_NoClip", ImGuiTableFlags_NoClip },
+    { "TableFlags_PadOuterX", ImGuiTableFlags_PadOuterX },
+    { "TableFlags_NoPadOuterX", ImGuiTableFlags_NoPadOuterX },
+    { "TableFlags_NoPadInnerX", ImGuiTableFlags_NoPadInnerX },
+    { "TableFlags_ScrollX", ImGuiTableFlags_ScrollX },
+    { "TableFlags_ScrollY", ImGuiTableFlags_ScrollY },
+    { "TableFlags_SortMulti", ImGuiTableFlags_SortMulti },
+    { "TableFlags_SortTristate", ImGuiTableFlags_SortTristate },
+    { "TableFlags_HighlightHoveredColumn", ImGuiTableFlags_HighlightHoveredColumn },
+    { "TableFlags_SizingMask_", ImGuiTableFlags_SizingMask_ },
+    { "TableColumnFlags_None", ImGuiTableColumnFlags_None },
+    { "TableColumnFlags_Disabled", ImGuiTableColumnFlags_Disabled },
+    { "TableColumnFlags_DefaultHide", ImGuiTableColumnFlags_DefaultHide },
+    { "TableColumnFlags_DefaultSort", ImGuiTableColumnFlags_DefaultSort },
+    { "TableColumnFlags_WidthStretch", ImGuiTableColumnFlags_WidthStretch },
+    { "TableColumnFlags_WidthFixed", ImGuiTableColumnFlags_WidthFixed },
+    { "TableColumnFlags_NoResize", ImGuiTableColumnFlags_NoResize },
+    { "TableColumnFlags_NoReorder", ImGuiTableColumnFlags_NoReorder },
+    { "TableColumnFlags_NoHide", ImGuiTableColumnFlags_NoHide },
+    { "TableColumnFlags_NoClip", ImGuiTableColumnFlags_NoClip },
+    { "TableColumnFlags_NoSort", ImGuiTableColumnFlags_NoSort },
+    { "TableColumnFlags_NoSortAscending", ImGuiTableColumnFlags_NoSortAscending },
+    { "TableColumnFlags_NoSortDescending", ImGuiTableColumnFlags_NoSortDescending },
+    { "TableColumnFlags_NoHeaderLabel", ImGuiTableColumnFlags_NoHeaderLabel },
+    { "TableColumnFlags_NoHeaderWidth", ImGuiTableColumnFlags_NoHeaderWidth },
+    { "TableColumnFlags_PreferSortAscending", ImGuiTableColumnFlags_PreferSortAscending },
+    { "TableColumnFlags_PreferSortDescending", ImGuiTableColumnFlags_PreferSortDescending },
+    { "TableColumnFlags_IndentEnable", ImGuiTableColumnFlags_IndentEnable },
+    { "TableColumnFlags_IndentDisable", ImGuiTableColumnFlags_IndentDisable },
+    { "TableColumnFlags_AngledHeader", ImGuiTableColumnFlags_AngledHeader },
+    { "TableColumnFlags_IsEnabled", ImGuiTableColumnFlags_IsEnabled },
+    { "TableColumnFlags_IsVisible", ImGuiTableColumnFlags_IsVisible },
+    { "TableColumnFlags_IsSorted", ImGuiTableColumnFlags_IsSorted },
+    { "TableColumnFlags_IsHovered", ImGuiTableColumnFlags_IsHovered },
+    { "TableColumnFlags_WidthMask_", ImGuiTableColumnFlags_WidthMask_ },
+    { "TableColumnFlags_IndentMask_", ImGuiTableColumnFlags_IndentMask_ },
+    { "TableColumnFlags_StatusMask_", ImGuiTableColumnFlags_StatusMask_ },
+    { "TableColumnFlags_NoDirectResize_", ImGuiTableColumnFlags_NoDirectResize_ },
+    { "TableRowFlags_None", ImGuiTableRowFlags_None },
+    { "TableRowFlags_Headers", ImGuiTableRowFlags_Headers },
+    { "TableBgTarget_None", ImGuiTableBgTarget_None },
+    { "TableBgTarget_RowBg0", ImGuiTableBgTarget_RowBg0 },
+    { "TableBgTarget_RowBg1", ImGuiTableBgTarget_RowBg1 },
+    { "TableBgTarget_CellBg", ImGuiTableBgTarget_CellBg },
+    { "MultiSelectFlags_None", ImGuiMultiSelectFlags_None },
+    { "MultiSelectFlags_SingleSelect", ImGuiMultiSelectFlags_SingleSelect },
+    { "MultiSelectFlags_NoSelectAll", ImGuiMultiSelectFlags_NoSelectAll },
+    { "MultiSelectFlags_NoRangeSelect", ImGuiMultiSelectFlags_NoRangeSelect },
+    { "MultiSelectFlags_NoAutoSelect", ImGuiMultiSelectFlags_NoAutoSelect },
+    { "MultiSelectFlags_NoAutoClear", ImGuiMultiSelectFlags_NoAutoClear },
+    { "MultiSelectFlags_NoAutoClearOnReselect", ImGuiMultiSelectFlags_NoAutoClearOnReselect },
+    { "MultiSelectFlags_BoxSelect1d", ImGuiMultiSelectFlags_BoxSelect1d },
+    { "MultiSelectFlags_BoxSelect2d", ImGuiMultiSelectFlags_BoxSelect2d },
+    { "MultiSelectFlags_BoxSelectNoScroll", ImGuiMultiSelectFlags_BoxSelectNoScroll },
+    { "MultiSelectFlags_ClearOnEscape", ImGuiMultiSelectFlags_ClearOnEscape },
+    { "MultiSelectFlags_ClearOnClickVoid", ImGuiMultiSelectFlags_ClearOnClickVoid },
+    { "MultiSelectFlags_ScopeWindow", ImGuiMultiSelectFlags_ScopeWindow },
+    { "MultiSelectFlags_ScopeRect", ImGuiMultiSelectFlags_ScopeRect },
+    { "MultiSelectFlags_SelectOnClick", ImGuiMultiSelectFlags_SelectOnClick },
+    { "MultiSelectFlags_SelectOnClickRelease", ImGuiMultiSelectFlags_SelectOnClickRelease },
+    { "MultiSelectFlags_NavWrapX", ImGuiMultiSelectFlags_NavWrapX },
+    { "SelectionRequestType_None", ImGuiSelectionRequestType_None },
+    { "SelectionRequestType_SetAll", ImGuiSelectionRequestType_SetAll },
+    { "SelectionRequestType_SetRange", ImGuiSelectionRequestType_SetRange },
+    { "ViewportFlags_None", ImGuiViewportFlags_None },
+    { "ViewportFlags_IsPlatformWindow", ImGuiViewportFlags_IsPlatformWindow },
+    { "ViewportFlags_IsPlatformMonitor", ImGuiViewportFlags_IsPlatformMonitor },
+    { "ViewportFlags_OwnedByApp", ImGuiViewportFlags_OwnedByApp },
+    { NULL, 0 }
+};
+
+/* fill the table on top of the stack */
+static void cimgui_gen_register(lua_State *L)
+{
+    luaL_setfuncs(L, cimgui_gen_funcs, 0);
+    for (int i = 0; cimgui_gen_enums[i].name; i++) {
+        lua_pushinteger(L, cimgui_gen_enums[i].value);
+        lua_setfield(L, -2, cimgui_gen_enums[i].name);
+    }
+}
@@ -3,12 +3,29 @@
    -------------------------------------------------------------
    A tiny, variadic logging wrapper around sokol_log.
    Include this header wherever you want LOG_INFO/WARN/ERROR.
+
+   After custom_log_setup() a call only formats the message into
+   a slot of a lock-free ring; a background thread adds the
+   header and writes to stdout or a rotating file. Before setup
+   (and after shutdown) messages go straight to slog_func.
+
+   With desc.binary the LOG_* macros skip formatting altogether:
+   the call site's static descriptor, a timestamp and the raw
+   argument values are copied into a per-thread buffer and the
+   file is turned into text later by the log_decode tool. Tag and
+   fmt must be string literals.
+
+   Every tag has a runtime level, 1-in-N sampling and a rate limit;
+   calls they reject return before touching the arguments. Levels
+   above CUSTOM_LOG_LEVEL are not compiled in at all.
    ------------------------------------------------------------- */
 
 #ifndef CUSTOM_LOG_H
 #define CUSTOM_LOG_H
 
 #include "sokol_log.h"
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* -----------------------------------------------------------------
@@ -18,28 +35,109 @@
 extern "C" {
 #endif
 
+typedef struct custom_log_desc {
+    const char* path;           // NULL: stdout, else a file rotated as path.1 .. path.N
+    size_t      max_file_bytes; // rotate past this size (default 4 MB)
+    int         max_files;      // rotated files kept (default 3)
+    bool        binary;         // deferred formatting, needs path (see log_decode)
+} custom_log_desc;
+
+/* most verbose level compiled in: 1=error 2=warn 3=info 4=debug */
+#ifndef CUSTOM_LOG_LEVEL
+#if defined(NDEBUG)
+#define CUSTOM_LOG_LEVEL 3
+#else
+#define CUSTOM_LOG_LEVEL 4
+#endif
+#endif
+
+typedef struct custom_log_tag custom_log_tag;
+
+#define CUSTOM_LOG_MAX_ARGS 24      // va_arg reads per binary call site, more go as text
+
+/* one per LOG_* call site, static – the writer fills id/file_gen, the
+   first binary call the argument kinds (so later calls never parse fmt) */
+typedef struct custom_log_site {
+    const char* tag;
+    const char* fmt;
+    const char* file;
+    uint32_t    line;
+    uint32_t    level;
+    uint32_t    id;             // SITE record id in the current file
+    uint32_t    file_gen;       // file the SITE record went to
+    _Atomic(custom_log_tag*) tag_ref;   // registry entry, published by the first call
+    _Atomic(uint32_t) num_args; // 0 unparsed, 1 being filled, 2 + n: args[0..n) valid
+    uint8_t     args[CUSTOM_LOG_MAX_ARGS];
+} custom_log_site;
+
+typedef struct custom_log_tag_info {
+    const char* name;
+    int         level;          // -1: follows the default
+    unsigned    sample;         // 1 in N, 0/1 = all
+    float       rate;           // messages per second, 0 = unlimited
+    uint64_t    suppressed;     // dropped by sampling/rate so far
+} custom_log_tag_info;
+
+void     custom_log_setup(const custom_log_desc* desc);   // needs stm_setup() first
+void     custom_log_flush(void);      // block until everything queued is written
+void     custom_log_shutdown(void);   // flush + stop the writer thread
+uint64_t custom_log_dropped(void);    // messages lost to a full ring so far
+void     custom_log_thread_exit(void); // last call of a worker thread: its buffer gets reused
+
+/* drop-in for slog_func in sokol desc structs (.logger.func), so sokol's
+   messages take the same path as LOG_* – also before setup */
+void custom_log_slog(const char* tag, uint32_t log_level, uint32_t log_item, const char* message,
+                     uint32_t line, const char* filename, void* user_data);
+
+/* extra consumer of every finished line (no newline), called on the
+   writer thread – in binary mode too, events are formatted for it */
+typedef void (*custom_log_sink_fn)(uint32_t level, const char* line, size_t len, void* user);
+void custom_log_set_sink(custom_log_sink_fn fn, void* user);     // NULL fn removes it
+
+/* per-tag filters, usable before setup; tag NULL = default level of all tags */
+void custom_log_set_level(const char* tag, int level);             // pass messages up to level
+void custom_log_set_rate(const char* tag, float per_second, int burst);   // 0 = unlimited
+void custom_log_set_sampling(const char* tag, unsigned one_in_n);  // 1 = every message
+int  custom_log_tags(custom_log_tag_info* out, int max);           // registry snapshot
+
 /* Internal helper – do NOT call directly */
 void _custom_log(const char* tag,
-                 uint32_t    level,      // 3=info, 2=warn, 1=error
+                 uint32_t    level,      // 4=debug, 3=info, 2=warn, 1=error
                  const char* fmt,
                  uint32_t    line,
                  const char* file,
                  ...);
+void _custom_log_site(custom_log_site* site, ...);
 
 /* -----------------------------------------------------------------
    Macros – they automatically capture __LINE__ / __FILE__
    ----------------------------------------------------------------- */
-#define LOG_INFO(tag, fmt, ...) \
-    _custom_log(tag, 3, fmt, __LINE__, __FILE__, ##__VA_ARGS__)
+#define CUSTOM_LOG_AT(level, tag, fmt, ...) do { \
+        static custom_log_site _log_site = { tag, fmt, __FILE__, __LINE__, level, 0, 0, 0, 0, {0} }; \
+        _custom_log_site(&_log_site, ##__VA_ARGS__); \
+    } while (0)
 
-#define LOG_WARN(tag, fmt, ...) \
-    _custom_log(tag, 2, fmt, __LINE__, __FILE__, ##__VA_ARGS__)
+#define CUSTOM_LOG_OFF() do { } while (0)
 
-#define LOG_ERROR(tag, fmt, ...) \
-    _custom_log(tag, 1, fmt, __LINE__, __FILE__, ##__VA_ARGS__)
+#if CUSTOM_LOG_LEVEL >= 4
+#define LOG_DEBUG(tag, fmt, ...) CUSTOM_LOG_AT(4, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(tag, fmt, ...) CUSTOM_LOG_OFF()
+#endif
+#if CUSTOM_LOG_LEVEL >= 3
+#define LOG_INFO(tag, fmt, ...)  CUSTOM_LOG_AT(3, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INFO(tag, fmt, ...)  CUSTOM_LOG_OFF()
+#endif
+#if CUSTOM_LOG_LEVEL >= 2
+#define LOG_WARN(tag, fmt, ...)  CUSTOM_LOG_AT(2, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WARN(tag, fmt, ...)  CUSTOM_LOG_OFF()
+#endif
+#define LOG_ERROR(tag, fmt, ...) CUSTOM_LOG_AT(1, tag, fmt, ##__VA_ARGS__)
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* CUSTOM_LOG_H */
\ No newline at end of file
+#endif /* CUSTOM_LOG_H */
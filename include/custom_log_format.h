@@ -0,0 +1,193 @@
+/* -------------------------------------------------------------
+   custom_log_format.h
+   -------------------------------------------------------------
+   Binary log layout shared by custom_log.c and tools/log_decode.c
+   (native byte order – decode on the machine type that wrote it)
+
+   header  : "CLOGBIN1"
+   SITE    : u8 type, u32 id, u32 level, u32 line, str tag, str file, str fmt
+   EVENT   : u8 type, u32 site, u32 thread, u64 time_ns, u32 size, payload
+   TEXT    : u8 type, u32 level, u32 line, u64 time_ns, str tag, str file, str msg
+   DROPPED : u8 type, u64 time_ns, u64 count
+   str     : u16 len + bytes, CLOG_STR_NULL for a NULL pointer
+
+   An EVENT payload holds one value per conversion of the site's
+   format, in order: '*' widths and integers as 8 bytes (i64/u64),
+   floating point as f64, %p as u64, %s as str, %n nothing. Each
+   file starts with a header and repeats the SITE records it uses.
+   ------------------------------------------------------------- */
+
+#ifndef CUSTOM_LOG_FORMAT_H
+#define CUSTOM_LOG_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define CLOG_MAGIC      "CLOGBIN1"
+#define CLOG_MAGIC_LEN  8
+#define CLOG_STR_NULL   0xffff
+
+enum {
+    CLOG_REC_SITE    = 1,
+    CLOG_REC_EVENT   = 2,
+    CLOG_REC_TEXT    = 3,
+    CLOG_REC_DROPPED = 4,
+};
+
+/* how one conversion's argument is read and stored */
+typedef enum clog_arg {
+    CLOG_ARG_INT,               // d i c           → i64
+    CLOG_ARG_UINT,              // o u x X         → u64
+    CLOG_ARG_DOUBLE,            // a e f g (+caps) → f64
+    CLOG_ARG_STR,               // s               → str
+    CLOG_ARG_PTR,               // p               → u64
+    CLOG_ARG_NONE,              // n, unknown      → nothing
+} clog_arg;
+
+/* one %-conversion of a printf format */
+typedef struct clog_spec {
+    const char* begin;          // the '%'
+    const char* flags;          // flags, width and precision (may contain '*')
+    int         flags_len;
+    char        length[3];      // "", "hh", "h", "l", "ll", "j", "z", "t", "L"
+    char        conv;
+    int         stars;          // '*' in width/precision, each takes an int
+    clog_arg    arg;
+} clog_spec;
+
+/* next conversion at or after p, skipping "%%" – NULL when there is none */
+static inline const char* clog_next_spec(const char* p, clog_spec* s)
+{
+    for (; *p; p++) {
+        if (*p != '%') continue;
+        if (p[1] == '%') { p++; continue; }
+
+        memset(s, 0, sizeof(*s));
+        s->begin = p++;
+        s->flags = p;
+        while (*p && strchr("-+ #0", *p)) p++;
+        while (*p == '*' || (*p >= '0' && *p <= '9') || *p == '.') {
+            if (*p == '*') s->stars++;
+            p++;
+        }
+        s->flags_len = (int)(p - s->flags);
+        int n = 0;
+        while (*p && strchr("hljztL", *p) && n < 2) s->length[n++] = *p++;
+        s->conv = *p;
+        switch (*p) {
+            case 'd': case 'i': case 'c':                       s->arg = CLOG_ARG_INT; break;
+            case 'o': case 'u': case 'x': case 'X':             s->arg = CLOG_ARG_UINT; break;
+            case 'a': case 'A': case 'e': case 'E':
+            case 'f': case 'F': case 'g': case 'G':             s->arg = CLOG_ARG_DOUBLE; break;
+            case 's':                                           s->arg = CLOG_ARG_STR; break;
+            case 'p':                                           s->arg = CLOG_ARG_PTR; break;
+            default:                                            s->arg = CLOG_ARG_NONE; break;
+        }
+        return *p ? p + 1 : p;
+    }
+    return NULL;
+}
+
+/* fmt + an EVENT payload → text, reprinting each value with the widest
+   C type of its class; false (and a note in out) on a short payload */
+static inline int clog_format(const char* fmt, const uint8_t* payload, size_t size,
+                              char* out, size_t cap)
+{
+    const uint8_t *p = payload, *end = payload + size;
+    const char* lit = fmt ? fmt : "";
+    const char* next;
+    size_t n = 0;
+    int ok = 1;
+    clog_spec s;
+
+    if (!cap) return 0;
+    out[0] = 0;
+
+#define CLOG_EMIT(...) do { if (n < cap) { int w_ = snprintf(out + n, cap - n, __VA_ARGS__); \
+                            if (w_ > 0) n += (size_t)w_; } } while (0)
+#define CLOG_READ(dst, bytes) do { if ((size_t)(end - p) < (bytes)) { ok = 0; memset(dst, 0, bytes); } \
+                                   else { memcpy(dst, p, bytes); p += (bytes); } } while (0)
+
+    while (ok && (next = clog_next_spec(lit, &s))) {
+        for (const char* c = lit; c < s.begin; c++) {       // literal text, "%%" → "%"
+            if (c[0] == '%' && c[1] == '%') c++;
+            CLOG_EMIT("%c", *c);
+        }
+        lit = next;
+
+        int stars[2] = { 0, 0 };
+        for (int i = 0; i < s.stars; i++) {
+            int64_t v;
+            CLOG_READ(&v, 8);
+            if (i < 2) stars[i] = (int)v;
+        }
+
+        char spec[64];
+        const char* len = (s.arg == CLOG_ARG_INT || s.arg == CLOG_ARG_UINT) && s.conv != 'c' ? "ll" : "";
+        snprintf(spec, sizeof(spec), "%%%.*s%s%c", s.flags_len, s.flags, len, s.conv);
+
+#define CLOG_EMIT_SPEC(value) do { \
+            if (s.stars == 0)      CLOG_EMIT(spec, value); \
+            else if (s.stars == 1) CLOG_EMIT(spec, stars[0], value); \
+            else                   CLOG_EMIT(spec, stars[0], stars[1], value); \
+        } while (0)
+
+        switch (s.arg) {
+        case CLOG_ARG_INT: {
+            int64_t v;
+            CLOG_READ(&v, 8);
+            if (s.conv == 'c') CLOG_EMIT_SPEC((int)v);
+            else               CLOG_EMIT_SPEC((long long)v);
+        } break;
+        case CLOG_ARG_UINT: {
+            uint64_t v;
+            CLOG_READ(&v, 8);
+            CLOG_EMIT_SPEC((unsigned long long)v);
+        } break;
+        case CLOG_ARG_DOUBLE: {
+            double v;
+            CLOG_READ(&v, 8);
+            CLOG_EMIT_SPEC(v);
+        } break;
+        case CLOG_ARG_PTR: {
+            uint64_t v;
+            CLOG_READ(&v, 8);
+            CLOG_EMIT_SPEC((void*)(uintptr_t)v);
+        } break;
+        case CLOG_ARG_STR: {
+            uint16_t l16;
+            char str[1024];
+            CLOG_READ(&l16, 2);
+            if (!ok) break;
+            if (l16 == CLOG_STR_NULL) {
+                CLOG_EMIT_SPEC("(null)");
+                break;
+            }
+            size_t sl = l16 < sizeof(str) ? l16 : sizeof(str) - 1;
+            if ((size_t)(end - p) < l16) { ok = 0; break; }
+            memcpy(str, p, sl);
+            str[sl] = 0;
+            p += l16;
+            CLOG_EMIT_SPEC(str);
+        } break;
+        case CLOG_ARG_NONE:
+            break;
+        }
+#undef CLOG_EMIT_SPEC
+    }
+    if (ok) {
+        for (const char* c = lit; *c; c++) {
+            if (c[0] == '%' && c[1] == '%') c++;
+            CLOG_EMIT("%c", *c);
+        }
+    } else {
+        snprintf(out, cap, "<truncated arguments>");
+    }
+#undef CLOG_READ
+#undef CLOG_EMIT
+    return ok;
+}
+
+#endif /* CUSTOM_LOG_FORMAT_H */
@@ -0,0 +1,19 @@
+#pragma once
+#include <stdbool.h>
+
+/* ------------------------------------------------------------------ */
+/*  file_watch – non-blocking change notification for a few files     */
+/*  Linux uses inotify on the parent directory (survives editors that */
+/*  save through rename), other platforms compare mtimes on poll.     */
+/* ------------------------------------------------------------------ */
+#define FILE_WATCH_MAX  32
+
+bool file_watch_init(void);
+void file_watch_shutdown(void);
+
+/* returns a watch id >= 0, the same id for an already watched path */
+int  file_watch_add(const char *path);
+const char* file_watch_path(int id);
+
+/* fills ids with watches that changed since the last poll, never blocks */
+int  file_watch_poll(int *ids, int max_ids);
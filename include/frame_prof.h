@@ -0,0 +1,55 @@
+#pragma once
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ------------------------------------------------------------------ */
+/*  frame_prof – scoped CPU zones on stm_now(), gathered per frame    */
+/*                                                                    */
+/*      PROF_ZONE("sg_commit") { sg_commit(); }                       */
+/*                                                                    */
+/*  The block runs exactly once; don't break/return/goto out of it    */
+/*  or the zone never ends. Each thread records into its own ring,    */
+/*  frame_prof_new_frame() collects them on the main thread. Names    */
+/*  must outlive the program (string literals).                       */
+/*                                                                    */
+/*  With FRAME_PROF_ENABLED 0 a zone is just its block.               */
+/* ------------------------------------------------------------------ */
+#ifndef FRAME_PROF_ENABLED
+#define FRAME_PROF_ENABLED 1
+#endif
+
+#if FRAME_PROF_ENABLED
+#define PROF_ZONE(name)             PROF_ZONE_LINE_(name, __LINE__)
+#define PROF_ZONE_LINE_(name, line) PROF_ZONE_VAR_(name, _prof_zone_##line)
+#define PROF_ZONE_VAR_(name, var) \
+    for (int var = frame_prof_begin(name); var; var = frame_prof_end(var))
+#else
+#define PROF_ZONE(name)
+#endif
+
+/* after stm_setup(), on the main thread */
+void frame_prof_setup(void);
+void frame_prof_shutdown(void);
+
+/* last call of a thread that used PROF_ZONE, outside any zone: hands its
+   ring to the next thread instead of keeping it forever */
+void frame_prof_thread_exit(void);
+
+/* top of frame(): closes the previous frame and collects its zones */
+void frame_prof_new_frame(void);
+
+/* between simgui_new_frame() and simgui_render() */
+void frame_prof_window(bool *open);
+
+/* write the next `frames` frames as Chrome trace-event JSON (chrome://tracing,
+   ui.perfetto.dev); a background thread does the writing. NULL path = trace.json */
+bool frame_prof_capture(int frames, const char *path);
+bool frame_prof_capturing(void);
+
+/* main thread: a value of the current frame, shown as a trace counter
+   (name must be a string literal) */
+void frame_prof_counter(const char *name, double value);
+
+/* used by PROF_ZONE – begin returns the token end wants, never 0 */
+int frame_prof_begin(const char *name);
+int frame_prof_end(int token);
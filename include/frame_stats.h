@@ -0,0 +1,34 @@
+#pragma once
+#include <stdbool.h>
+
+/* ------------------------------------------------------------------ */
+/*  frame_stats – sg_query_frame_stats() + frame/GPU time per frame:  */
+/*  a history ring for sparklines, the frame_prof counters, and an    */
+/*  optional CSV file with one row per frame                          */
+/* ------------------------------------------------------------------ */
+typedef enum frame_stat {
+    FRAME_STAT_FRAME_MS,
+    FRAME_STAT_GPU_MS,
+    FRAME_STAT_DRAWS,
+    FRAME_STAT_PASSES,
+    FRAME_STAT_PIPELINES,
+    FRAME_STAT_BINDINGS,
+    FRAME_STAT_UNIFORMS,
+    FRAME_STAT_UNIFORM_BYTES,
+    FRAME_STAT_BUFFER_BYTES,    // update + append
+    FRAME_STAT_IMAGE_BYTES,
+    FRAME_STAT_NUM,
+} frame_stat;
+
+/* after sg_setup() and gpu_timer_setup(); csv_path NULL = no file */
+void frame_stats_setup(const char *csv_path);
+void frame_stats_shutdown(void);
+
+/* right after sg_commit(), frame_seconds as sapp_frame_duration() */
+void frame_stats_update(double frame_seconds);
+
+/* newest value, 0 before the first frame */
+float frame_stats_last(frame_stat stat);
+
+/* between simgui_new_frame() and simgui_render() */
+void frame_stats_window(bool *open);
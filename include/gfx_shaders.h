@@ -0,0 +1,11 @@
+#pragma once
+#include "sokol_gfx.h"
+
+/* ------------------------------------------------------------------ */
+/*  Built-in shaders for the Lua draw list. Every shdc header defines  */
+/*  the same static source arrays, so each lives in its own file.      */
+/*  Both take a single `mat4 mvp` in uniform block 0; the textured     */
+/*  one samples view 0 with sampler 0.                                 */
+/* ------------------------------------------------------------------ */
+const sg_shader_desc* gfx_shader_color_desc(sg_backend backend);      // pos float3, color float4
+const sg_shader_desc* gfx_shader_textured_desc(sg_backend backend);   // pos float3, uv float2 / short2n
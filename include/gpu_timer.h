@@ -0,0 +1,34 @@
+#pragma once
+#include <stdbool.h>
+
+/* ------------------------------------------------------------------ */
+/*  gpu_timer – GL_TIME_ELAPSED queries around render passes          */
+/*                                                                    */
+/*      gpu_timer_begin("gpu: main pass");                            */
+/*      sg_begin_pass(...); ... sg_end_pass();                        */
+/*      gpu_timer_end();                                              */
+/*                                                                    */
+/*  Queries rotate through GPU_TIMER_FRAMES sets and are only read    */
+/*  once the GPU says they are done, so nothing ever waits. Results   */
+/*  lag a few frames. Without the GL backend (D3D11, Metal, dummy)    */
+/*  passes are still tracked and report 0 ms.                         */
+/* ------------------------------------------------------------------ */
+typedef struct gpu_timer_pass {
+    const char *name;           // as given to gpu_timer_begin (a literal)
+    double      ms;
+} gpu_timer_pass;
+
+void gpu_timer_setup(void);     // after sg_setup()
+void gpu_timer_shutdown(void);  // before sg_shutdown()
+
+/* top of frame(): picks up the results of finished frames */
+void gpu_timer_new_frame(void);
+
+/* one pass at a time, GL time queries don't nest */
+void gpu_timer_begin(const char *name);
+void gpu_timer_end(void);
+
+/* the newest frame whose queries are done */
+int    gpu_timer_results(gpu_timer_pass *out, int max);
+double gpu_timer_frame_ms(void);
+bool   gpu_timer_measuring(void);   // false: results are always 0
@@ -0,0 +1,25 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ------------------------------------------------------------------ */
+/*  In-game log console: keeps the last lines written by custom_log   */
+/*  (string arena + line index ring) and draws them with a list       */
+/*  clipper, so millions of lines cost only the visible rows          */
+/*                                                                    */
+/*  The defaults keep ~256K lines; the demo's --log-mb=320 sizes it   */
+/*  for 5M (320 MB of ~64-byte lines, an 8M-entry index)              */
+/* ------------------------------------------------------------------ */
+typedef struct log_console_desc {
+    size_t arena_bytes;         // text kept, oldest lines evicted (default 16 MB)
+    size_t max_lines;           // line index entries, power of two (default 256K)
+} log_console_desc;
+
+/* after custom_log_setup(); NULL desc = defaults */
+void log_console_setup(const log_console_desc *desc);
+
+/* after custom_log_shutdown(), once the writer thread is gone */
+void log_console_shutdown(void);
+
+/* between simgui_new_frame() and simgui_render() */
+void log_console_window(bool *open);
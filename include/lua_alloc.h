@@ -0,0 +1,34 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/* ------------------------------------------------------------------ */
+/*  lua_alloc – lua_Alloc replacement for lua_newstate()               */
+/*                                                                     */
+/*  Requests up to 256 bytes come from per-size-class free lists       */
+/*  (16 byte steps), larger ones from a TLSF heap. Both live in big    */
+/*  areas taken from the system, so steady-state Lua code never hits   */
+/*  malloc/realloc. One instance per lua_State – not thread-safe.      */
+/* ------------------------------------------------------------------ */
+typedef struct lua_alloc_t lua_alloc_t;
+
+typedef struct lua_alloc_stats_t {
+    size_t   current_bytes;     // live bytes as seen by Lua
+    size_t   peak_bytes;
+    size_t   reserved_bytes;    // system memory held by the heap areas
+    uint64_t total_allocs;      // alloc/realloc requests since creation
+    uint64_t total_frees;
+    uint32_t frame_allocs;      // requests during the last completed frame
+    uint32_t frame_frees;
+    size_t   frame_bytes;       // bytes requested during the last frame
+} lua_alloc_stats_t;
+
+lua_alloc_t* lua_alloc_create(void);
+void lua_alloc_destroy(lua_alloc_t *a);   // frees every area at once
+
+/* pass as lua_newstate(lua_alloc_fn, a) */
+void* lua_alloc_fn(void *ud, void *ptr, size_t osize, size_t nsize);
+
+/* close the current frame's counters (call once per frame) */
+void lua_alloc_new_frame(lua_alloc_t *a);
+lua_alloc_stats_t lua_alloc_get_stats(const lua_alloc_t *a);
@@ -0,0 +1,29 @@
+#pragma once
+#include <stddef.h>
+#include "vecmath/vecmath.h"
+
+/* ------------------------------------------------------------------ */
+/*  Bulk math over structure-of-arrays float streams. Plain loops with */
+/*  no cross-iteration dependencies so the compiler can vectorise      */
+/*  them; outputs may alias inputs element for element.               */
+/* ------------------------------------------------------------------ */
+
+/* (ox,oy,oz)[i] = (xs,ys,zs)[i] * m  (row vector, w = 1) */
+void kernel_transform_points(const mat44_t *m,
+                             const float *xs, const float *ys, const float *zs,
+                             float *ox, float *oy, float *oz, size_t n);
+
+/* out[i] = a[i] + (b[i] - a[i]) * t */
+void kernel_lerp(float *out, const float *a, const float *b, float t, size_t n);
+
+/* out[i] = a[i] + (b[i] - a[i]) * t[i] */
+void kernel_lerp_array(float *out, const float *a, const float *b, const float *t, size_t n);
+
+/* out[i] = a[i] + b[i] * s   (e.g. pos += vel * dt) */
+void kernel_madd(float *out, const float *a, const float *b, float s, size_t n);
+
+/* out[i] = scale * rotation(quat) * translation, like mat44_decompose in reverse */
+void kernel_model_matrices(mat44_t *out,
+                           const float *px, const float *py, const float *pz,
+                           const float *qx, const float *qy, const float *qz, const float *qw,
+                           const float *sx, const float *sy, const float *sz, size_t n);
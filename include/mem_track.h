@@ -0,0 +1,60 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ------------------------------------------------------------------ */
+/*  mem_track – malloc wrapper that charges every block to a          */
+/*  subsystem: live/peak bytes and allocation rates per tag, plus an  */
+/*  optional list of live blocks for a leak report at exit.           */
+/*                                                                    */
+/*  The sokol libraries and ImGui take it through their allocator     */
+/*  structs (mem_track_alloc_cb / mem_track_free_cb with the tag as   */
+/*  user_data, see MEM_TRACK_USER), stb_image through STBI_MALLOC,    */
+/*  lua_alloc for its heap areas. Thread-safe.                        */
+/* ------------------------------------------------------------------ */
+typedef enum mem_tag {
+    MEM_TAG_GFX,                // sokol_gfx
+    MEM_TAG_FETCH,              // sokol_fetch
+    MEM_TAG_IMGUI,              // Dear ImGui + sokol_imgui
+    MEM_TAG_LUA,                // lua_alloc heap areas (main state and job workers)
+    MEM_TAG_IMAGE,              // stb_image
+    MEM_TAG_NUM,
+} mem_tag;
+
+typedef struct mem_tag_stats {
+    const char *name;
+    size_t      current_bytes;
+    size_t      peak_bytes;
+    uint64_t    total_allocs;
+    uint64_t    total_frees;
+    float       allocs_per_second;  // over the last mem_track_new_frame() interval
+    float       frees_per_second;
+} mem_tag_stats;
+
+/* tag as the user_data of a sokol/ImGui allocator */
+#define MEM_TRACK_USER(tag) ((void*)(uintptr_t)(tag))
+
+void* mem_track_alloc(mem_tag tag, size_t size);
+void* mem_track_realloc(mem_tag tag, void *ptr, size_t size);
+void  mem_track_free(void *ptr);       // any tag, NULL is fine
+
+void* mem_track_alloc_cb(size_t size, void *user_data);
+void  mem_track_free_cb(void *ptr, void *user_data);
+
+/* first thing in init(), before any tracked allocation.
+   capture_sites: keep every live block listed for mem_track_report_leaks(),
+   with a few frames of the allocating call stack (costs a backtrace per alloc) */
+void mem_track_setup(bool capture_sites);
+
+/* once per frame, updates the rates */
+void mem_track_new_frame(double frame_seconds);
+
+mem_tag_stats mem_track_stats(mem_tag tag);
+
+/* last thing in cleanup(): prints what is still allocated, per tag
+   (and per block with capture_sites); returns the number of live blocks */
+uint64_t mem_track_report_leaks(void);
+
+/* between simgui_new_frame() and simgui_render() */
+void mem_track_window(bool *open);
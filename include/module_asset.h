@@ -0,0 +1,13 @@
+#pragma once
+#include "lua.h"
+#include "lauxlib.h"
+
+/* ------------------------------------------------------------------ */
+/*  Register the global `asset` table and set up sokol_fetch          */
+/*  (call once after gfx_module_init)                                 */
+/* ------------------------------------------------------------------ */
+void asset_module_init(lua_State *L);
+
+/* once per frame: pump sokol_fetch, resumes finished coroutines */
+void asset_module_update(void);
+void asset_module_shutdown(void);
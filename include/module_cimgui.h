@@ -9,6 +9,8 @@
 void cimgui_module_init(lua_State *L);
 
 /* ------------------------------------------------------------------ */
-/*  Called every frame – draws the UI that lives in Lua (_render)      */
+/*  Called every frame – draws the UI that lives in Lua (_render).     */
+/*  alpha: fraction of a fixed step since the last _update, for        */
+/*  interpolating between the previous and current simulation state.   */
 /* ------------------------------------------------------------------ */
-void cimgui_module_frame(void);
\ No newline at end of file
+void cimgui_module_frame(double alpha);
\ No newline at end of file
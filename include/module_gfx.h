@@ -0,0 +1,30 @@
+#pragma once
+#include "lua.h"
+#include "lauxlib.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* ------------------------------------------------------------------ */
+/*  Register the global `gfx` table (call once after sg_setup and     */
+/*  lua_module_init)                                                  */
+/* ------------------------------------------------------------------ */
+void gfx_module_init(lua_State *L);
+
+/* draw the Lua draw list – call inside the swapchain pass */
+void gfx_module_draw(void);
+void gfx_module_shutdown(void);
+
+/* RGBA8 texture for the draw list → texture handle, 0 when full */
+int gfx_add_texture(int width, int height, const void *rgba);
+
+/* ------------------------------------------------------------------ */
+/*  gfx.buffer – raw 16-byte aligned memory owned by a Lua userdata.  */
+/*  `used` is the write cursor of the push_* methods.                 */
+/* ------------------------------------------------------------------ */
+typedef struct gfx_buffer_t {
+    size_t   size;
+    size_t   used;
+    uint8_t *data;
+} gfx_buffer_t;
+
+gfx_buffer_t* gfx_check_buffer(lua_State *L, int idx);
@@ -0,0 +1,17 @@
+#pragma once
+#include "lua.h"
+#include "lauxlib.h"
+#include "sokol_app.h"
+#include <stdbool.h>
+
+/* ------------------------------------------------------------------ */
+/*  Register the global `input` table (KEY_*, MOUSE_*, MOD_* codes)   */
+/*  and the reusable event userdata handed to the script's _event(e)  */
+/* ------------------------------------------------------------------ */
+void input_module_init(lua_State *L);
+
+/* from the sapp event callback – ui: imgui consumed it */
+void input_module_event(const sapp_event *ev, bool ui);
+
+/* once per frame, before _update: call _event(e) for the queued events */
+void input_module_dispatch(void);
@@ -0,0 +1,14 @@
+#pragma once
+#include "lua.h"
+#include "lauxlib.h"
+
+/* ------------------------------------------------------------------ */
+/*  Register the global `jobs` table – a pool of worker threads, each */
+/*  with its own lua_State (base libs + vmath) running one script.    */
+/*  Jobs and results travel as serialized messages through lock-free  */
+/*  queues; results are polled on the main thread.                    */
+/* ------------------------------------------------------------------ */
+void jobs_module_init(lua_State *L);
+
+/* stops and joins the workers, drops queued jobs and results */
+void jobs_module_shutdown(void);
@@ -2,10 +2,14 @@
 #include "lua.h"
 #include "lauxlib.h"
 #include "lualib.h"
+#include "lua_alloc.h"
+#include <stdbool.h>
+#include <stdint.h>
 
 /* Initialise Lua, load script.lua and expose our C function */
 void lua_module_init(void); // create state, open libs
 int  load_script(const char *filename);  // load+run if file exists
+void lua_module_poll_reload(void);       // once per frame: re-run changed scripts
 
 /* The C function that Lua will call */
 int test_call(lua_State *L);
@@ -13,5 +17,35 @@ void lua_module_frame(void); // ImGui button
 
 void lua_module_shutdown(void);  // clean up
 
+/* allocator statistics of the Lua state */
+void lua_module_new_frame(void);                 // close the frame's counters
+lua_alloc_stats_t lua_module_alloc_stats(void);  // last frame + totals
+
+/* frame-budgeted garbage collection */
+typedef struct lua_gc_stats_t {
+    double   frame_ms;          // time spent in GC slices last frame
+    double   frame_worst_ms;    // longest single slice last frame
+    uint32_t frame_steps;
+    double   total_ms;
+    double   worst_ms;          // longest slice since init
+    bool     generational;      // memory pressure fallback active
+} lua_gc_stats_t;
+
+void lua_module_gc_step(double frame_duration);  // after sg_commit(), seconds
+lua_gc_stats_t lua_module_gc_stats(void);
+
+/* fixed-step simulation: _update(dt) zero or more times per frame */
+double lua_module_update_hz(double fallback);    // script's UPDATE_HZ or fallback
+bool   lua_module_has_update(void);
+bool   lua_module_update(double dt);             // false when missing or on error
+
+/* sampling profiler – no hook on the main thread while disabled; coroutines
+   created while enabled remove theirs on their next sample, coroutines
+   created before enable are not sampled */
+void lua_module_profiler_enable(bool enable, int interval);   // interval: VM instructions, 0 = keep
+void lua_module_profiler_reset(void);
+int  lua_module_profiler_dump(const char *path);             // collapsed stacks for flamegraphs
+void lua_module_profiler_window(bool *open);                 // ImGui top-N table
+
 /* safe way for other modules to obtain the state */
 lua_State* get_lua_state(void);      /* returns NULL if not initialised */
\ No newline at end of file
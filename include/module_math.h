@@ -0,0 +1,33 @@
+#pragma once
+#include "lua.h"
+#include "lauxlib.h"
+#include "vecmath/vecmath.h"
+
+/* ------------------------------------------------------------------ */
+/*  Register the global `vmath` table and the vec2/vec3/vec4/mat44     */
+/*  userdata metatables (call once after lua_module_init)             */
+/* ------------------------------------------------------------------ */
+void math_module_init(lua_State *L);
+
+/* ------------------------------------------------------------------ */
+/*  Fast paths for other bridges – NULL when the value at idx is not  */
+/*  that userdata type                                                */
+/* ------------------------------------------------------------------ */
+vec2_t*  math_test_vec2(lua_State *L, int idx);
+vec3_t*  math_test_vec3(lua_State *L, int idx);
+vec4_t*  math_test_vec4(lua_State *L, int idx);
+mat44_t* math_test_mat44(lua_State *L, int idx);
+
+/* data of a vmath.floats array (raises a Lua error otherwise) */
+float* math_check_floats(lua_State *L, int idx, size_t *count);
+float* math_test_floats(lua_State *L, int idx, size_t *count);   // NULL if not one
+
+/* new uninitialised vmath.floats array of count elements */
+float* math_push_floats(lua_State *L, size_t count);
+
+/* floats array aliasing data, keeps the value at owner_idx alive */
+void math_push_floats_view(lua_State *L, float *data, size_t count, int owner_idx);
+
+/* push a new userdata copy */
+void math_push_vec3(lua_State *L, vec3_t v);
+void math_push_mat44(lua_State *L, mat44_t m);
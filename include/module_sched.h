@@ -0,0 +1,16 @@
+#pragma once
+#include "lua.h"
+#include "lauxlib.h"
+
+/* ------------------------------------------------------------------ */
+/*  Register the global `sched` table – sleep/after/every timers kept */
+/*  in a min-heap of wake times (stm_now ticks)                       */
+/* ------------------------------------------------------------------ */
+void sched_module_init(lua_State *L);
+
+/* once per frame: resume/call only the tasks that are due */
+void sched_module_update(void);
+
+/* before a script (re)runs: cancels everything the last run queued */
+void sched_module_reset(void);
+void sched_module_shutdown(void);
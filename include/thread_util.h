@@ -0,0 +1,43 @@
+#pragma once
+#include <stdbool.h>
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/* ------------------------------------------------------------------ */
+/*  thread_util – just enough of Win32 / pthreads for worker threads  */
+/*  (job pool, async log writer)                                      */
+/* ------------------------------------------------------------------ */
+#if defined(_WIN32)
+typedef HANDLE             thread_t;
+typedef SRWLOCK            mutex_t;
+typedef CONDITION_VARIABLE cond_t;
+#else
+typedef pthread_t          thread_t;
+typedef pthread_mutex_t    mutex_t;
+typedef pthread_cond_t     cond_t;
+#endif
+
+typedef void (*thread_fn)(void *arg);
+
+bool thread_start(thread_t *t, thread_fn fn, void *arg);
+void thread_join(thread_t t);
+void thread_yield(void);
+void thread_sleep_ms(int ms);
+int  thread_cpu_count(void);
+
+void mutex_init(mutex_t *m);
+void mutex_destroy(mutex_t *m);
+void mutex_lock(mutex_t *m);
+void mutex_unlock(mutex_t *m);
+
+void cond_init(cond_t *c);
+void cond_destroy(cond_t *c);
+void cond_wait(cond_t *c, mutex_t *m);
+void cond_signal(cond_t *c);
+void cond_broadcast(cond_t *c);
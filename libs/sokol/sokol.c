@@ -16,6 +16,9 @@
 #include "sokol_gfx.h"
 #include "sokol_log.h"
 #include "sokol_glue.h"
+#include "sokol_time.h"
+#include "sokol_fetch.h"
+#include "sokol_args.h"
 #define CIMGUI_DEFINE_ENUMS_AND_STRUCTS
 #include "cimgui.h"
 #define SOKOL_IMGUI_IMPL
@@ -1,4 +1,8 @@
 #define STB_IMAGE_IMPLEMENTATION
+#include "mem_track.h"
+#define STBI_MALLOC(sz)         mem_track_alloc(MEM_TAG_IMAGE, sz)
+#define STBI_REALLOC(p, newsz)  mem_track_realloc(MEM_TAG_IMAGE, p, newsz)
+#define STBI_FREE(p)            mem_track_free(p)
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wunused-function"
@@ -8,6 +8,9 @@ set "BUILDRES=build\resources"
 xcopy "%BASERES%" "%BUILDRES%\" /E /I /Y
 
 copy "script.lua" "build/script.lua"
+copy "bench_ui.lua" "build/bench_ui.lua"
+copy "scene.lua" "build/scene.lua"
+copy "worker.lua" "build/worker.lua"
 
 if not exist build mkdir build
 cd build
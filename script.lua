@@ -3,12 +3,28 @@ print("Lua script loaded!")
 
 print(imgui)
 
+local win_pos  = vmath.vec2(10, 10)     -- created once, no table per frame
+local win_size = vmath.vec2(500, 200)
+
+-- timers instead of counting frames in _render(); a reload cancels the old ones
+local seconds = 0
+sched.every(1.0, function() seconds = seconds + 1 end)
+
+local status = ""
+coroutine.wrap(function()
+    while true do
+        status = "tick"; sched.sleep(0.5)
+        status = "tock"; sched.sleep(0.5)
+    end
+end)()
+
 function _render()
-    imgui.SetNextWindowPos({10, 10}, "Once")
-    imgui.SetNextWindowSize({500, 200}, "Once")
+    imgui.SetNextWindowPos(win_pos, imgui.Cond_Once)
+    imgui.SetNextWindowSize(win_size, imgui.Cond_Once)
 
     if imgui.BeginWindow("My Lua Window") then
         imgui.Text("Hello from Lua!")
+        imgui.Text(string.format("%d s  %s", seconds, status))
         if imgui.Button("Click me!") then
             print("Button pressed in Lua → C")
             hello_world()          -- calls the C test_call()
@@ -5,9 +5,459 @@
    ------------------------------------------------------------- */
 
 #include "custom_log.h"
+#include "custom_log_format.h"
+#include "thread_util.h"
+#include "sokol_time.h"
+#include <stdatomic.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
+#include <signal.h>
+
+#if defined(_MSC_VER)
+#define LOG_THREAD_LOCAL __declspec(thread)
+#else
+#define LOG_THREAD_LOCAL _Thread_local
+#endif
+
+#define LOG_RING_SIZE       4096            // text slots, power of two
+#define LOG_MSG_SIZE        224             // formatted message in the slot, longer ones are malloc'd
+#define LOG_TAG_SIZE        16
+#define LOG_THREAD_BUF_SIZE (256 * 1024)    // binary bytes per producer thread, power of two
+#define LOG_PAYLOAD_MAX     1024            // argument bytes of one binary record
+#define LOG_STR_MAX         256             // longer %s turn a binary record into a TEXT one
+#define LOG_IDLE_MS         2               // writer sleep when the rings are empty
+#define LOG_CRASH_WAIT_MS   500             // how long a crash waits for the writer
+#define LOG_DEFAULT_BYTES   (4 * 1024 * 1024)
+#define LOG_DEFAULT_FILES   3
+#define LOG_MAX_TAGS        128
+#define LOG_LINE_SIZE       1024            // composed line incl. header
+
+/* -----------------------------------------------------------------
+   Text ring – producers claim a slot with one CAS on head and
+   publish it through the slot's sequence number; the writer thread
+   is the only consumer. A full ring drops the message and counts it.
+   ----------------------------------------------------------------- */
+typedef struct log_slot_t {
+    atomic_size_t seq;
+    uint64_t      time;                 // stm_now() at the call
+    const char*   file;                 // __FILE__, a literal
+    uint32_t      line;
+    uint32_t      level;
+    char          tag[LOG_TAG_SIZE];
+    char          msg[LOG_MSG_SIZE];
+    char*         long_msg;             // whole message when it did not fit, freed by the writer
+} log_slot_t;
+
+/* -----------------------------------------------------------------
+   Binary mode – each producer thread owns a byte ring (SPSC), so a
+   record is a header plus the raw argument bytes, no atomics beyond
+   the head store. Records never straddle the end of the ring.
+   ----------------------------------------------------------------- */
+typedef struct log_record_t {
+    uint32_t         size;              // whole record, 8-byte multiple
+    uint32_t         payload;           // argument bytes, LOG_RECORD_PAD = skip
+    custom_log_site* site;
+    uint64_t         time;
+    uint32_t         thread_id;         // the owner when written – a buffer changes owner
+} log_record_t;
+
+#define LOG_RECORD_PAD  0xffffffffu
+
+typedef struct log_thread_buf_t {
+    alignas(64) atomic_size_t head;     // owner thread
+    alignas(64) atomic_size_t tail;     // writer thread
+    uint32_t                 thread_id;
+    atomic_bool              released;  // owner exited, the next new thread takes it over
+    struct log_thread_buf_t* next;
+    alignas(8) uint8_t       data[LOG_THREAD_BUF_SIZE];
+} log_thread_buf_t;
+
+static LOG_THREAD_LOCAL log_thread_buf_t* tls_buf;
+
+static struct {
+    atomic_bool          running;
+    atomic_bool          quit;
+    bool                 binary;
+    log_slot_t           ring[LOG_RING_SIZE];
+    alignas(64) atomic_size_t head;     // next slot to claim
+    alignas(64) atomic_size_t tail;     // next slot to write (writer only)
+    _Atomic(log_thread_buf_t*) threads; // every buffer ever created, reused after thread exit
+    atomic_uint          next_thread;
+    atomic_uint_fast64_t dropped;
+    uint64_t             dropped_reported;
+    thread_t             thread;
+    FILE*                out;
+    custom_log_desc      desc;
+    size_t               file_bytes;
+    uint32_t             file_gen;      // bumped per (rotated) binary file
+    uint32_t             next_site;
+    _Atomic(custom_log_sink_fn) sink;   // extra consumer of finished lines
+    void*                sink_user;
+} lg;
+
+static void sync_log(const char* tag, uint32_t level, const char* msg, uint32_t line, const char* file)
+{
+    /* Forward to sokol's logger – the last argument is reserved for future use */
+    slog_func(tag, level, 0, msg, line, file, NULL);
+}
+
+/* sokol logger callback: sokol's levels are ours, 0 (panic) keeps slog_func's abort */
+void custom_log_slog(const char* tag, uint32_t log_level, uint32_t log_item, const char* message,
+                     uint32_t line, const char* filename, void* user_data)
+{
+    (void)user_data;
+    if (log_level == 0) {
+        custom_log_flush();
+        slog_func(tag, log_level, log_item, message, line, filename, NULL);
+        return;
+    }
+    if (message) _custom_log(tag ? tag : "sokol", log_level, "%s", line, filename, message);
+    else         _custom_log(tag ? tag : "sokol", log_level, "item %u", line, filename, log_item);
+}
+
+static void log_text(const char* tag, uint32_t level, const char* fmt, uint32_t line,
+                     const char* file, va_list ap)
+{
+    if (!atomic_load_explicit(&lg.running, memory_order_acquire)) {
+        char buffer[1024];
+        vsnprintf(buffer, sizeof(buffer), fmt, ap);
+        sync_log(tag, level, buffer, line, file);
+        return;
+    }
+
+    size_t pos = atomic_load_explicit(&lg.head, memory_order_relaxed);
+    log_slot_t* s;
+    for (;;) {
+        s = &lg.ring[pos & (LOG_RING_SIZE - 1)];
+        size_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&lg.head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            atomic_fetch_add_explicit(&lg.dropped, 1, memory_order_relaxed);
+            return;                         // full – never wait for the writer
+        } else {
+            pos = atomic_load_explicit(&lg.head, memory_order_relaxed);
+        }
+    }
+
+    s->time  = stm_now();
+    s->file  = file;
+    s->line  = line;
+    s->level = level;
+    snprintf(s->tag, sizeof(s->tag), "%s", tag ? tag : "");
+    va_list again;
+    va_copy(again, ap);
+    int n = vsnprintf(s->msg, sizeof(s->msg), fmt, ap);
+    s->long_msg = NULL;
+    if (n >= (int)sizeof(s->msg)) {         // e.g. a Lua traceback – keep all of it
+        s->long_msg = (char*)malloc((size_t)n + 1);
+        if (s->long_msg) vsnprintf(s->long_msg, (size_t)n + 1, fmt, again);
+    }
+    va_end(again);
+    atomic_store_explicit(&s->seq, pos + 1, memory_order_release);
+}
+
+/* a reused buffer gets a fresh thread_id – records of the old owner may
+   still be queued in front of the new owner's, so each record carries its own */
+static log_thread_buf_t* thread_buf(void)
+{
+    if (tls_buf) return tls_buf;
+    for (log_thread_buf_t* b = atomic_load(&lg.threads); b; b = b->next) {
+        bool expected = true;
+        if (atomic_load_explicit(&b->released, memory_order_relaxed) &&
+            atomic_compare_exchange_strong(&b->released, &expected, false)) {
+            b->thread_id = atomic_fetch_add(&lg.next_thread, 1) + 1;
+            return tls_buf = b;
+        }
+    }
+    log_thread_buf_t* b = (log_thread_buf_t*)calloc(1, sizeof(*b));
+    if (!b) return NULL;
+    b->thread_id = atomic_fetch_add(&lg.next_thread, 1) + 1;
+    b->next = atomic_load(&lg.threads);
+    while (!atomic_compare_exchange_weak(&lg.threads, &b->next, b)) {}
+    return tls_buf = b;
+}
+
+/* what one va_arg read of a binary call site is, from fmt */
+enum {
+    ARG_INT, ARG_LONG, ARG_LLONG, ARG_INTMAX, ARG_SSIZE, ARG_PTRDIFF,
+    ARG_UINT, ARG_ULONG, ARG_ULLONG, ARG_UINTMAX, ARG_SIZE, ARG_UPTRDIFF,
+    ARG_DOUBLE, ARG_LDOUBLE, ARG_PTR, ARG_STR, ARG_WSTR, ARG_SKIP_PTR,
+};
+
+/* argument kinds of fmt, -1 past CUSTOM_LOG_MAX_ARGS */
+static int parse_args(const char* fmt, uint8_t* kinds)
+{
+    int n = 0;
+    clog_spec sp;
+    for (const char* p = fmt; (p = clog_next_spec(p, &sp)); ) {
+        if (n + sp.stars + 1 > CUSTOM_LOG_MAX_ARGS) return -1;
+        for (int i = 0; i < sp.stars; i++) kinds[n++] = ARG_INT;
+        const char* len = sp.length;
+        int wide = !strcmp(len, "l") ? 1 : !strcmp(len, "ll") ? 2 : !strcmp(len, "j") ? 3
+                 : !strcmp(len, "z") ? 4 : !strcmp(len, "t") ? 5 : 0;
+        switch (sp.arg) {
+        case CLOG_ARG_INT:    kinds[n++] = (uint8_t)(ARG_INT + wide); break;
+        case CLOG_ARG_UINT:   kinds[n++] = (uint8_t)(ARG_UINT + wide); break;
+        case CLOG_ARG_DOUBLE: kinds[n++] = len[0] == 'L' ? ARG_LDOUBLE : ARG_DOUBLE; break;
+        case CLOG_ARG_PTR:    kinds[n++] = ARG_PTR; break;
+        case CLOG_ARG_STR:    kinds[n++] = len[0] == 'l' ? ARG_WSTR : ARG_STR; break;
+        case CLOG_ARG_NONE:   if (sp.conv == 'n') kinds[n++] = ARG_SKIP_PTR; break;
+        }
+    }
+    return n;
+}
+
+/* the site's cached kinds; the first call parses and publishes them, a
+   call racing it parses into `local` */
+static int site_args(custom_log_site* site, uint8_t* local, const uint8_t** kinds)
+{
+    uint32_t state = atomic_load_explicit(&site->num_args, memory_order_acquire);
+    if (state >= 2) {
+        *kinds = site->args;
+        return (int)state - 2;
+    }
+    int n = parse_args(site->fmt, local);
+    *kinds = local;
+    uint32_t expected = 0;
+    if (n >= 0 && atomic_compare_exchange_strong(&site->num_args, &expected, 1)) {
+        memcpy(site->args, local, (size_t)n);
+        atomic_store_explicit(&site->num_args, (uint32_t)n + 2, memory_order_release);
+    }
+    return n;
+}
+
+/* copy the arguments as the site's kinds say, then the record into the
+   thread's ring; false when they don't fit a record – the caller logs it as text */
+static bool log_binary(custom_log_site* site, va_list* ap)
+{
+    uint8_t local[CUSTOM_LOG_MAX_ARGS];
+    const uint8_t* kinds;
+    int num = site_args(site, local, &kinds);
+    if (num < 0) return false;
+
+    uint8_t payload[LOG_PAYLOAD_MAX];
+    size_t n = 0;
+    bool overflow = false;
+
+#define PUT(v) do { if (n + 8 > sizeof(payload)) overflow = true; \
+                    else { memcpy(payload + n, &(v), 8); n += 8; } } while (0)
+
+    for (int a = 0; a < num && !overflow; a++) {
+        switch (kinds[a]) {
+        case ARG_INT:      { int64_t v = va_arg(*ap, int);                 PUT(v); } break;
+        case ARG_LONG:     { int64_t v = va_arg(*ap, long);                PUT(v); } break;
+        case ARG_LLONG:    { int64_t v = va_arg(*ap, long long);           PUT(v); } break;
+        case ARG_INTMAX:   { int64_t v = va_arg(*ap, intmax_t);            PUT(v); } break;
+        case ARG_SSIZE:    { int64_t v = (int64_t)va_arg(*ap, size_t);     PUT(v); } break;
+        case ARG_PTRDIFF:  { int64_t v = va_arg(*ap, ptrdiff_t);           PUT(v); } break;
+        case ARG_UINT:     { uint64_t v = va_arg(*ap, unsigned int);       PUT(v); } break;
+        case ARG_ULONG:    { uint64_t v = va_arg(*ap, unsigned long);      PUT(v); } break;
+        case ARG_ULLONG:   { uint64_t v = va_arg(*ap, unsigned long long); PUT(v); } break;
+        case ARG_UINTMAX:  { uint64_t v = va_arg(*ap, uintmax_t);          PUT(v); } break;
+        case ARG_SIZE:     { uint64_t v = va_arg(*ap, size_t);             PUT(v); } break;
+        case ARG_UPTRDIFF: { uint64_t v = (uint64_t)va_arg(*ap, ptrdiff_t); PUT(v); } break;
+        case ARG_DOUBLE:   { double v = va_arg(*ap, double);               PUT(v); } break;
+        case ARG_LDOUBLE:  { double v = (double)va_arg(*ap, long double);  PUT(v); } break;
+        case ARG_PTR:      { uint64_t v = (uint64_t)(uintptr_t)va_arg(*ap, void*); PUT(v); } break;
+        case ARG_SKIP_PTR: (void)va_arg(*ap, void*); break;
+        case ARG_STR:
+        case ARG_WSTR: {
+            const char* s = kinds[a] == ARG_WSTR ? "(wide)" : va_arg(*ap, const char*);
+            if (kinds[a] == ARG_WSTR) (void)va_arg(*ap, void*);
+            size_t sl = s ? strlen(s) : 0;
+            if (sl > LOG_STR_MAX) { overflow = true; break; }
+            uint16_t l16 = s ? (uint16_t)sl : (uint16_t)CLOG_STR_NULL;
+            if (n + 2 + sl > sizeof(payload)) { overflow = true; break; }
+            memcpy(payload + n, &l16, 2);
+            memcpy(payload + n + 2, s, sl);
+            n += 2 + sl;
+        } break;
+        }
+    }
+#undef PUT
+
+    if (overflow) return false;
+    log_thread_buf_t* b = thread_buf();
+    if (!b) {
+        atomic_fetch_add_explicit(&lg.dropped, 1, memory_order_relaxed);
+        return true;
+    }
+
+    size_t size = (sizeof(log_record_t) + n + 7) & ~(size_t)7;
+    size_t head = atomic_load_explicit(&b->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&b->tail, memory_order_acquire);
+    size_t off = head & (LOG_THREAD_BUF_SIZE - 1);
+    size_t to_end = LOG_THREAD_BUF_SIZE - off;
+    size_t skip = to_end < size ? to_end : 0;
+    if (head - tail + skip + size > LOG_THREAD_BUF_SIZE) {
+        atomic_fetch_add_explicit(&lg.dropped, 1, memory_order_relaxed);
+        return true;
+    }
+    if (skip) {
+        if (skip >= sizeof(log_record_t)) {
+            log_record_t pad = { (uint32_t)skip, LOG_RECORD_PAD, NULL, 0, 0 };
+            memcpy(b->data + off, &pad, sizeof(pad));
+        }
+        head += skip;
+        off = 0;
+    }
+    log_record_t rec = { (uint32_t)size, (uint32_t)n, site, stm_now(), b->thread_id };
+    memcpy(b->data + off, &rec, sizeof(rec));
+    memcpy(b->data + off + sizeof(rec), payload, n);
+    atomic_store_explicit(&b->head, head + size, memory_order_release);
+    return true;
+}
+
+/* -----------------------------------------------------------------
+   Tag registry – one entry per tag, resolved once per call site and
+   cached in its static descriptor. A call is dropped here, before
+   any formatting, when the tag's level, sampling or rate limit
+   (GCRA form of a token bucket: one atomic "theoretical arrival
+   time") says so.
+   ----------------------------------------------------------------- */
+struct custom_log_tag {
+    char                 name[LOG_TAG_SIZE];
+    uint32_t             hash;
+    atomic_int           level;             // -1: the default level
+    atomic_uint          sample;            // keep 1 in N, 0/1 = all
+    atomic_uint          sample_count;
+    atomic_uint_fast64_t interval_ns;       // 1e9 / rate, 0 = unlimited
+    atomic_uint_fast64_t burst_ns;          // (burst - 1) * interval
+    atomic_uint_fast64_t tat;               // next conforming time, ns
+    atomic_uint_fast64_t suppressed;        // filtered by sampling/rate
+};
+
+static custom_log_tag log_tags[LOG_MAX_TAGS];
+static int            log_num_tags;
+static custom_log_tag log_tag_overflow = { .name = "(overflow)", .level = -1 };   // tags past LOG_MAX_TAGS
+static atomic_flag    log_tags_lock = ATOMIC_FLAG_INIT;
+static atomic_int     log_default_level = CUSTOM_LOG_LEVEL;
+
+static uint32_t tag_hash(const char* s)
+{
+    uint32_t h = 2166136261u;           // FNV-1a
+    for (; *s; s++) h = (h ^ (uint8_t)*s) * 16777619u;
+    return h;
+}
+
+/* existing or new entry – once the table is full, new tags share
+   log_tag_overflow, which the setters refuse to change */
+static custom_log_tag* tag_lookup(const char* name)
+{
+    if (!name || !name[0]) name = "(none)";    // stored and compared under the same name
+    uint32_t h = tag_hash(name);
+    while (atomic_flag_test_and_set_explicit(&log_tags_lock, memory_order_acquire)) thread_yield();
+
+    custom_log_tag* t = NULL;
+    for (int i = 0; i < log_num_tags; i++) {
+        if (log_tags[i].hash == h && strncmp(log_tags[i].name, name, LOG_TAG_SIZE - 1) == 0) {
+            t = &log_tags[i];
+            break;
+        }
+    }
+    if (!t && log_num_tags < LOG_MAX_TAGS) {
+        t = &log_tags[log_num_tags++];
+        snprintf(t->name, sizeof(t->name), "%s", name);
+        t->hash = h;
+        atomic_store(&t->level, -1);
+    }
+    if (!t) t = &log_tag_overflow;
+    atomic_flag_clear_explicit(&log_tags_lock, memory_order_release);
+    return t;
+}
+
+static bool tag_allows(custom_log_tag* t, uint32_t level)
+{
+    int max = atomic_load_explicit(&t->level, memory_order_relaxed);
+    if (max < 0) max = atomic_load_explicit(&log_default_level, memory_order_relaxed);
+    if ((int)level > max) return false;
+
+    unsigned n = atomic_load_explicit(&t->sample, memory_order_relaxed);
+    if (n > 1 && atomic_fetch_add_explicit(&t->sample_count, 1, memory_order_relaxed) % n != 0) {
+        atomic_fetch_add_explicit(&t->suppressed, 1, memory_order_relaxed);
+        return false;
+    }
+
+    uint64_t interval = atomic_load_explicit(&t->interval_ns, memory_order_relaxed);
+    if (interval) {
+        uint64_t burst = atomic_load_explicit(&t->burst_ns, memory_order_relaxed);
+        uint64_t now = stm_ns(stm_now());
+        uint64_t tat = atomic_load_explicit(&t->tat, memory_order_relaxed);
+        for (;;) {
+            if (tat > now + burst) {
+                atomic_fetch_add_explicit(&t->suppressed, 1, memory_order_relaxed);
+                return false;
+            }
+            uint64_t next = (tat > now ? tat : now) + interval;
+            if (atomic_compare_exchange_weak_explicit(&t->tat, &tat, next,
+                    memory_order_relaxed, memory_order_relaxed)) break;
+        }
+    }
+    return true;
+}
+
+/* setter target, NULL when the tag did not fit – changing the shared
+   overflow entry would silently retune every other overflowed tag */
+static custom_log_tag* tag_for_setter(const char* tag)
+{
+    custom_log_tag* t = tag_lookup(tag);
+    if (t != &log_tag_overflow) return t;
+    fprintf(stderr, "[LOG] tag '%s' ignored: more than %d tags\n", tag, LOG_MAX_TAGS);
+    return NULL;
+}
+
+void custom_log_set_level(const char* tag, int level)
+{
+    if (!tag) {
+        atomic_store(&log_default_level, level);
+        return;
+    }
+    custom_log_tag* t = tag_for_setter(tag);
+    if (t) atomic_store(&t->level, level);
+}
+
+void custom_log_set_rate(const char* tag, float per_second, int burst)
+{
+    custom_log_tag* t = tag_for_setter(tag);
+    if (!t) return;
+    uint64_t interval = per_second > 0.0f ? (uint64_t)(1e9 / per_second) : 0;
+    atomic_store(&t->burst_ns, burst > 1 ? (uint64_t)(burst - 1) * interval : 0);
+    atomic_store(&t->tat, 0);
+    atomic_store(&t->interval_ns, interval);
+}
+
+void custom_log_set_sampling(const char* tag, unsigned one_in_n)
+{
+    custom_log_tag* t = tag_for_setter(tag);
+    if (t) atomic_store(&t->sample, one_in_n);
+}
+
+int custom_log_tags(custom_log_tag_info* out, int max)
+{
+    while (atomic_flag_test_and_set_explicit(&log_tags_lock, memory_order_acquire)) thread_yield();
+    int n = 0;
+    for (; n < log_num_tags && n < max; n++) {
+        custom_log_tag* t = &log_tags[n];
+        uint64_t interval = atomic_load(&t->interval_ns);
+        out[n] = (custom_log_tag_info){
+            .name       = t->name,
+            .level      = atomic_load(&t->level),
+            .sample     = atomic_load(&t->sample),
+            .rate       = interval ? (float)(1e9 / (double)interval) : 0.0f,
+            .suppressed = atomic_load(&t->suppressed),
+        };
+    }
+    atomic_flag_clear_explicit(&log_tags_lock, memory_order_release);
+    return n;
+}
 
 void _custom_log(const char* tag,
                  uint32_t    level,
@@ -16,13 +466,377 @@ void _custom_log(const char* tag,
                  const char* file,
                  ...)
 {
-    char buffer[1024];
+    if (!tag_allows(tag_lookup(tag), level)) return;   // no site to cache the entry in
 
     va_list ap;
     va_start(ap, file);                     // start after 'file'
-    vsnprintf(buffer, sizeof(buffer), fmt, ap);
+    log_text(tag, level, fmt, line, file, ap);
     va_end(ap);
+}
 
-    /* Forward to sokol's logger – the last argument is reserved for future use */
-    slog_func(tag, level, 0, buffer, line, file, NULL);
-}
\ No newline at end of file
+void _custom_log_site(custom_log_site* site, ...)
+{
+    /* concurrent first calls resolve to the same entry; release/acquire
+       publishes the entry's name and hash along with the pointer */
+    custom_log_tag* t = atomic_load_explicit(&site->tag_ref, memory_order_acquire);
+    if (!t) {
+        t = tag_lookup(site->tag);
+        atomic_store_explicit(&site->tag_ref, t, memory_order_release);
+    }
+    if (!tag_allows(t, site->level)) return;
+
+    va_list ap;
+    va_start(ap, site);
+    if (lg.binary && atomic_load_explicit(&lg.running, memory_order_acquire)) {
+        va_list text;
+        va_copy(text, ap);
+        if (!log_binary(site, &ap)) {       // long strings (tracebacks) go whole as a TEXT record
+            log_text(site->tag, site->level, site->fmt, site->line, site->file, text);
+        }
+        va_end(text);
+    } else {
+        log_text(site->tag, site->level, site->fmt, site->line, site->file, ap);
+    }
+    va_end(ap);
+}
+
+/* -----------------------------------------------------------------
+   Writer thread
+   ----------------------------------------------------------------- */
+static const char* level_name(uint32_t level)
+{
+    switch (level) {
+        case 0:  return "panic";
+        case 1:  return "error";
+        case 2:  return "warn";
+        case 3:  return "info";
+        default: return "debug";
+    }
+}
+
+static const char* base_name(const char* path)
+{
+    const char* name = path;
+    for (const char* p = path; p && *p; p++) {
+        if (*p == '/' || *p == '\\') name = p + 1;
+    }
+    return name ? name : "";
+}
+
+static void open_output(void)
+{
+    lg.out = fopen(lg.desc.path, lg.binary ? "wb" : "w");
+    if (!lg.out) {
+        fprintf(stderr, "[LOG] cannot open %s, logging to stdout\n", lg.desc.path);
+        lg.out = stdout;
+        lg.binary = false;
+        return;
+    }
+    lg.file_bytes = 0;
+    lg.file_gen++;                      // sites get re-announced in the new file
+    lg.next_site = 0;
+    if (lg.binary) lg.file_bytes = fwrite(CLOG_MAGIC, 1, CLOG_MAGIC_LEN, lg.out);
+}
+
+/* path → path.1 → path.2 ... the oldest falls off */
+static void rotate(void)
+{
+    char from[512], to[512];
+    fclose(lg.out);
+    for (int i = lg.desc.max_files - 1; i >= 1; i--) {
+        snprintf(from, sizeof(from), "%s.%d", lg.desc.path, i);
+        snprintf(to, sizeof(to), "%s.%d", lg.desc.path, i + 1);
+        remove(to);
+        rename(from, to);
+    }
+    snprintf(to, sizeof(to), "%s.1", lg.desc.path);
+    remove(to);
+    rename(lg.desc.path, to);
+    open_output();
+}
+
+/* call after each complete record */
+static void record_done(void)
+{
+    if (lg.out != stdout && lg.file_bytes > lg.desc.max_file_bytes) rotate();
+}
+
+/* one finished line – into the text output (to_file) and to the sink */
+static void emit_line(uint32_t level, bool to_file, const char* fmt, ...)
+{
+    custom_log_sink_fn sink = atomic_load_explicit(&lg.sink, memory_order_acquire);
+    if (!to_file && !sink) return;
+
+    char buf[LOG_LINE_SIZE];
+    char* line = buf;
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+    size_t len = (size_t)n;
+    if (len >= sizeof(buf)) {               // long message: format once more into the heap
+        line = (char*)malloc(len + 1);
+        if (line) {
+            va_start(ap, fmt);
+            vsnprintf(line, len + 1, fmt, ap);
+            va_end(ap);
+        } else {
+            line = buf;
+            len = sizeof(buf) - 1;
+        }
+    }
+
+    if (to_file) {
+        lg.file_bytes += fwrite(line, 1, len, lg.out);
+        lg.file_bytes += fwrite("\n", 1, 1, lg.out);
+        record_done();
+    }
+    if (sink) sink(level, line, len, lg.sink_user);
+    if (line != buf) free(line);
+}
+
+static void put_bytes(const void* p, size_t n)
+{
+    lg.file_bytes += fwrite(p, 1, n, lg.out);
+}
+static void put_u8(uint8_t v)   { put_bytes(&v, 1); }
+static void put_u32(uint32_t v) { put_bytes(&v, 4); }
+static void put_u64(uint64_t v) { put_bytes(&v, 8); }
+static void put_str(const char* s)
+{
+    size_t n = s ? strlen(s) : 0;
+    if (n > 0xfffe) n = 0xfffe;
+    uint16_t l16 = s ? (uint16_t)n : (uint16_t)CLOG_STR_NULL;
+    put_bytes(&l16, 2);
+    put_bytes(s, n);
+}
+
+/* text ring – lines, or TEXT records in binary mode */
+static bool drain_text(void)
+{
+    bool any = false;
+    size_t pos = atomic_load_explicit(&lg.tail, memory_order_relaxed);
+    for (;;) {
+        log_slot_t* s = &lg.ring[pos & (LOG_RING_SIZE - 1)];
+        if (atomic_load_explicit(&s->seq, memory_order_acquire) != pos + 1) break;
+        if (lg.binary) {
+            put_u8(CLOG_REC_TEXT);
+            put_u32(s->level);
+            put_u32(s->line);
+            put_u64(stm_ns(s->time));
+            put_str(s->tag);
+            put_str(s->file);
+            put_str(s->long_msg ? s->long_msg : s->msg);
+            record_done();
+        }
+        emit_line(s->level, !lg.binary, "[%10.3f][%-5s][%s] %s  (%s:%u)",
+            stm_sec(s->time), level_name(s->level), s->tag, s->long_msg ? s->long_msg : s->msg,
+            base_name(s->file), s->line);
+        free(s->long_msg);
+        s->long_msg = NULL;
+        atomic_store_explicit(&s->seq, pos + LOG_RING_SIZE, memory_order_release);
+        atomic_store_explicit(&lg.tail, ++pos, memory_order_release);
+        any = true;
+    }
+    return any;
+}
+
+/* per-thread binary rings – SITE records on first use per file, then EVENTs */
+static bool drain_threads(void)
+{
+    bool any = false;
+    for (log_thread_buf_t* b = atomic_load(&lg.threads); b; b = b->next) {
+        size_t tail = atomic_load_explicit(&b->tail, memory_order_relaxed);
+        size_t head = atomic_load_explicit(&b->head, memory_order_acquire);
+        while (tail != head) {
+            size_t off = tail & (LOG_THREAD_BUF_SIZE - 1);
+            if (LOG_THREAD_BUF_SIZE - off < sizeof(log_record_t)) {
+                tail += LOG_THREAD_BUF_SIZE - off;
+                continue;
+            }
+            log_record_t rec;
+            memcpy(&rec, b->data + off, sizeof(rec));
+            if (rec.payload != LOG_RECORD_PAD) {
+                custom_log_site* site = rec.site;
+                if (site->file_gen != lg.file_gen) {
+                    site->id = ++lg.next_site;
+                    site->file_gen = lg.file_gen;
+                    put_u8(CLOG_REC_SITE);
+                    put_u32(site->id);
+                    put_u32(site->level);
+                    put_u32(site->line);
+                    put_str(site->tag);
+                    put_str(site->file);
+                    put_str(site->fmt);
+                }
+                put_u8(CLOG_REC_EVENT);
+                put_u32(site->id);
+                put_u32(rec.thread_id);
+                put_u64(stm_ns(rec.time));
+                put_u32(rec.payload);
+                put_bytes(b->data + off + sizeof(rec), rec.payload);
+                record_done();
+                if (atomic_load_explicit(&lg.sink, memory_order_relaxed)) {
+                    char msg[LOG_LINE_SIZE];
+                    clog_format(site->fmt, b->data + off + sizeof(rec), rec.payload, msg, sizeof(msg));
+                    emit_line(site->level, false, "[%10.3f][%-5s][%s][t%u] %s  (%s:%u)",
+                        stm_sec(rec.time), level_name(site->level), site->tag, rec.thread_id,
+                        msg, base_name(site->file), site->line);
+                }
+            }
+            tail += rec.size;
+            any = true;
+        }
+        atomic_store_explicit(&b->tail, tail, memory_order_release);
+    }
+    return any;
+}
+
+/* write everything published so far – returns false when idle */
+static bool drain(void)
+{
+    bool any = drain_text();
+    if (lg.binary) any |= drain_threads();
+
+    uint64_t dropped = atomic_load_explicit(&lg.dropped, memory_order_relaxed);
+    if (dropped != lg.dropped_reported) {
+        uint64_t count = dropped - lg.dropped_reported;
+        if (lg.binary) {
+            put_u8(CLOG_REC_DROPPED);
+            put_u64(stm_ns(stm_now()));
+            put_u64(count);
+            record_done();
+        }
+        emit_line(2, !lg.binary, "[%10.3f][warn ][log] ring full, %llu message(s) dropped",
+            stm_sec(stm_now()), (unsigned long long)count);
+        lg.dropped_reported = dropped;
+        any = true;
+    }
+    if (any) fflush(lg.out);
+    return any;
+}
+
+static void writer_main(void* arg)
+{
+    (void)arg;
+    while (!atomic_load(&lg.quit)) {
+        if (!drain()) thread_sleep_ms(LOG_IDLE_MS);
+    }
+    drain();
+}
+
+/* -----------------------------------------------------------------
+   Crash flush – give the writer a moment, then die as before
+   ----------------------------------------------------------------- */
+static const int crash_signals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+static void (*prev_handlers[sizeof(crash_signals) / sizeof(crash_signals[0])])(int);
+
+/* wait until the writer passed everything queued right now, timeout_ms < 0: forever */
+static bool wait_until(atomic_size_t* tail, size_t target, int timeout_ms, int* waited)
+{
+    while (atomic_load(tail) < target) {
+        if (timeout_ms >= 0 && *waited >= timeout_ms) return false;
+        thread_sleep_ms(1);
+        (*waited)++;
+    }
+    return true;
+}
+
+static bool wait_written(int timeout_ms)
+{
+    int waited = 0;
+    if (!wait_until(&lg.tail, atomic_load(&lg.head), timeout_ms, &waited)) return false;
+    for (log_thread_buf_t* b = atomic_load(&lg.threads); b; b = b->next) {
+        if (!wait_until(&b->tail, atomic_load(&b->head), timeout_ms, &waited)) return false;
+    }
+    return true;
+}
+
+static void crash_handler(int sig)
+{
+    if (atomic_load(&lg.running)) {
+        wait_written(LOG_CRASH_WAIT_MS);
+        fflush(lg.out);
+    }
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+/* -----------------------------------------------------------------
+   Public API
+   ----------------------------------------------------------------- */
+void custom_log_setup(const custom_log_desc* desc)
+{
+    if (atomic_load(&lg.running)) return;
+
+    lg.desc = desc ? *desc : (custom_log_desc){ 0 };
+    if (!lg.desc.max_file_bytes) lg.desc.max_file_bytes = LOG_DEFAULT_BYTES;
+    if (lg.desc.max_files < 1)   lg.desc.max_files = LOG_DEFAULT_FILES;
+    lg.binary = lg.desc.binary;
+    if (lg.binary && !lg.desc.path) {
+        fprintf(stderr, "[LOG] binary logging needs a path, logging text to stdout\n");
+        lg.binary = false;
+    }
+    lg.out = stdout;
+    lg.file_bytes = 0;
+    if (lg.desc.path) open_output();
+
+    for (size_t i = 0; i < LOG_RING_SIZE; i++) atomic_init(&lg.ring[i].seq, i);
+    atomic_store(&lg.head, 0);
+    atomic_store(&lg.tail, 0);
+    atomic_store(&lg.dropped, 0);
+    lg.dropped_reported = 0;
+    atomic_store(&lg.quit, false);
+
+    if (!thread_start(&lg.thread, writer_main, NULL)) {
+        fprintf(stderr, "[LOG] cannot start writer thread, logging synchronously\n");
+        if (lg.out != stdout) fclose(lg.out);
+        lg.binary = false;
+        return;
+    }
+    for (size_t i = 0; i < sizeof(crash_signals) / sizeof(crash_signals[0]); i++) {
+        prev_handlers[i] = signal(crash_signals[i], crash_handler);
+    }
+    atomic_store_explicit(&lg.running, true, memory_order_release);
+}
+
+void custom_log_flush(void)
+{
+    if (atomic_load(&lg.running)) wait_written(-1);
+}
+
+void custom_log_shutdown(void)
+{
+    if (!atomic_load(&lg.running)) return;
+    atomic_store_explicit(&lg.running, false, memory_order_release);   // late calls go sync
+
+    atomic_store(&lg.quit, true);
+    thread_join(lg.thread);             // the writer drains once more on the way out
+    for (size_t i = 0; i < sizeof(crash_signals) / sizeof(crash_signals[0]); i++) {
+        signal(crash_signals[i], prev_handlers[i] == SIG_ERR ? SIG_DFL : prev_handlers[i]);
+    }
+    if (lg.out != stdout) fclose(lg.out);
+    lg.out = NULL;
+    lg.binary = false;
+}
+
+void custom_log_set_sink(custom_log_sink_fn fn, void* user)
+{
+    atomic_store_explicit(&lg.sink, NULL, memory_order_release);
+    lg.sink_user = user;
+    atomic_store_explicit(&lg.sink, fn, memory_order_release);
+}
+
+uint64_t custom_log_dropped(void)
+{
+    return atomic_load(&lg.dropped);
+}
+
+void custom_log_thread_exit(void)
+{
+    log_thread_buf_t* b = tls_buf;
+    if (!b) return;
+    tls_buf = NULL;
+    atomic_store(&b->released, true);
+}
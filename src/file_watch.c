@@ -0,0 +1,145 @@
+/*======================================================================
+  file_watch.c  –  inotify (Linux) / mtime polling file watcher
+======================================================================*/
+
+#include "file_watch.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <sys/stat.h>
+#include <time.h>
+#endif
+
+typedef struct {
+    char path[256];
+    const char *name;               // basename inside path
+#if defined(__linux__)
+    int wd;                         // inotify watch of the parent dir
+#else
+    time_t mtime;
+#endif
+} watch_t;
+
+static struct {
+    bool valid;
+    int fd;
+    int count;
+    watch_t watches[FILE_WATCH_MAX];
+} fw = { .fd = -1 };
+
+bool file_watch_init(void)
+{
+    if (fw.valid) return true;
+#if defined(__linux__)
+    fw.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fw.fd < 0) {
+        fprintf(stderr, "file_watch: inotify_init1 failed (%s)\n", strerror(errno));
+        return false;
+    }
+#endif
+    fw.count = 0;
+    fw.valid = true;
+    return true;
+}
+
+void file_watch_shutdown(void)
+{
+#if defined(__linux__)
+    if (fw.fd >= 0) close(fw.fd);   // drops all watches
+#endif
+    fw.fd = -1;
+    fw.count = 0;
+    fw.valid = false;
+}
+
+int file_watch_add(const char *path)
+{
+    if (!fw.valid) return -1;
+    for (int i = 0; i < fw.count; i++) {
+        if (strcmp(fw.watches[i].path, path) == 0) return i;
+    }
+    if (fw.count == FILE_WATCH_MAX || strlen(path) >= sizeof(fw.watches[0].path)) {
+        fprintf(stderr, "file_watch: cannot watch '%s'\n", path);
+        return -1;
+    }
+
+    watch_t *w = &fw.watches[fw.count];
+    snprintf(w->path, sizeof(w->path), "%s", path);
+    const char *slash = strrchr(w->path, '/');
+#if defined(_WIN32)
+    const char *bslash = strrchr(w->path, '\\');
+    if (bslash > slash) slash = bslash;
+#endif
+    w->name = slash ? slash + 1 : w->path;
+
+#if defined(__linux__)
+    char dir[256];
+    if (slash) {
+        snprintf(dir, sizeof(dir), "%.*s", (int)(slash - w->path), w->path);
+    } else {
+        snprintf(dir, sizeof(dir), ".");
+    }
+    // inotify hands out the same wd when the directory is already watched
+    w->wd = inotify_add_watch(fw.fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (w->wd < 0) {
+        fprintf(stderr, "file_watch: cannot watch '%s' (%s)\n", dir, strerror(errno));
+        return -1;
+    }
+#else
+    struct stat st;
+    w->mtime = stat(path, &st) == 0 ? st.st_mtime : 0;
+#endif
+    return fw.count++;
+}
+
+const char* file_watch_path(int id)
+{
+    return (id >= 0 && id < fw.count) ? fw.watches[id].path : NULL;
+}
+
+static int add_unique(int *ids, int n, int max_ids, int id)
+{
+    for (int i = 0; i < n; i++) {
+        if (ids[i] == id) return n;   // editors emit several events per save
+    }
+    if (n < max_ids) ids[n++] = id;
+    return n;
+}
+
+int file_watch_poll(int *ids, int max_ids)
+{
+    if (!fw.valid) return 0;
+    int n = 0;
+#if defined(__linux__)
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    for (;;) {
+        ssize_t len = read(fw.fd, buf, sizeof(buf));
+        if (len <= 0) break;            // EAGAIN – nothing pending
+        for (char *p = buf; p < buf + len; ) {
+            const struct inotify_event *ev = (const struct inotify_event*)p;
+            if (ev->len > 0) {
+                for (int i = 0; i < fw.count; i++) {
+                    if (fw.watches[i].wd == ev->wd && strcmp(fw.watches[i].name, ev->name) == 0) {
+                        n = add_unique(ids, n, max_ids, i);
+                    }
+                }
+            }
+            p += sizeof(struct inotify_event) + ev->len;
+        }
+    }
+#else
+    for (int i = 0; i < fw.count; i++) {
+        struct stat st;
+        if (stat(fw.watches[i].path, &st) == 0 && st.st_mtime != fw.watches[i].mtime) {
+            fw.watches[i].mtime = st.st_mtime;
+            n = add_unique(ids, n, max_ids, i);
+        }
+    }
+#endif
+    return n;
+}
@@ -0,0 +1,676 @@
+/*======================================================================
+  frame_prof.c  –  PROF_ZONE recording, per-frame aggregation, timeline
+======================================================================*/
+
+#include "frame_prof.h"
+#include "thread_util.h"
+#include "cimgui.h"
+#include "sokol_time.h"
+#include <float.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER)
+#define PROF_THREAD_LOCAL __declspec(thread)
+#else
+#define PROF_THREAD_LOCAL _Thread_local
+#endif
+
+#define PROF_THREAD_EVENTS  (1 << 14)   // begin/end events per thread ring, power of two
+#define PROF_MAX_DEPTH      32          // nesting kept per thread, deeper zones are ignored
+#define PROF_MAX_ZONES      256         // distinct zone names, the last one is shared
+#define PROF_NAME_SLOTS     512         // name pointer → zone cache, power of two
+#define PROF_HISTORY        300         // frames kept
+#define PROF_RECORDS        (1 << 18)   // finished zones kept across the history, power of two
+#define PROF_MAX_COUNTERS   16          // frame_prof_counter() values per frame
+
+enum { TOKEN_RECORDED = 1, TOKEN_SKIPPED = 2 };
+
+/* ------------------------------------------------------------------ */
+/*  Per-thread event ring – SPSC, the owner thread pushes begin/end   */
+/*  events, the main thread drains them once per frame. A begin is    */
+/*  only recorded if the ring still has room for the ends of every    */
+/*  zone open on that thread, so pairs never get split.               */
+/* ------------------------------------------------------------------ */
+typedef struct prof_event_t {
+    uint64_t    time;
+    const char *name;           // NULL: end of the innermost zone
+} prof_event_t;
+
+typedef struct prof_thread_t {
+    alignas(64) atomic_size_t head;     // owner thread
+    alignas(64) atomic_size_t tail;     // main thread
+    int                   open;         // owner: recorded zones not ended yet
+    atomic_uint           dropped;
+    atomic_bool           released;     // owner exited, the next new thread takes it over
+    uint32_t              index;
+    struct prof_thread_t *next;
+
+    /* main thread: begins waiting for their end */
+    struct { uint64_t begin; uint16_t zone; } stack[PROF_MAX_DEPTH];
+    int                   depth;
+    int                   skip;         // ends of zones past PROF_MAX_DEPTH
+
+    prof_event_t          events[PROF_THREAD_EVENTS];
+} prof_thread_t;
+
+/* one finished zone */
+typedef struct prof_record_t {
+    uint64_t begin, end;
+    uint16_t zone;
+    uint8_t  depth;
+    uint8_t  thread;
+} prof_record_t;
+
+typedef struct prof_frame_t {
+    uint64_t begin, end;
+    uint64_t rec_begin, rec_end;        // absolute indices into records
+} prof_frame_t;
+
+typedef struct prof_counter_t {
+    const char *name;
+    double      value;
+} prof_counter_t;
+
+/* one captured frame on its way to the trace writer thread */
+typedef struct trace_event_t {
+    uint64_t    begin, end;
+    const char *name;
+    uint32_t    thread;
+} trace_event_t;
+
+typedef struct trace_chunk_t {
+    struct trace_chunk_t *next;
+    uint64_t       frame, begin, end;
+    int            num_counters;
+    prof_counter_t counters[PROF_MAX_COUNTERS];
+    size_t         num_events;
+    trace_event_t  events[];
+} trace_chunk_t;
+
+static PROF_THREAD_LOCAL prof_thread_t *tls_thread;
+
+static struct {
+    atomic_bool              enabled;
+    _Atomic(prof_thread_t*)  threads;   // every ring ever created, reused after thread exit
+    atomic_uint              next_thread;
+
+    /* main thread only */
+    const char              *zone_names[PROF_MAX_ZONES];
+    int                      num_zones;
+    struct { const char *ptr; int zone; } name_cache[PROF_NAME_SLOTS];
+
+    prof_record_t            records[PROF_RECORDS];
+    uint64_t                 num_records;
+    prof_frame_t             frames[PROF_HISTORY];
+    float                    zone_ms[PROF_HISTORY][PROF_MAX_ZONES];    // inclusive time per frame
+    uint16_t                 zone_calls[PROF_HISTORY][PROF_MAX_ZONES];
+    uint64_t                 num_frames;
+    uint64_t                 frame_begin;
+    uint64_t                 frame_rec_begin;
+
+    prof_counter_t           counters[PROF_MAX_COUNTERS];  // of the frame being recorded
+    int                      num_counters;
+    prof_counter_t           last_counters[PROF_MAX_COUNTERS];
+    int                      num_last_counters;
+
+    bool                     paused;
+    uint64_t                 selected;  // absolute frame + 1, 0 = newest
+} prof;
+
+static struct {
+    int            pending;     // frames asked for, capture starts at the next frame
+    char           pending_path[256];
+    int            frames_left; // > 0 while capturing
+    int            frames;
+    uint64_t       t0;
+    char           path[256];
+
+    thread_t       thread;
+    bool           thread_live;
+    atomic_bool    done;        // writer finished, thread can be joined
+    mutex_t        lock;
+    cond_t         wake;
+    trace_chunk_t *head, *tail; // frames not written yet
+    bool           closing;     // no more chunks after these
+} trace;
+
+/* A released ring keeps its index and its place in the list; head just
+   continues, so events of the old owner the main thread has not drained
+   yet stay in order in front of the new owner's. */
+static prof_thread_t* thread_ring(void)
+{
+    if (tls_thread) return tls_thread;
+    for (prof_thread_t *t = atomic_load(&prof.threads); t; t = t->next) {
+        bool expected = true;
+        if (atomic_load_explicit(&t->released, memory_order_relaxed) &&
+            atomic_compare_exchange_strong(&t->released, &expected, false)) {
+            return tls_thread = t;
+        }
+    }
+    prof_thread_t *t = (prof_thread_t*)calloc(1, sizeof(*t));
+    if (!t) return NULL;
+    t->index = atomic_fetch_add(&prof.next_thread, 1);
+    t->next = atomic_load(&prof.threads);
+    while (!atomic_compare_exchange_weak(&prof.threads, &t->next, t)) {}
+    return tls_thread = t;
+}
+
+void frame_prof_thread_exit(void)
+{
+    prof_thread_t *t = tls_thread;
+    if (!t) return;
+    tls_thread = NULL;
+    atomic_store(&t->released, true);
+}
+
+int frame_prof_begin(const char *name)
+{
+    if (!atomic_load_explicit(&prof.enabled, memory_order_relaxed)) return TOKEN_SKIPPED;
+    prof_thread_t *t = thread_ring();
+    if (!t) return TOKEN_SKIPPED;
+
+    size_t head = atomic_load_explicit(&t->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&t->tail, memory_order_acquire);
+    if (PROF_THREAD_EVENTS - (head - tail) <= (size_t)t->open + 1) {
+        atomic_fetch_add_explicit(&t->dropped, 1, memory_order_relaxed);
+        return TOKEN_SKIPPED;
+    }
+    t->events[head & (PROF_THREAD_EVENTS - 1)] = (prof_event_t){ stm_now(), name };
+    atomic_store_explicit(&t->head, head + 1, memory_order_release);
+    t->open++;
+    return TOKEN_RECORDED;
+}
+
+int frame_prof_end(int token)
+{
+    if (token == TOKEN_RECORDED) {
+        prof_thread_t *t = tls_thread;
+        size_t head = atomic_load_explicit(&t->head, memory_order_relaxed);
+        t->events[head & (PROF_THREAD_EVENTS - 1)] = (prof_event_t){ stm_now(), NULL };
+        atomic_store_explicit(&t->head, head + 1, memory_order_release);
+        t->open--;
+    }
+    return 0;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Collection (main thread)                                          */
+/* ------------------------------------------------------------------ */
+static int zone_index(const char *name)
+{
+    size_t h = ((uintptr_t)name >> 3) & (PROF_NAME_SLOTS - 1);
+    for (size_t i = 0; i < PROF_NAME_SLOTS; i++, h = (h + 1) & (PROF_NAME_SLOTS - 1)) {
+        if (prof.name_cache[h].ptr == name) return prof.name_cache[h].zone;
+        if (prof.name_cache[h].ptr) continue;
+
+        // new pointer – the same text may already be known from another file
+        int z = 0;
+        while (z < prof.num_zones && strcmp(prof.zone_names[z], name) != 0) z++;
+        if (z == prof.num_zones && z < PROF_MAX_ZONES - 1) {
+            prof.zone_names[prof.num_zones++] = name;
+        } else if (z >= PROF_MAX_ZONES - 1) {
+            z = PROF_MAX_ZONES - 1;         // table full, everything new lands here
+            prof.zone_names[z] = "(other)";
+            prof.num_zones = PROF_MAX_ZONES;
+        }
+        prof.name_cache[h].ptr = name;
+        prof.name_cache[h].zone = z;
+        return z;
+    }
+    return PROF_MAX_ZONES - 1;
+}
+
+static void drain(prof_thread_t *t, bool keep, float *row_ms, uint16_t *row_calls)
+{
+    size_t tail = atomic_load_explicit(&t->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&t->head, memory_order_acquire);
+    for (; tail != head; tail++) {
+        const prof_event_t *e = &t->events[tail & (PROF_THREAD_EVENTS - 1)];
+        if (e->name) {
+            if (t->depth == PROF_MAX_DEPTH) { t->skip++; continue; }
+            t->stack[t->depth].begin = e->time;
+            t->stack[t->depth].zone = (uint16_t)zone_index(e->name);
+            t->depth++;
+        } else if (t->skip) {
+            t->skip--;
+        } else if (t->depth) {
+            t->depth--;
+            if (!keep) continue;
+            uint16_t z = t->stack[t->depth].zone;
+            prof_record_t *r = &prof.records[prof.num_records++ & (PROF_RECORDS - 1)];
+            *r = (prof_record_t){ t->stack[t->depth].begin, e->time, z, (uint8_t)t->depth,
+                                  (uint8_t)(t->index < 255 ? t->index : 255) };
+            row_ms[z] += (float)stm_ms(r->end - r->begin);
+            if (row_calls[z] < UINT16_MAX) row_calls[z]++;
+        }
+    }
+    atomic_store_explicit(&t->tail, tail, memory_order_release);
+}
+
+/* ------------------------------------------------------------------ */
+/*  Trace capture – captured frames are copied into chunks and handed */
+/*  to a writer thread, which turns them into Chrome trace-event JSON */
+/*  (chrome://tracing, ui.perfetto.dev): one "X" event per zone, a    */
+/*  "frame" event per frame and "C" events for the counters.          */
+/* ------------------------------------------------------------------ */
+static void json_string(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') fputc('\\', f);
+        if ((unsigned char)*s >= 0x20) fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+static void trace_write_chunk(FILE *f, const trace_chunk_t *c, uint8_t *named)
+{
+    double us = 1e-3;                   // ticks are ns
+    fprintf(f, ",\n{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,"
+               "\"args\":{\"index\":%llu}}",
+            stm_ns(c->begin - trace.t0) * us, stm_ns(c->end - c->begin) * us, (unsigned long long)c->frame);
+    for (size_t i = 0; i < c->num_events; i++) {
+        const trace_event_t *e = &c->events[i];
+        if (e->thread < 256 && !named[e->thread]) {
+            named[e->thread] = 1;
+            char name[32];
+            if (e->thread) snprintf(name, sizeof(name), "thread %u", e->thread);
+            else snprintf(name, sizeof(name), "main");
+            fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                       "\"args\":{\"name\":\"%s\"}}", e->thread, name);
+        }
+        uint64_t begin = e->begin > trace.t0 ? e->begin : trace.t0;     // started before the capture
+        fputs(",\n{\"name\":", f);
+        json_string(f, e->name);
+        fprintf(f, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                e->thread, stm_ns(begin - trace.t0) * us, stm_ns(e->end - begin) * us);
+    }
+    if (c->num_counters) {
+        fprintf(f, ",\n{\"name\":\"frame stats\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{",
+                stm_ns(c->begin - trace.t0) * us);
+        for (int i = 0; i < c->num_counters; i++) {
+            if (i) fputc(',', f);
+            json_string(f, c->counters[i].name);
+            fprintf(f, ":%.17g", c->counters[i].value);
+        }
+        fputs("}}", f);
+    }
+}
+
+static void trace_writer(void *arg)
+{
+    (void)arg;
+    FILE *f = fopen(trace.path, "wb");
+    if (!f) fprintf(stderr, "[PROF] cannot write trace %s\n", trace.path);
+    else fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+               "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"demo\"}}", f);
+
+    uint8_t named[256] = { 0 };
+    int written = 0;
+    for (;;) {
+        mutex_lock(&trace.lock);
+        while (!trace.head && !trace.closing) cond_wait(&trace.wake, &trace.lock);
+        trace_chunk_t *c = trace.head;
+        if (c) {
+            trace.head = c->next;
+            if (!trace.head) trace.tail = NULL;
+        }
+        mutex_unlock(&trace.lock);
+        if (!c) break;                  // closing and drained
+        if (f) trace_write_chunk(f, c, named);
+        written++;
+        free(c);
+    }
+    if (f) {
+        fputs("\n]}\n", f);
+        fclose(f);
+        printf("[PROF] trace of %d frames written to %s\n", written, trace.path);
+    }
+    atomic_store(&trace.done, true);
+}
+
+static void trace_push(trace_chunk_t *c)
+{
+    mutex_lock(&trace.lock);
+    if (c) {
+        c->next = NULL;
+        if (trace.tail) trace.tail->next = c;
+        else trace.head = c;
+        trace.tail = c;
+    } else {
+        trace.closing = true;
+    }
+    cond_signal(&trace.wake);
+    mutex_unlock(&trace.lock);
+}
+
+/* copy the frame that just ended for the writer */
+static void trace_frame(uint64_t begin, uint64_t end)
+{
+    uint64_t first = prof.frame_rec_begin;
+    if (first + PROF_RECORDS < prof.num_records) first = prof.num_records - PROF_RECORDS;
+    size_t n = (size_t)(prof.num_records - first);
+    trace_chunk_t *c = (trace_chunk_t*)malloc(sizeof(trace_chunk_t) + n * sizeof(trace_event_t));
+    if (!c) {
+        fprintf(stderr, "[PROF] out of memory, frame left out of the trace\n");
+        return;
+    }
+    c->frame = (uint64_t)(trace.frames - trace.frames_left);
+    c->begin = begin;
+    c->end = end;
+    c->num_counters = prof.num_counters;
+    memcpy(c->counters, prof.counters, sizeof(prof.counters));
+    c->num_events = n;
+    for (size_t i = 0; i < n; i++) {
+        const prof_record_t *r = &prof.records[(first + i) & (PROF_RECORDS - 1)];
+        c->events[i] = (trace_event_t){ r->begin, r->end, prof.zone_names[r->zone], r->thread };
+    }
+    trace_push(c);
+}
+
+static void trace_join(void)
+{
+    if (!trace.thread_live) return;
+    trace_push(NULL);
+    thread_join(trace.thread);
+    trace.thread_live = false;
+    trace.frames_left = 0;
+    mutex_destroy(&trace.lock);
+    cond_destroy(&trace.wake);
+    while (trace.head) {                // only when the writer never ran
+        trace_chunk_t *c = trace.head;
+        trace.head = c->next;
+        free(c);
+    }
+    trace.tail = NULL;
+}
+
+static void trace_start(uint64_t now)
+{
+    trace_join();
+    snprintf(trace.path, sizeof(trace.path), "%s", trace.pending_path);
+    trace.frames = trace.frames_left = trace.pending;
+    trace.pending = 0;
+    trace.t0 = now;
+    trace.closing = false;
+    atomic_store(&trace.done, false);
+    mutex_init(&trace.lock);
+    cond_init(&trace.wake);
+    if (!thread_start(&trace.thread, trace_writer, NULL)) {
+        fprintf(stderr, "[PROF] cannot start the trace writer\n");
+        mutex_destroy(&trace.lock);
+        cond_destroy(&trace.wake);
+        trace.frames_left = 0;
+        return;
+    }
+    trace.thread_live = true;
+    printf("[PROF] capturing %d frames to %s\n", trace.frames, trace.path);
+}
+
+bool frame_prof_capture(int frames, const char *path)
+{
+    if (frames <= 0) return false;
+    if (trace.frames_left > 0 || trace.pending) {
+        fprintf(stderr, "[PROF] a trace capture is already running\n");
+        return false;
+    }
+    snprintf(trace.pending_path, sizeof(trace.pending_path), "%s", path && *path ? path : "trace.json");
+    trace.pending = frames;
+    atomic_store(&prof.enabled, true);
+    return true;
+}
+
+bool frame_prof_capturing(void)
+{
+    return trace.pending > 0 || trace.frames_left > 0;
+}
+
+void frame_prof_counter(const char *name, double value)
+{
+    for (int i = 0; i < prof.num_counters; i++) {
+        if (prof.counters[i].name == name) {
+            prof.counters[i].value = value;
+            return;
+        }
+    }
+    if (prof.num_counters < PROF_MAX_COUNTERS) {
+        prof.counters[prof.num_counters++] = (prof_counter_t){ name, value };
+    }
+}
+
+/* ------------------------------------------------------------------ */
+/*  Frame boundary                                                    */
+/* ------------------------------------------------------------------ */
+void frame_prof_new_frame(void)
+{
+    if (trace.thread_live && atomic_load(&trace.done)) trace_join();
+    if (!atomic_load_explicit(&prof.enabled, memory_order_relaxed)) {
+        if (trace.frames_left > 0) trace_join();    // recording switched off mid-capture
+        return;
+    }
+    uint64_t now = stm_now();
+    size_t slot = (size_t)(prof.num_frames % PROF_HISTORY);
+    float *row_ms = prof.zone_ms[slot];
+    uint16_t *row_calls = prof.zone_calls[slot];
+    bool keep = !prof.paused || trace.frames_left > 0;
+
+    if (keep) {
+        memset(row_ms, 0, sizeof(prof.zone_ms[0]));
+        memset(row_calls, 0, sizeof(prof.zone_calls[0]));
+    }
+    for (prof_thread_t *t = atomic_load(&prof.threads); t; t = t->next) {
+        drain(t, keep, row_ms, row_calls);
+    }
+    if (keep && prof.frame_begin) {
+        if (trace.frames_left > 0) {
+            trace_frame(prof.frame_begin, now);
+            if (--trace.frames_left == 0) trace_push(NULL);
+        }
+        prof.frames[slot] = (prof_frame_t){ prof.frame_begin, now, prof.frame_rec_begin, prof.num_records };
+        prof.num_frames++;
+    }
+    if (trace.pending) trace_start(now);
+    prof.frame_begin = now;
+    prof.frame_rec_begin = prof.num_records;
+    memcpy(prof.last_counters, prof.counters, sizeof(prof.counters));
+    prof.num_last_counters = prof.num_counters;
+    prof.num_counters = 0;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Setup / shutdown                                                  */
+/* ------------------------------------------------------------------ */
+void frame_prof_setup(void)
+{
+    prof_thread_t *main_thread = thread_ring();     // index 0 when called first
+    if (!main_thread) {
+        fprintf(stderr, "[PROF] cannot allocate the main thread ring\n");
+        return;
+    }
+    prof.frame_begin = 0;
+    atomic_store(&prof.enabled, true);
+}
+
+void frame_prof_shutdown(void)
+{
+    atomic_store(&prof.enabled, false);     // rings stay, threads may still hold them
+    trace_join();                           // a running capture ends with what it has
+}
+
+/* ------------------------------------------------------------------ */
+/*  Window – frame time history, the selected frame's zones per       */
+/*  thread and nesting depth, and per-zone min/avg/max over history   */
+/* ------------------------------------------------------------------ */
+static const ImU32 zone_colors[] = {
+    IM_COL32( 86, 156, 214, 255), IM_COL32(214, 157,  86, 255), IM_COL32(106, 190, 110, 255),
+    IM_COL32(200, 100, 160, 255), IM_COL32(190, 190,  90, 255), IM_COL32( 90, 190, 190, 255),
+    IM_COL32(160, 120, 220, 255), IM_COL32(210, 100,  90, 255),
+};
+
+static float frame_ms_at(uint64_t n)
+{
+    const prof_frame_t *f = &prof.frames[n % PROF_HISTORY];
+    return (float)stm_ms(f->end - f->begin);
+}
+
+static void draw_timeline(uint64_t n)
+{
+    const prof_frame_t *f = &prof.frames[n % PROF_HISTORY];
+    if (f->rec_begin + PROF_RECORDS < prof.num_records) {
+        igTextUnformatted("zones of this frame were overwritten");
+        return;
+    }
+
+    int rows_of[256] = { 0 };           // max depth + 1 per thread
+    int max_thread = 0;
+    for (uint64_t i = f->rec_begin; i < f->rec_end; i++) {
+        const prof_record_t *r = &prof.records[i & (PROF_RECORDS - 1)];
+        if (r->depth + 1 > rows_of[r->thread]) rows_of[r->thread] = r->depth + 1;
+        if (r->thread > max_thread) max_thread = r->thread;
+    }
+    int row_base[256];
+    int rows = 0;
+    for (int t = 0; t <= max_thread; t++) {
+        row_base[t] = rows;
+        rows += rows_of[t];
+    }
+    if (!rows) {
+        igTextUnformatted("no zones in this frame");
+        return;
+    }
+
+    const float row_h = igGetTextLineHeight() + 4.0f;
+    ImVec2 p0 = igGetCursorScreenPos();
+    float width = igGetContentRegionAvail().x;
+    if (width < 50.0f) width = 50.0f;
+    igInvisibleButton("timeline", (ImVec2){ width, rows * row_h }, ImGuiButtonFlags_None);
+    bool hovered = igIsItemHovered(ImGuiHoveredFlags_None);
+    ImVec2 mouse = igGetMousePos();
+
+    ImDrawList *dl = igGetWindowDrawList();
+    ImDrawList_PushClipRect(dl, p0, (ImVec2){ p0.x + width, p0.y + rows * row_h }, true);
+    double scale = width / (double)(f->end - f->begin ? f->end - f->begin : 1);
+    for (uint64_t i = f->rec_begin; i < f->rec_end; i++) {
+        const prof_record_t *r = &prof.records[i & (PROF_RECORDS - 1)];
+        double b = r->begin > f->begin ? (double)(r->begin - f->begin) : 0.0;
+        double e = r->end > f->begin ? (double)(r->end - f->begin) : 0.0;
+        float x0 = p0.x + (float)(b * scale);
+        float x1 = p0.x + (float)(e * scale);
+        if (x1 < x0 + 1.0f) x1 = x0 + 1.0f;
+        float y0 = p0.y + (row_base[r->thread] + r->depth) * row_h;
+        ImVec2 a = { x0, y0 + 1.0f }, z = { x1, y0 + row_h - 1.0f };
+        ImDrawList_AddRectFilled(dl, a, z, zone_colors[r->zone % (sizeof(zone_colors) / sizeof(zone_colors[0]))]);
+
+        const char *name = prof.zone_names[r->zone];
+        if (igCalcTextSize(name).x < x1 - x0 - 4.0f) {
+            ImDrawList_AddText(dl, (ImVec2){ x0 + 2.0f, y0 + 2.0f }, IM_COL32(255, 255, 255, 255), name);
+        }
+        if (hovered && mouse.x >= a.x && mouse.x < z.x && mouse.y >= a.y && mouse.y < z.y) {
+            igSetTooltip("%s\n%.3f ms (thread %d, depth %d)", name, stm_ms(r->end - r->begin),
+                         r->thread, r->depth);
+        }
+    }
+    ImDrawList_PopClipRect(dl);
+}
+
+static void draw_zone_table(uint64_t frames)
+{
+    if (!igBeginTable("prof_zones", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders)) return;
+    igTableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+    igTableSetupColumn("Calls", ImGuiTableColumnFlags_WidthFixed);
+    igTableSetupColumn("Min ms", ImGuiTableColumnFlags_WidthFixed);
+    igTableSetupColumn("Avg ms", ImGuiTableColumnFlags_WidthFixed);
+    igTableSetupColumn("Max ms", ImGuiTableColumnFlags_WidthFixed);
+    igTableHeadersRow();
+
+    for (int z = 0; z < prof.num_zones; z++) {
+        float lo = FLT_MAX, hi = 0.0f;
+        double sum = 0.0, calls = 0.0;
+        int seen = 0;
+        for (uint64_t i = prof.num_frames - frames; i < prof.num_frames; i++) {
+            size_t slot = (size_t)(i % PROF_HISTORY);
+            if (!prof.zone_calls[slot][z]) continue;
+            float ms = prof.zone_ms[slot][z];
+            if (ms < lo) lo = ms;
+            if (ms > hi) hi = ms;
+            sum += ms;
+            calls += prof.zone_calls[slot][z];
+            seen++;
+        }
+        if (!seen) continue;
+        igTableNextRow();
+        igTableNextColumn(); igTextUnformatted(prof.zone_names[z]);
+        igTableNextColumn(); igText("%.1f", calls / seen);
+        igTableNextColumn(); igText("%.3f", lo);
+        igTableNextColumn(); igText("%.3f", sum / seen);
+        igTableNextColumn(); igText("%.3f", hi);
+    }
+    igEndTable();
+}
+
+void frame_prof_window(bool *open)
+{
+    if (!*open) return;
+    igSetNextWindowSize((ImVec2){ 760, 480 }, ImGuiCond_FirstUseEver);
+    if (!igBegin("Frame Profiler", open, ImGuiWindowFlags_None)) {
+        igEnd();
+        return;
+    }
+    bool enabled = atomic_load(&prof.enabled);
+    if (igCheckbox("Record", &enabled)) atomic_store(&prof.enabled, enabled);
+    igSameLine();
+    if (igCheckbox("Pause", &prof.paused) && !prof.paused) prof.selected = 0;
+    igSameLine();
+    if (frame_prof_capturing()) {
+        igText("capturing, %d frames left", trace.pending ? trace.pending : trace.frames_left);
+    } else if (igButton("Capture trace.json")) {
+        frame_prof_capture(PROF_HISTORY, "trace.json");
+    }
+
+    uint64_t frames = prof.num_frames < PROF_HISTORY ? prof.num_frames : PROF_HISTORY;
+    if (!frames) {
+        igTextUnformatted("no frames recorded yet");
+        igEnd();
+        return;
+    }
+    uint64_t first = prof.num_frames - frames;
+    if (prof.selected && prof.selected - 1 < first) prof.selected = 0;
+    uint64_t sel = prof.selected ? prof.selected - 1 : prof.num_frames - 1;
+
+    unsigned dropped = 0;
+    for (prof_thread_t *t = atomic_load(&prof.threads); t; t = t->next) dropped += atomic_load(&t->dropped);
+    igSameLine();
+    igText("frame %llu: %.3f ms, %d zones, %u dropped", (unsigned long long)sel, frame_ms_at(sel),
+           prof.num_zones, dropped);
+
+    static float plot[PROF_HISTORY];
+    float hi = 0.0f;
+    for (uint64_t i = 0; i < frames; i++) {
+        plot[i] = frame_ms_at(first + i);
+        if (plot[i] > hi) hi = plot[i];
+    }
+    igPlotHistogramEx("##frames", plot, (int)frames, 0, "click a frame to inspect it", 0.0f,
+                      hi > 0.0f ? hi : 1.0f, (ImVec2){ igGetContentRegionAvail().x, 60.0f }, sizeof(float));
+    if (igIsItemHovered(ImGuiHoveredFlags_None) && igIsMouseClicked(ImGuiMouseButton_Left)) {
+        ImVec2 min = igGetItemRectMin(), size = igGetItemRectSize();
+        int i = (int)((igGetMousePos().x - min.x) / size.x * (float)frames);
+        if (i >= 0 && (uint64_t)i < frames) {
+            prof.selected = first + (uint64_t)i + 1;
+            prof.paused = true;
+        }
+    }
+
+    for (int i = 0; i < prof.num_last_counters; i++) {
+        if (i) igSameLine();
+        igText("%s %.3g%s", prof.last_counters[i].name, prof.last_counters[i].value,
+               i + 1 < prof.num_last_counters ? "," : "");
+    }
+    draw_timeline(sel);
+    igSeparator();
+    draw_zone_table(frames);
+    igEnd();
+}
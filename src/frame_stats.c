@@ -0,0 +1,145 @@
+/*======================================================================
+  frame_stats.c  –  sokol_gfx frame stats: history, HUD, CSV
+======================================================================*/
+
+#include "frame_stats.h"
+#include "frame_prof.h"
+#include "gpu_timer.h"
+#include "sokol_gfx.h"
+#include "cimgui.h"
+#include <float.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define STATS_HISTORY       300         // frames kept for the graphs
+#define STATS_CSV_BUFFER    (64 * 1024) // stdio buffer, rows reach the disk in batches
+#define STATS_GPU_PASSES    8
+
+/* label, frame_prof counter / CSV column name, and the printf format of the HUD */
+static const struct { const char *label, *column, *fmt; } stat_info[FRAME_STAT_NUM] = {
+    [FRAME_STAT_FRAME_MS]      = { "Frame",          "frame_ms",      "%.2f ms" },
+    [FRAME_STAT_GPU_MS]        = { "GPU",            "gpu_ms",        "%.2f ms" },
+    [FRAME_STAT_DRAWS]         = { "Draws",          "draws",         "%.0f" },
+    [FRAME_STAT_PASSES]        = { "Passes",         "passes",        "%.0f" },
+    [FRAME_STAT_PIPELINES]     = { "Pipelines",      "pipelines",     "%.0f" },
+    [FRAME_STAT_BINDINGS]      = { "Bindings",       "bindings",      "%.0f" },
+    [FRAME_STAT_UNIFORMS]      = { "Uniform applies","uniforms",      "%.0f" },
+    [FRAME_STAT_UNIFORM_BYTES] = { "Uniform bytes",  "uniform_bytes", "%.0f" },
+    [FRAME_STAT_BUFFER_BYTES]  = { "Buffer bytes",   "buffer_bytes",  "%.0f" },
+    [FRAME_STAT_IMAGE_BYTES]   = { "Image bytes",    "image_bytes",   "%.0f" },
+};
+
+static struct {
+    bool     valid;
+    float    history[FRAME_STAT_NUM][STATS_HISTORY];
+    uint64_t frames;            // rows written so far, newest at (frames - 1) % STATS_HISTORY
+    FILE    *csv;
+    char     csv_buffer[STATS_CSV_BUFFER];
+} stats;
+
+void frame_stats_setup(const char *csv_path)
+{
+    memset(&stats, 0, sizeof(stats));
+    sg_enable_frame_stats();
+    if (csv_path && *csv_path) {
+        stats.csv = fopen(csv_path, "w");
+        if (!stats.csv) {
+            fprintf(stderr, "[STATS] cannot write %s\n", csv_path);
+        } else {
+            setvbuf(stats.csv, stats.csv_buffer, _IOFBF, sizeof(stats.csv_buffer));
+            fputs("frame", stats.csv);
+            for (int i = 0; i < FRAME_STAT_NUM; i++) fprintf(stats.csv, ",%s", stat_info[i].column);
+            fputc('\n', stats.csv);
+            printf("[STATS] recording frame stats to %s\n", csv_path);
+        }
+    }
+    stats.valid = true;
+}
+
+void frame_stats_shutdown(void)
+{
+    if (stats.csv) {
+        fclose(stats.csv);
+        stats.csv = NULL;
+    }
+    stats.valid = false;
+}
+
+void frame_stats_update(double frame_seconds)
+{
+    if (!stats.valid) return;
+    const sg_frame_stats fs = sg_query_frame_stats();     // the frame just committed
+    float v[FRAME_STAT_NUM];
+    v[FRAME_STAT_FRAME_MS]      = (float)(frame_seconds * 1000.0);
+    v[FRAME_STAT_GPU_MS]        = (float)gpu_timer_frame_ms();
+    v[FRAME_STAT_DRAWS]         = (float)(fs.num_draw + fs.num_draw_ex);
+    v[FRAME_STAT_PASSES]        = (float)fs.num_passes;
+    v[FRAME_STAT_PIPELINES]     = (float)fs.num_apply_pipeline;
+    v[FRAME_STAT_BINDINGS]      = (float)fs.num_apply_bindings;
+    v[FRAME_STAT_UNIFORMS]      = (float)fs.num_apply_uniforms;
+    v[FRAME_STAT_UNIFORM_BYTES] = (float)fs.size_apply_uniforms;
+    v[FRAME_STAT_BUFFER_BYTES]  = (float)(fs.size_update_buffer + fs.size_append_buffer);
+    v[FRAME_STAT_IMAGE_BYTES]   = (float)fs.size_update_image;
+
+    size_t slot = (size_t)(stats.frames % STATS_HISTORY);
+    for (int i = 0; i < FRAME_STAT_NUM; i++) {
+        stats.history[i][slot] = v[i];
+        if (i != FRAME_STAT_FRAME_MS) frame_prof_counter(stat_info[i].column, v[i]);
+    }
+
+    // per pass, a few frames old – queries are never waited for
+    gpu_timer_pass gpu[STATS_GPU_PASSES];
+    const int num_gpu = gpu_timer_results(gpu, STATS_GPU_PASSES);
+    for (int i = 0; i < num_gpu; i++) frame_prof_counter(gpu[i].name, gpu[i].ms);
+
+    if (stats.csv) {
+        fprintf(stats.csv, "%llu", (unsigned long long)stats.frames);
+        for (int i = 0; i < FRAME_STAT_NUM; i++) fprintf(stats.csv, ",%.9g", v[i]);
+        fputc('\n', stats.csv);
+    }
+    stats.frames++;
+}
+
+float frame_stats_last(frame_stat stat)
+{
+    if (!stats.frames || stat < 0 || stat >= FRAME_STAT_NUM) return 0.0f;
+    return stats.history[stat][(stats.frames - 1) % STATS_HISTORY];
+}
+
+/* ------------------------------------------------------------------ */
+/*  HUD – one sparkline per stat, oldest frame on the left            */
+/* ------------------------------------------------------------------ */
+void frame_stats_window(bool *open)
+{
+    if (!*open) return;
+    igSetNextWindowSize((ImVec2){ 420, 520 }, ImGuiCond_FirstUseEver);
+    if (!igBegin("Frame Stats", open, ImGuiWindowFlags_None)) {
+        igEnd();
+        return;
+    }
+    int n = (int)(stats.frames < STATS_HISTORY ? stats.frames : STATS_HISTORY);
+    int offset = (int)(stats.frames < STATS_HISTORY ? 0 : stats.frames % STATS_HISTORY);
+    igText("%d frames%s%s", n, stats.csv ? ", recording CSV" : "",
+           gpu_timer_measuring() ? "" : ", no GPU timer queries on this backend");
+
+    for (int i = 0; i < FRAME_STAT_NUM && n > 0; i++) {
+        const float *h = stats.history[i];
+        float lo = FLT_MAX, hi = -FLT_MAX;
+        double sum = 0.0;
+        for (int k = 0; k < n; k++) {
+            if (h[k] < lo) lo = h[k];
+            if (h[k] > hi) hi = h[k];
+            sum += h[k];
+        }
+        char fmt[96], overlay[96];
+        snprintf(fmt, sizeof(fmt), "%s  %s (min %s, avg %s, max %s)", stat_info[i].label,
+                 stat_info[i].fmt, stat_info[i].fmt, stat_info[i].fmt, stat_info[i].fmt);
+        snprintf(overlay, sizeof(overlay), fmt, frame_stats_last((frame_stat)i), lo, sum / n, hi);
+        igPushIDInt(i);
+        igPlotLinesEx("##spark", h, n, offset, overlay, 0.0f, hi > 0.0f ? hi * 1.1f : 1.0f,
+                      (ImVec2){ igGetContentRegionAvail().x, 36.0f }, sizeof(float));
+        igPopID();
+    }
+    igEnd();
+}
@@ -0,0 +1,12 @@
+/*======================================================================
+  gfx_shader_color.c  –  cube_sapp shader for the Lua draw list
+======================================================================*/
+
+#include "vecmath/vecmath.h"
+#include "gfx_shaders.h"
+#include "cube_sapp.glsl.h"
+
+const sg_shader_desc* gfx_shader_color_desc(sg_backend backend)
+{
+    return cube_shader_desc(backend);
+}
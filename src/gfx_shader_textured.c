@@ -0,0 +1,12 @@
+/*======================================================================
+  gfx_shader_textured.c  –  loadpng_sapp shader for the Lua draw list
+======================================================================*/
+
+#include "vecmath/vecmath.h"
+#include "gfx_shaders.h"
+#include "loadpng_sapp.glsl.h"
+
+const sg_shader_desc* gfx_shader_textured_desc(sg_backend backend)
+{
+    return loadpng_shader_desc(backend);
+}
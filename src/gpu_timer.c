@@ -0,0 +1,217 @@
+/*======================================================================
+  gpu_timer.c  –  per-pass GPU time from GL_TIME_ELAPSED queries
+======================================================================*/
+
+#include "gpu_timer.h"
+#include "sokol_gfx.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* same platforms sokol.c builds with SOKOL_GLCORE */
+#if defined(__MINGW32__) || (defined(__linux__) && !defined(__ANDROID__) && !defined(__EMSCRIPTEN__))
+#define GPU_TIMER_GL 1
+#else
+#define GPU_TIMER_GL 0
+#endif
+
+#if GPU_TIMER_GL
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <GL/gl.h>
+#define GPU_GL_API APIENTRY
+#else
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#define GPU_GL_API
+#endif
+
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED             0x88BF
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT             0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE   0x8867
+#endif
+
+typedef void (GPU_GL_API *gen_queries_fn)(GLsizei n, GLuint *ids);
+typedef void (GPU_GL_API *delete_queries_fn)(GLsizei n, const GLuint *ids);
+typedef void (GPU_GL_API *begin_query_fn)(GLenum target, GLuint id);
+typedef void (GPU_GL_API *end_query_fn)(GLenum target);
+typedef void (GPU_GL_API *get_query_objectiv_fn)(GLuint id, GLenum pname, GLint *params);
+typedef void (GPU_GL_API *get_query_objectui64v_fn)(GLuint id, GLenum pname, uint64_t *params);
+
+static struct {
+    gen_queries_fn           GenQueries;
+    delete_queries_fn        DeleteQueries;
+    begin_query_fn           BeginQuery;
+    end_query_fn             EndQuery;
+    get_query_objectiv_fn    GetQueryObjectiv;
+    get_query_objectui64v_fn GetQueryObjectui64v;
+} gl;
+
+/* sokol's GL loader keeps its pointers private, fetch our own */
+static bool load_gl(void)
+{
+#if defined(_WIN32)
+    HMODULE dll = GetModuleHandleA("opengl32.dll");     // loaded by sokol already
+    if (!dll) return false;
+    typedef PROC (WINAPI *get_proc_fn)(LPCSTR);
+    get_proc_fn get = (get_proc_fn)(void*)GetProcAddress(dll, "wglGetProcAddress");
+    if (!get) return false;
+    gl.GenQueries          = (gen_queries_fn)(void*)get("glGenQueries");
+    gl.DeleteQueries       = (delete_queries_fn)(void*)get("glDeleteQueries");
+    gl.BeginQuery          = (begin_query_fn)(void*)get("glBeginQuery");
+    gl.EndQuery            = (end_query_fn)(void*)get("glEndQuery");
+    gl.GetQueryObjectiv    = (get_query_objectiv_fn)(void*)get("glGetQueryObjectiv");
+    gl.GetQueryObjectui64v = (get_query_objectui64v_fn)(void*)get("glGetQueryObjectui64v");
+#else
+    gl.GenQueries          = glGenQueries;
+    gl.DeleteQueries       = glDeleteQueries;
+    gl.BeginQuery          = glBeginQuery;
+    gl.EndQuery            = glEndQuery;
+    gl.GetQueryObjectiv    = glGetQueryObjectiv;
+    gl.GetQueryObjectui64v = (get_query_objectui64v_fn)glGetQueryObjectui64v;
+#endif
+    return gl.GenQueries && gl.DeleteQueries && gl.BeginQuery && gl.EndQuery &&
+           gl.GetQueryObjectiv && gl.GetQueryObjectui64v;
+}
+#endif /* GPU_TIMER_GL */
+
+#define GPU_TIMER_FRAMES        3       // query sets in flight
+#define GPU_TIMER_MAX_PASSES    8       // timed passes per frame
+
+typedef struct gpu_frame_t {
+    const char *names[GPU_TIMER_MAX_PASSES];
+    unsigned    queries[GPU_TIMER_MAX_PASSES];
+    int         count;
+    bool        pending;        // issued, result not read yet
+} gpu_frame_t;
+
+static struct {
+    bool           valid;
+    bool           gl;          // real queries, else everything reports 0
+    bool           open;        // between begin and end
+    int            current;
+    gpu_frame_t    frames[GPU_TIMER_FRAMES];
+    gpu_timer_pass results[GPU_TIMER_MAX_PASSES];
+    int            num_results;
+    double         total_ms;
+} gt;
+
+void gpu_timer_setup(void)
+{
+    memset(&gt, 0, sizeof(gt));
+#if GPU_TIMER_GL
+    if (sg_query_backend() == SG_BACKEND_GLCORE) {
+        if (load_gl()) {
+            for (int i = 0; i < GPU_TIMER_FRAMES; i++) {
+                gl.GenQueries(GPU_TIMER_MAX_PASSES, (GLuint*)gt.frames[i].queries);
+            }
+            gt.gl = true;
+        } else {
+            fprintf(stderr, "[GPU] timer queries not available, GPU times read 0\n");
+        }
+    }
+#endif
+    gt.valid = true;
+}
+
+void gpu_timer_shutdown(void)
+{
+    if (!gt.valid) return;
+#if GPU_TIMER_GL
+    if (gt.gl) {
+        for (int i = 0; i < GPU_TIMER_FRAMES; i++) {
+            gl.DeleteQueries(GPU_TIMER_MAX_PASSES, (const GLuint*)gt.frames[i].queries);
+        }
+    }
+#endif
+    gt.valid = false;
+}
+
+/* read a finished frame – false while the GPU is still working on it */
+static bool collect(gpu_frame_t *f)
+{
+    double ns[GPU_TIMER_MAX_PASSES] = { 0 };
+#if GPU_TIMER_GL
+    if (gt.gl && f->count) {
+        GLint done = 0;         // queries finish in order, the last one decides
+        gl.GetQueryObjectiv(f->queries[f->count - 1], GL_QUERY_RESULT_AVAILABLE, &done);
+        if (!done) return false;
+        for (int i = 0; i < f->count; i++) {
+            uint64_t v = 0;
+            gl.GetQueryObjectui64v(f->queries[i], GL_QUERY_RESULT, &v);
+            ns[i] = (double)v;
+        }
+    }
+#endif
+    gt.total_ms = 0.0;
+    for (int i = 0; i < f->count; i++) {
+        gt.results[i] = (gpu_timer_pass){ f->names[i], ns[i] * 1e-6 };
+        gt.total_ms += gt.results[i].ms;
+    }
+    gt.num_results = f->count;
+    return true;
+}
+
+void gpu_timer_new_frame(void)
+{
+    if (!gt.valid) return;
+    // oldest first, so the newest finished frame wins
+    for (int i = 1; i <= GPU_TIMER_FRAMES; i++) {
+        gpu_frame_t *f = &gt.frames[(gt.current + i) % GPU_TIMER_FRAMES];
+        if (f->pending && collect(f)) f->pending = false;
+    }
+    gt.current = (gt.current + 1) % GPU_TIMER_FRAMES;
+    gpu_frame_t *f = &gt.frames[gt.current];
+    f->pending = false;                 // still busy: dropped, never waited for
+    f->count = 0;
+    gt.open = false;
+}
+
+void gpu_timer_begin(const char *name)
+{
+    gpu_frame_t *f = &gt.frames[gt.current];
+    if (!gt.valid || gt.open || f->count == GPU_TIMER_MAX_PASSES) return;
+#if GPU_TIMER_GL
+    if (gt.gl) gl.BeginQuery(GL_TIME_ELAPSED, f->queries[f->count]);
+#endif
+    f->names[f->count] = name;
+    gt.open = true;
+}
+
+void gpu_timer_end(void)
+{
+    if (!gt.open) return;
+    gpu_frame_t *f = &gt.frames[gt.current];
+#if GPU_TIMER_GL
+    if (gt.gl) gl.EndQuery(GL_TIME_ELAPSED);
+#endif
+    f->count++;
+    f->pending = true;
+    gt.open = false;
+}
+
+int gpu_timer_results(gpu_timer_pass *out, int max)
+{
+    int n = gt.num_results < max ? gt.num_results : max;
+    memcpy(out, gt.results, (size_t)(n > 0 ? n : 0) * sizeof(gpu_timer_pass));
+    return n;
+}
+
+double gpu_timer_frame_ms(void)
+{
+    return gt.total_ms;
+}
+
+bool gpu_timer_measuring(void)
+{
+    return gt.gl;
+}
@@ -0,0 +1,267 @@
+/*======================================================================
+  log_console.c  –  custom_log lines in a virtualized ImGui window
+======================================================================*/
+
+#include "log_console.h"
+#include "custom_log.h"
+#include "thread_util.h"
+#include "cimgui.h"
+#include "sokol_time.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CONSOLE_ARENA_BYTES ((size_t)16 << 20)
+#define CONSOLE_MAX_LINES   ((size_t)256 << 10)
+#define CONSOLE_SCAN_MS     2.0         // filter work per frame
+#define CONSOLE_SCAN_CHECK  1024        // lines between two clock reads
+
+/* ------------------------------------------------------------------ */
+/*  Storage – text goes into a byte ring (a line never wraps, the     */
+/*  gap at the end is skipped), an 8-byte entry per line indexes it.  */
+/*  Positions and line numbers are absolute 64-bit counters, so       */
+/*  eviction is just moving the "first" markers forward. malloc'd     */
+/*  pages are only touched as the log grows.                          */
+/* ------------------------------------------------------------------ */
+typedef struct console_line_t {
+    uint32_t pos;               // offset into the arena
+    uint16_t len;
+    uint8_t  level;
+    uint8_t  pad;
+} console_line_t;
+
+static struct {
+    bool            valid;
+    mutex_t         lock;       // writer thread appends, UI reads
+    char           *arena;
+    size_t          arena_bytes;
+    console_line_t *lines;
+    size_t          line_mask;
+    uint64_t        head;       // next arena byte (absolute)
+    uint64_t        tail;       // first byte of the oldest line (absolute)
+    uint64_t        first;      // oldest line number
+    uint64_t        end;        // one past the newest line number
+    uint64_t        evicted;
+
+    /* filter results: ascending line numbers, [match_begin, num_matches) live */
+    ImGuiTextFilter filter;
+    uint64_t       *matches;
+    size_t          match_begin, num_matches, cap_matches;
+    uint64_t        scan_next;  // next line to test
+    bool            auto_scroll;
+} con;
+
+static void evict_oldest(void)
+{
+    const console_line_t *l = &con.lines[con.first & con.line_mask];
+    con.first++;
+    con.evicted++;
+    if (con.first == con.end) {
+        con.tail = con.head;
+    } else {
+        // distance to the next line, including a skipped gap at the wrap
+        const console_line_t *n = &con.lines[con.first & con.line_mask];
+        con.tail += ((size_t)n->pos + con.arena_bytes - l->pos) % con.arena_bytes;
+    }
+}
+
+static void console_sink(uint32_t level, const char *text, size_t len, void *user)
+{
+    (void)user;
+    if (len > UINT16_MAX) len = UINT16_MAX;
+
+    mutex_lock(&con.lock);
+    size_t off = (size_t)(con.head % con.arena_bytes);
+    uint64_t start = off + len > con.arena_bytes ? con.head + (con.arena_bytes - off) : con.head;
+    while (con.first != con.end &&
+           (con.end - con.first > con.line_mask || start + len - con.tail > con.arena_bytes)) {
+        evict_oldest();
+    }
+    if (con.first == con.end) con.tail = start;
+
+    size_t pos = (size_t)(start % con.arena_bytes);
+    memcpy(con.arena + pos, text, len);
+    con.lines[con.end & con.line_mask] = (console_line_t){
+        (uint32_t)pos, (uint16_t)len, (uint8_t)(level < 255 ? level : 255), 0 };
+    con.end++;
+    con.head = start + len;
+    mutex_unlock(&con.lock);
+}
+
+/* ------------------------------------------------------------------ */
+/*  Setup / shutdown                                                  */
+/* ------------------------------------------------------------------ */
+void log_console_setup(const log_console_desc *desc)
+{
+    if (con.valid) return;
+    size_t arena = desc && desc->arena_bytes ? desc->arena_bytes : CONSOLE_ARENA_BYTES;
+    size_t lines = desc && desc->max_lines ? desc->max_lines : CONSOLE_MAX_LINES;
+    if (arena > UINT32_MAX) arena = UINT32_MAX;     // console_line_t.pos is 32 bit
+    if (arena < UINT16_MAX) arena = UINT16_MAX;     // room for the longest line
+    size_t pow2 = 1;
+    while (pow2 < lines) pow2 <<= 1;
+
+    memset(&con, 0, sizeof(con));
+    con.arena = (char*)malloc(arena);
+    con.lines = (console_line_t*)malloc(pow2 * sizeof(console_line_t));
+    if (!con.arena || !con.lines) {
+        fprintf(stderr, "[LOG] console: cannot allocate %zu MB\n",
+                (arena + pow2 * sizeof(console_line_t)) >> 20);
+        free(con.arena);
+        free(con.lines);
+        memset(&con, 0, sizeof(con));
+        return;
+    }
+    con.arena_bytes = arena;
+    con.line_mask = pow2 - 1;
+    con.auto_scroll = true;
+    mutex_init(&con.lock);
+    con.valid = true;
+    custom_log_set_sink(console_sink, NULL);
+}
+
+void log_console_shutdown(void)
+{
+    if (!con.valid) return;
+    custom_log_set_sink(NULL, NULL);
+    mutex_destroy(&con.lock);
+    free(con.arena);
+    free(con.lines);
+    free(con.matches);
+    igMemFree(con.filter.Filters.Data);     // ImGuiTextFilter has no C destructor
+    memset(&con, 0, sizeof(con));
+}
+
+/* ------------------------------------------------------------------ */
+/*  Incremental filter – a new filter string restarts the scan, after */
+/*  that only lines appended since the last frame are tested. Called  */
+/*  with the lock held.                                               */
+/* ------------------------------------------------------------------ */
+static void reset_matches(void)
+{
+    con.match_begin = con.num_matches = 0;
+    con.scan_next = con.first;
+}
+
+static bool add_match(uint64_t line)
+{
+    if (con.num_matches == con.cap_matches) {
+        if (con.match_begin > 0) {      // drop evicted entries before growing
+            con.num_matches -= con.match_begin;
+            memmove(con.matches, con.matches + con.match_begin, con.num_matches * sizeof(uint64_t));
+            con.match_begin = 0;
+        }
+        if (con.num_matches == con.cap_matches) {
+            size_t cap = con.cap_matches ? con.cap_matches * 2 : 4096;
+            uint64_t *m = (uint64_t*)realloc(con.matches, cap * sizeof(uint64_t));
+            if (!m) return false;
+            con.matches = m;
+            con.cap_matches = cap;
+        }
+    }
+    con.matches[con.num_matches++] = line;
+    return true;
+}
+
+static void scan_filter(void)
+{
+    while (con.match_begin < con.num_matches && con.matches[con.match_begin] < con.first) {
+        con.match_begin++;
+    }
+    if (con.scan_next < con.first) con.scan_next = con.first;
+
+    uint64_t t0 = stm_now();
+    int n = 0;
+    while (con.scan_next < con.end) {
+        const console_line_t *l = &con.lines[con.scan_next & con.line_mask];
+        const char *text = con.arena + l->pos;
+        if (ImGuiTextFilter_PassFilter(&con.filter, text, text + l->len) && !add_match(con.scan_next)) {
+            break;
+        }
+        con.scan_next++;
+        if (++n == CONSOLE_SCAN_CHECK) {
+            if (stm_ms(stm_since(t0)) > CONSOLE_SCAN_MS) break;
+            n = 0;
+        }
+    }
+}
+
+/* ------------------------------------------------------------------ */
+/*  Window                                                            */
+/* ------------------------------------------------------------------ */
+static const ImVec4 level_colors[] = {
+    { 1.0f, 0.3f, 0.3f, 1.0f },     // panic
+    { 1.0f, 0.4f, 0.4f, 1.0f },     // error
+    { 1.0f, 0.8f, 0.3f, 1.0f },     // warn
+    { 0.9f, 0.9f, 0.9f, 1.0f },     // info
+    { 0.6f, 0.6f, 0.6f, 1.0f },     // debug
+};
+
+void log_console_window(bool *open)
+{
+    if (!*open) return;
+    igSetNextWindowSize((ImVec2){ 760, 420 }, ImGuiCond_FirstUseEver);
+    if (!igBegin("Log", open, ImGuiWindowFlags_None)) {
+        igEnd();
+        return;
+    }
+    if (!con.valid) {
+        igTextUnformatted("log console not set up");
+        igEnd();
+        return;
+    }
+
+    mutex_lock(&con.lock);
+    if (igButton("Clear")) {
+        con.first = con.end;
+        con.tail = con.head;
+        reset_matches();
+    }
+    igSameLine();
+    igCheckbox("Auto-scroll", &con.auto_scroll);
+    igSameLine();
+    if (ImGuiTextFilter_Draw(&con.filter, "Filter (inc,-exc)", 300.0f)) reset_matches();
+
+    bool filtered = ImGuiTextFilter_IsActive(&con.filter);
+    if (filtered) scan_filter();
+    uint64_t total = con.end - con.first;
+    uint64_t shown = filtered ? con.num_matches - con.match_begin : total;
+    if (shown > INT32_MAX) shown = INT32_MAX;
+
+    igText("%llu lines, %.1f / %.0f MB, %llu evicted, %llu dropped",
+           (unsigned long long)total, (double)(con.head - con.tail) / (1 << 20),
+           (double)con.arena_bytes / (1 << 20), (unsigned long long)con.evicted,
+           (unsigned long long)custom_log_dropped());
+    if (filtered) {
+        igSameLine();
+        if (con.scan_next < con.end && total) {
+            igText("| %llu matches, scanning %.0f%%", (unsigned long long)shown,
+                   100.0 * (double)(con.scan_next - con.first) / (double)total);
+        } else {
+            igText("| %llu matches", (unsigned long long)shown);
+        }
+    }
+    igSeparator();
+
+    if (igBeginChild("log_lines", (ImVec2){ 0, 0 }, ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar)) {
+        ImGuiListClipper clipper;
+        memset(&clipper, 0, sizeof(clipper));
+        ImGuiListClipper_Begin(&clipper, (int)shown, -1.0f);
+        while (ImGuiListClipper_Step(&clipper)) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                uint64_t n = filtered ? con.matches[con.match_begin + (size_t)i] : con.first + (uint64_t)i;
+                const console_line_t *l = &con.lines[n & con.line_mask];
+                const char *text = con.arena + l->pos;
+                int level = l->level < 4 ? l->level : 4;
+                igPushStyleColorImVec4(ImGuiCol_Text, level_colors[level]);
+                igTextUnformattedEx(text, text + l->len);
+                igPopStyleColor();
+            }
+        }
+        if (con.auto_scroll && igGetScrollY() >= igGetScrollMaxY()) igSetScrollHereY(1.0f);
+    }
+    igEndChild();
+    mutex_unlock(&con.lock);
+    igEnd();
+}
@@ -0,0 +1,376 @@
+/*======================================================================
+  lua_alloc.c  –  size-class pools + TLSF heap for the Lua state
+======================================================================*/
+
+#include "lua_alloc.h"
+#include "mem_track.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ALIGN_LOG2        4
+#define ALIGN_SIZE        (1u << ALIGN_LOG2)         // 16, max_align_t
+#define SL_LOG2           4
+#define SL_COUNT          (1u << SL_LOG2)            // 16 sub-lists per class
+#define FL_SHIFT          (SL_LOG2 + ALIGN_LOG2)
+#define SMALL_BLOCK       (1u << FL_SHIFT)           // 256
+#define FL_COUNT          40                         // up to 2^47 bytes
+
+#define POOL_MAX_SIZE     256                        // <= goes to the pools
+#define POOL_CLASS_COUNT  (POOL_MAX_SIZE / ALIGN_SIZE)
+#define POOL_PAGE_SIZE    (16 * 1024)
+#define AREA_SIZE         (1024 * 1024)              // default heap growth
+
+/* ------------------------------------------------------------------ */
+/*  Heap block layout                                                  */
+/*                                                                     */
+/*  [prev_phys][size|free] payload ...                                 */
+/*  prev_phys is always valid, free blocks keep their list links in    */
+/*  the payload. Every area ends with a zero-sized used sentinel.      */
+/* ------------------------------------------------------------------ */
+typedef struct block_t {
+    struct block_t *prev_phys;
+    size_t size;                    // payload size, bit 0 = free
+    struct block_t *next_free;      // payload starts here
+    struct block_t *prev_free;
+} block_t;
+
+typedef struct area_t {
+    struct area_t *next;
+    size_t size;                    // bytes taken from the system
+} area_t;
+
+#define BLOCK_HEADER      (offsetof(block_t, next_free))
+#define BLOCK_MIN         (sizeof(block_t) - BLOCK_HEADER)
+#define BLOCK_FREE_BIT    ((size_t)1)
+
+typedef struct pool_node_t {
+    struct pool_node_t *next;
+} pool_node_t;
+
+struct lua_alloc_t {
+    uint64_t fl_bitmap;
+    uint32_t sl_bitmap[FL_COUNT];
+    block_t *blocks[FL_COUNT][SL_COUNT];
+    area_t *areas;
+
+    pool_node_t *pools[POOL_CLASS_COUNT];
+
+    lua_alloc_stats_t stats;
+    uint32_t cur_allocs;            // running counters of the current frame
+    uint32_t cur_frees;
+    size_t   cur_bytes;
+};
+
+/* ------------------------------------------------------------------ */
+/*  Bit helpers                                                        */
+/* ------------------------------------------------------------------ */
+#if defined(_MSC_VER)
+#include <intrin.h>
+static int bit_msb(size_t v) { unsigned long i; _BitScanReverse64(&i, (unsigned __int64)v); return (int)i; }
+static int bit_lsb(uint64_t v) { unsigned long i; _BitScanForward64(&i, v); return (int)i; }
+#else
+static int bit_msb(size_t v) { return 63 - __builtin_clzll((unsigned long long)v); }
+static int bit_lsb(uint64_t v) { return __builtin_ctzll(v); }
+#endif
+
+static size_t align_up(size_t v) { return (v + ALIGN_SIZE - 1) & ~(size_t)(ALIGN_SIZE - 1); }
+
+/* ------------------------------------------------------------------ */
+/*  Block accessors                                                    */
+/* ------------------------------------------------------------------ */
+static size_t block_size(const block_t *b) { return b->size & ~BLOCK_FREE_BIT; }
+static int    block_is_free(const block_t *b) { return (int)(b->size & BLOCK_FREE_BIT); }
+static void*  block_payload(block_t *b) { return (char*)b + BLOCK_HEADER; }
+static block_t* block_from_payload(void *p) { return (block_t*)((char*)p - BLOCK_HEADER); }
+static block_t* block_next(block_t *b) { return (block_t*)((char*)b + BLOCK_HEADER + block_size(b)); }
+
+/* ------------------------------------------------------------------ */
+/*  TLSF mapping: size → (first level, second level) list              */
+/* ------------------------------------------------------------------ */
+static void mapping_insert(size_t size, int *fl, int *sl)
+{
+    if (size < SMALL_BLOCK) {
+        *fl = 0;
+        *sl = (int)(size >> ALIGN_LOG2);
+    } else {
+        int m = bit_msb(size);
+        *sl = (int)((size >> (m - SL_LOG2)) ^ SL_COUNT);
+        *fl = m - FL_SHIFT + 1;
+    }
+}
+
+/* round up so that every block in the resulting list is large enough */
+static void mapping_search(size_t size, int *fl, int *sl)
+{
+    if (size >= SMALL_BLOCK) {
+        size += ((size_t)1 << (bit_msb(size) - SL_LOG2)) - 1;
+    }
+    mapping_insert(size, fl, sl);
+}
+
+static void remove_free(lua_alloc_t *a, block_t *b)
+{
+    int fl, sl;
+    mapping_insert(block_size(b), &fl, &sl);
+    if (b->next_free) b->next_free->prev_free = b->prev_free;
+    if (b->prev_free) b->prev_free->next_free = b->next_free;
+    if (a->blocks[fl][sl] == b) {
+        a->blocks[fl][sl] = b->next_free;
+        if (!b->next_free) {
+            a->sl_bitmap[fl] &= ~(1u << sl);
+            if (!a->sl_bitmap[fl]) a->fl_bitmap &= ~((uint64_t)1 << fl);
+        }
+    }
+}
+
+static void insert_free(lua_alloc_t *a, block_t *b)
+{
+    int fl, sl;
+    mapping_insert(block_size(b), &fl, &sl);
+    b->size |= BLOCK_FREE_BIT;
+    b->prev_free = NULL;
+    b->next_free = a->blocks[fl][sl];
+    if (b->next_free) b->next_free->prev_free = b;
+    a->blocks[fl][sl] = b;
+    a->sl_bitmap[fl] |= 1u << sl;
+    a->fl_bitmap |= (uint64_t)1 << fl;
+}
+
+static block_t* find_free(lua_alloc_t *a, size_t size)
+{
+    int fl, sl;
+    mapping_search(size, &fl, &sl);
+    if (fl >= FL_COUNT) return NULL;
+
+    uint32_t sl_map = a->sl_bitmap[fl] & (~0u << sl);
+    if (!sl_map) {
+        uint64_t fl_map = a->fl_bitmap & (~(uint64_t)0 << (fl + 1));
+        if (!fl_map) return NULL;
+        fl = bit_lsb(fl_map);
+        sl_map = a->sl_bitmap[fl];
+    }
+    sl = bit_lsb(sl_map);
+    return a->blocks[fl][sl];
+}
+
+/* ------------------------------------------------------------------ */
+/*  Areas – one free block plus an end sentinel                        */
+/* ------------------------------------------------------------------ */
+static int add_area(lua_alloc_t *a, size_t payload)
+{
+    size_t overhead = sizeof(area_t) + 2 * BLOCK_HEADER;
+    size_t size = payload + overhead > AREA_SIZE ? payload + overhead : AREA_SIZE;
+    area_t *area = (area_t*)mem_track_alloc(MEM_TAG_LUA, size);
+    if (!area) return 0;
+    area->size = size;
+    area->next = a->areas;
+    a->areas = area;
+    a->stats.reserved_bytes += size;
+
+    block_t *b = (block_t*)(area + 1);
+    b->prev_phys = NULL;
+    b->size = size - overhead;
+    block_t *sentinel = block_next(b);
+    sentinel->prev_phys = b;
+    sentinel->size = 0;
+    insert_free(a, b);
+    return 1;
+}
+
+static void release_area(lua_alloc_t *a, area_t *area)
+{
+    for (area_t **it = &a->areas; *it; it = &(*it)->next) {
+        if (*it == area) {
+            *it = area->next;
+            break;
+        }
+    }
+    a->stats.reserved_bytes -= area->size;
+    mem_track_free(area);
+}
+
+/* ------------------------------------------------------------------ */
+/*  Heap alloc / free                                                  */
+/* ------------------------------------------------------------------ */
+static void* heap_alloc(lua_alloc_t *a, size_t size)
+{
+    size = align_up(size < BLOCK_MIN ? BLOCK_MIN : size);
+    block_t *b = find_free(a, size);
+    if (!b) {
+        /* the search rounds up to the next list, so must the new area */
+        size_t need = size;
+        if (size >= SMALL_BLOCK) need += (size_t)1 << (bit_msb(size) - SL_LOG2);
+        if (!add_area(a, need)) return NULL;
+        b = find_free(a, size);
+    }
+    remove_free(a, b);
+    b->size = block_size(b);
+
+    /* split off the tail if it can hold a minimal block */
+    size_t bsize = block_size(b);
+    if (bsize >= size + BLOCK_HEADER + BLOCK_MIN) {
+        block_t *rest = (block_t*)((char*)b + BLOCK_HEADER + size);
+        rest->prev_phys = b;
+        rest->size = bsize - size - BLOCK_HEADER;
+        block_next(rest)->prev_phys = rest;
+        b->size = size;
+        insert_free(a, rest);
+    }
+    return block_payload(b);
+}
+
+static void heap_free(lua_alloc_t *a, void *p)
+{
+    block_t *b = block_from_payload(p);
+    block_t *next = block_next(b);
+
+    if (block_is_free(next)) {
+        remove_free(a, next);
+        b->size = block_size(b) + BLOCK_HEADER + block_size(next);
+        block_next(b)->prev_phys = b;
+    }
+    if (b->prev_phys && block_is_free(b->prev_phys)) {
+        block_t *prev = b->prev_phys;
+        remove_free(a, prev);
+        prev->size = block_size(prev) + BLOCK_HEADER + block_size(b);
+        block_next(prev)->prev_phys = prev;
+        b = prev;
+    }
+
+    /* give oversized areas back once they are completely free */
+    if (!b->prev_phys && block_next(b)->size == 0) {
+        area_t *area = (area_t*)b - 1;
+        if (area->size > AREA_SIZE) {
+            release_area(a, area);
+            return;
+        }
+    }
+    insert_free(a, b);
+}
+
+/* ------------------------------------------------------------------ */
+/*  Size-class pools – pages are carved out of the heap                */
+/* ------------------------------------------------------------------ */
+static int pool_class(size_t size) { return (int)((size - 1) >> ALIGN_LOG2); }
+
+static void* pool_alloc(lua_alloc_t *a, size_t size)
+{
+    int c = pool_class(size);
+    pool_node_t *n = a->pools[c];
+    if (!n) {
+        size_t stride = (size_t)(c + 1) * ALIGN_SIZE;
+        char *page = (char*)heap_alloc(a, POOL_PAGE_SIZE);
+        if (!page) return NULL;
+        for (size_t off = 0; off + stride <= POOL_PAGE_SIZE; off += stride) {
+            pool_node_t *node = (pool_node_t*)(page + off);
+            node->next = n;
+            n = node;
+        }
+    }
+    a->pools[c] = n->next;
+    return n;
+}
+
+static void pool_free(lua_alloc_t *a, void *p, size_t size)
+{
+    int c = pool_class(size);
+    pool_node_t *n = (pool_node_t*)p;
+    n->next = a->pools[c];
+    a->pools[c] = n;
+}
+
+static void* raw_alloc(lua_alloc_t *a, size_t size)
+{
+    return size <= POOL_MAX_SIZE ? pool_alloc(a, size) : heap_alloc(a, size);
+}
+
+static void raw_free(lua_alloc_t *a, void *p, size_t size)
+{
+    if (size <= POOL_MAX_SIZE) pool_free(a, p, size);
+    else heap_free(a, p);
+}
+
+/* ------------------------------------------------------------------ */
+/*  Public API                                                         */
+/* ------------------------------------------------------------------ */
+lua_alloc_t* lua_alloc_create(void)
+{
+    lua_alloc_t *a = (lua_alloc_t*)mem_track_alloc(MEM_TAG_LUA, sizeof(lua_alloc_t));
+    if (!a) return NULL;
+    memset(a, 0, sizeof(lua_alloc_t));
+    if (!add_area(a, 0)) {
+        mem_track_free(a);
+        return NULL;
+    }
+    return a;
+}
+
+void lua_alloc_destroy(lua_alloc_t *a)
+{
+    if (!a) return;
+    area_t *area = a->areas;
+    while (area) {
+        area_t *next = area->next;
+        mem_track_free(area);
+        area = next;
+    }
+    mem_track_free(a);
+}
+
+void* lua_alloc_fn(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    lua_alloc_t *a = (lua_alloc_t*)ud;
+    if (!ptr) osize = 0;                  // osize is a type tag for new objects
+
+    if (nsize == 0) {
+        if (ptr) {
+            raw_free(a, ptr, osize);
+            a->stats.current_bytes -= osize;
+            a->stats.total_frees++;
+            a->cur_frees++;
+        }
+        return NULL;
+    }
+
+    void *p;
+    if (!ptr) {
+        p = raw_alloc(a, nsize);
+    } else if (osize <= POOL_MAX_SIZE && nsize <= POOL_MAX_SIZE
+               && pool_class(osize) == pool_class(nsize)) {
+        p = ptr;                          // same size class
+    } else if (osize > POOL_MAX_SIZE && nsize > POOL_MAX_SIZE
+               && nsize <= block_size(block_from_payload(ptr))
+               && nsize >= block_size(block_from_payload(ptr)) / 2) {
+        p = ptr;                          // shrink inside the same block
+    } else {
+        p = raw_alloc(a, nsize);
+        if (!p) return NULL;
+        memcpy(p, ptr, osize < nsize ? osize : nsize);
+        raw_free(a, ptr, osize);
+    }
+    if (!p) return NULL;
+
+    a->stats.current_bytes += nsize - osize;
+    if (a->stats.current_bytes > a->stats.peak_bytes) {
+        a->stats.peak_bytes = a->stats.current_bytes;
+    }
+    a->stats.total_allocs++;
+    a->cur_allocs++;
+    a->cur_bytes += nsize;
+    return p;
+}
+
+void lua_alloc_new_frame(lua_alloc_t *a)
+{
+    a->stats.frame_allocs = a->cur_allocs;
+    a->stats.frame_frees = a->cur_frees;
+    a->stats.frame_bytes = a->cur_bytes;
+    a->cur_allocs = 0;
+    a->cur_frees = 0;
+    a->cur_bytes = 0;
+}
+
+lua_alloc_stats_t lua_alloc_get_stats(const lua_alloc_t *a)
+{
+    return a->stats;
+}
@@ -5,27 +5,82 @@
 #include "sokol_gfx.h"
 #include "sokol_log.h"
 #include "sokol_glue.h"
+#include "sokol_time.h"
+#include "sokol_args.h"
 #include "cimgui.h"
 #include "sokol_imgui.h"
+#include "custom_log.h"
+#include "log_console.h"
+#include "frame_prof.h"
+#include "gpu_timer.h"
+#include "frame_stats.h"
+#include "mem_track.h"
+#include <math.h>
+#include <stdlib.h>
 
 #include "module_lua.h"
+#include "file_watch.h"
 #include "module_cimgui.h"
+#include "module_math.h"
+#include "module_gfx.h"
+#include "module_asset.h"
+#include "module_jobs.h"
+#include "module_sched.h"
+#include "module_input.h"
+
+/* fixed-step simulation clock for the script's _update(dt) */
+#define SIM_DEFAULT_HZ  60.0        // unless the script sets UPDATE_HZ
+#define SIM_MAX_STEPS   8           // catch-up limit per frame (no spiral of death)
+#define SIM_MAX_FRAME   0.25        // longer frames (breakpoint, hitch) are clamped
 
 static struct {
     sg_pass_action pass_action;
+    const char *script;             // first non --option argument or "script.lua"
+    bool show_profiler;             // F9
+    bool show_log;                  // F8
+    bool show_frame_prof;           // F7
+    bool show_frame_stats;          // F5
+    bool show_memory;               // F4
+    int trace_frames;               // --trace=N, also what F6 captures
+    const char *trace_path;         // --trace-file=path
+    double sim_accumulator;         // simulated time still owed, seconds
 } state;
 
 static void init(void) {
+    mem_track_setup(sargs_exists("--mem-leaks"));  // before anything allocates through it
+    stm_setup();
+    frame_prof_setup();
+    if (sargs_exists("--trace")) frame_prof_capture(state.trace_frames, state.trace_path);
+    custom_log_setup(&(custom_log_desc){ 0 });     // LOG_* → writer thread → stdout
+    size_t log_mb = (size_t)atoi(sargs_value("--log-mb"));    // 0 without the flag: 16 MB, 320 keeps 5M lines
+    log_console_setup(&(log_console_desc){                  // … and the F8 window
+        .arena_bytes = log_mb << 20,
+        .max_lines = log_mb << 14,  // ~64 bytes a line
+    });
     sg_setup(&(sg_desc){
         .environment = sglue_environment(),
-        .logger.func = slog_func,
+        .allocator = { mem_track_alloc_cb, mem_track_free_cb, MEM_TRACK_USER(MEM_TAG_GFX) },
+        .logger.func = custom_log_slog,
+    });
+    igSetAllocatorFunctions(mem_track_alloc_cb, mem_track_free_cb, MEM_TRACK_USER(MEM_TAG_IMGUI));
+    simgui_setup(&(simgui_desc_t){
+        .allocator = { mem_track_alloc_cb, mem_track_free_cb, MEM_TRACK_USER(MEM_TAG_IMGUI) },
+        .logger.func = custom_log_slog,
     });
-    simgui_setup(&(simgui_desc_t){ 0 });
+    gpu_timer_setup();              // GL time queries, 0 ms on other backends
+    frame_stats_setup(sargs_value("--stats-csv"));  // "" without the flag: no file
 
+    file_watch_init();              // once – load_script() adds, lua_module_poll_reload() polls
     lua_module_init();
+    math_module_init(get_lua_state());
+    gfx_module_init(get_lua_state());
+    asset_module_init(get_lua_state());
+    jobs_module_init(get_lua_state());
+    sched_module_init(get_lua_state());
+    input_module_init(get_lua_state());
     cimgui_module_init(get_lua_state());
 
-    load_script("script.lua"); 
+    load_script(state.script ? state.script : "script.lua");
 
     // initial clear color
     state.pass_action = (sg_pass_action) {
@@ -33,7 +88,43 @@ static void init(void) {
     };
 }
 
+/* run _update(dt) as often as the elapsed time asks for, return alpha for _render */
+static double simulate(void) {
+    if (!lua_module_has_update()) {
+        state.sim_accumulator = 0.0;
+        return 1.0;
+    }
+    const double dt = 1.0 / lua_module_update_hz(SIM_DEFAULT_HZ);
+    double frame_time = sapp_frame_duration();
+    if (frame_time > SIM_MAX_FRAME) frame_time = SIM_MAX_FRAME;
+    state.sim_accumulator += frame_time;
+
+    int steps = 0;
+    while (state.sim_accumulator >= dt && steps < SIM_MAX_STEPS) {
+        PROF_ZONE("_update") { lua_module_update(dt); }
+        state.sim_accumulator -= dt;
+        steps++;
+    }
+    if (state.sim_accumulator >= dt) {
+        state.sim_accumulator = fmod(state.sim_accumulator, dt);   // drop the backlog
+    }
+    return state.sim_accumulator / dt;
+}
+
 static void frame(void) {
+    frame_prof_new_frame();         // closes the previous frame's zones
+    gpu_timer_new_frame();          // ...and reads pass times that are ready
+    mem_track_new_frame(sapp_frame_duration());
+    PROF_ZONE("lua_module_new_frame") {
+        lua_module_new_frame();
+        lua_module_poll_reload();
+    }
+    asset_module_update();          // resumes coroutines waiting in asset.load
+    PROF_ZONE("sched_module_update") { sched_module_update(); }     // ...and the ones whose sched.sleep is over
+    PROF_ZONE("input_module_dispatch") { input_module_dispatch(); } // _event(e) for this frame's input, before _update
+    double alpha = 1.0;
+    PROF_ZONE("simulate") { alpha = simulate(); }
+
     simgui_new_frame(&(simgui_frame_desc_t){
         .width = sapp_width(),
         .height = sapp_height(),
@@ -54,29 +145,80 @@ static void frame(void) {
 
     // igEnd();
 
-    cimgui_module_frame();          // ← this draws the Lua UI
+    PROF_ZONE("cimgui_module_frame") { cimgui_module_frame(alpha); }    // ← this draws the Lua UI
+    lua_module_profiler_window(&state.show_profiler);
+    log_console_window(&state.show_log);
+    frame_prof_window(&state.show_frame_prof);
+    frame_stats_window(&state.show_frame_stats);
+    mem_track_window(&state.show_memory);
 
     /*=== UI CODE ENDS HERE ===*/
 
+    gpu_timer_begin("gpu main pass ms");
     sg_begin_pass(&(sg_pass){ .action = state.pass_action, .swapchain = sglue_swapchain() });
-    simgui_render();
+    PROF_ZONE("gfx_module_draw") { gfx_module_draw(); }    // ← Lua meshes, sorted by pipeline/bindings
+    PROF_ZONE("simgui_render") { simgui_render(); }
     sg_end_pass();
-    sg_commit();
+    gpu_timer_end();
+    PROF_ZONE("sg_commit") { sg_commit(); }
+
+    frame_stats_update(sapp_frame_duration());     // history, CSV row, profiler counters
+
+    PROF_ZONE("lua_module_gc_step") { lua_module_gc_step(sapp_frame_duration()); }
 }
 
 static void cleanup(void) {
+    asset_module_shutdown();
+    jobs_module_shutdown();
+    sched_module_shutdown();
     lua_module_shutdown(); 
+    file_watch_shutdown();
+    gfx_module_shutdown();
     simgui_shutdown();
+    frame_stats_shutdown();
+    gpu_timer_shutdown();
     sg_shutdown();
+    frame_prof_shutdown();
+    custom_log_shutdown();          // flushes what is still queued
+    log_console_shutdown();
+    sargs_shutdown();
+    mem_track_report_leaks();       // per block with --mem-leaks
 }
 
 static void event(const sapp_event* ev) {
-    simgui_handle_event(ev);
+    if (ev->type == SAPP_EVENTTYPE_KEY_DOWN && ev->key_code == SAPP_KEYCODE_F9 && !ev->key_repeat) {
+        state.show_profiler = !state.show_profiler;
+    }
+    if (ev->type == SAPP_EVENTTYPE_KEY_DOWN && ev->key_code == SAPP_KEYCODE_F8 && !ev->key_repeat) {
+        state.show_log = !state.show_log;
+    }
+    if (ev->type == SAPP_EVENTTYPE_KEY_DOWN && ev->key_code == SAPP_KEYCODE_F7 && !ev->key_repeat) {
+        state.show_frame_prof = !state.show_frame_prof;
+    }
+    if (ev->type == SAPP_EVENTTYPE_KEY_DOWN && ev->key_code == SAPP_KEYCODE_F4 && !ev->key_repeat) {
+        state.show_memory = !state.show_memory;
+    }
+    if (ev->type == SAPP_EVENTTYPE_KEY_DOWN && ev->key_code == SAPP_KEYCODE_F5 && !ev->key_repeat) {
+        state.show_frame_stats = !state.show_frame_stats;
+    }
+    if (ev->type == SAPP_EVENTTYPE_KEY_DOWN && ev->key_code == SAPP_KEYCODE_F6 && !ev->key_repeat) {
+        frame_prof_capture(state.trace_frames, state.trace_path);
+    }
+    const bool ui = simgui_handle_event(ev);
+    input_module_event(ev, ui);     // queued, the script sees it next frame()
 }
 
 sapp_desc sokol_main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
+    sargs_setup(&(sargs_desc){ .argc = argc, .argv = argv });
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') {
+            state.script = argv[i];     // e.g. demo bench_ui.lua --trace=300
+            break;
+        }
+    }
+    state.trace_frames = atoi(sargs_value_def("--trace", "300"));
+    if (state.trace_frames <= 0) state.trace_frames = 300;     // bare --trace
+    state.trace_path = sargs_value_def("--trace-file", "trace.json");
     return (sapp_desc){
         .init_cb = init,
         .frame_cb = frame,
@@ -86,7 +228,7 @@ sapp_desc sokol_main(int argc, char* argv[]) {
         .width = 800,
         .height = 600,
         .icon.sokol_default = true,
-        .logger.func = slog_func,
+        .logger.func = custom_log_slog,
         .win32_console_utf8 = true,
         //.win32_console_create = true, // this create console terminal. this will not work when ide.
         .win32_console_attach = true, // this for ide for terminal.
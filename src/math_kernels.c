@@ -0,0 +1,61 @@
+/*======================================================================
+  math_kernels.c  –  SoA bulk transforms on float streams
+======================================================================*/
+
+#include "math_kernels.h"
+
+void kernel_transform_points(const mat44_t *m,
+                             const float *xs, const float *ys, const float *zs,
+                             float *ox, float *oy, float *oz, size_t n)
+{
+    const mat44_t t = *m;                 // keep the matrix in registers
+    for (size_t i = 0; i < n; i++) {
+        float x = xs[i], y = ys[i], z = zs[i];
+        ox[i] = x * t.x.x + y * t.y.x + z * t.z.x + t.w.x;
+        oy[i] = x * t.x.y + y * t.y.y + z * t.z.y + t.w.y;
+        oz[i] = x * t.x.z + y * t.y.z + z * t.z.z + t.w.z;
+    }
+}
+
+void kernel_lerp(float *out, const float *a, const float *b, float t, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] + (b[i] - a[i]) * t;
+    }
+}
+
+void kernel_lerp_array(float *out, const float *a, const float *b, const float *t, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] + (b[i] - a[i]) * t[i];
+    }
+}
+
+void kernel_madd(float *out, const float *a, const float *b, float s, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] + b[i] * s;
+    }
+}
+
+void kernel_model_matrices(mat44_t *out,
+                           const float *px, const float *py, const float *pz,
+                           const float *qx, const float *qy, const float *qz, const float *qw,
+                           const float *sx, const float *sy, const float *sz, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        float x = qx[i], y = qy[i], z = qz[i], w = qw[i];
+        float xx = x * x, yy = y * y, zz = z * z;
+        float xy = x * y, xz = x * z, yz = y * z;
+        float wx = w * x, wy = w * y, wz = w * z;
+
+        /* rows of mat44_from_quat, each scaled like mat44_scaling * R */
+        out[i].x = vec4(sx[i] * (1.0f - 2.0f * (yy + zz)), sx[i] * 2.0f * (xy + wz),
+                        sx[i] * 2.0f * (xz - wy), 0.0f);
+        out[i].y = vec4(sy[i] * 2.0f * (xy - wz), sy[i] * (1.0f - 2.0f * (xx + zz)),
+                        sy[i] * 2.0f * (yz + wx), 0.0f);
+        out[i].z = vec4(sz[i] * 2.0f * (xz + wy), sz[i] * 2.0f * (yz - wx),
+                        sz[i] * (1.0f - 2.0f * (xx + yy)), 0.0f);
+        out[i].w = vec4(px[i], py[i], pz[i], 1.0f);
+    }
+}
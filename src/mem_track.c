@@ -0,0 +1,332 @@
+/*======================================================================
+  mem_track.c  –  tagged malloc wrapper: per-subsystem bytes and leaks
+======================================================================*/
+
+#include "mem_track.h"
+#include "thread_util.h"
+#include "cimgui.h"
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#define MEM_BACKTRACE(frames, n) CaptureStackBackTrace(0, (DWORD)(n), (frames), NULL)    // windows.h via thread_util.h
+#elif defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define MEM_BACKTRACE(frames, n) backtrace((frames), (n))
+#endif
+
+#if defined(_MSC_VER)
+#define MEM_NOINLINE __declspec(noinline)
+#else
+#define MEM_NOINLINE __attribute__((noinline))
+#endif
+
+#define MEM_MAGIC           0x4d454d54u     // "MEMT"
+#define MEM_MAGIC_LINKED    0x4d454d4cu     // "MEML", on the live list
+#define MEM_RATE_SECONDS    0.5             // window of the allocs/s figures
+#define MEM_REPORT_BLOCKS   16              // live blocks listed per tag at exit
+#define MEM_SITE_FRAMES     6               // callers kept per block with capture_sites
+#define MEM_SITE_SKIP       2               // capture_site() and alloc_at() themselves
+
+/* ------------------------------------------------------------------ */
+/*  Every block carries a header in front of the user pointer. With   */
+/*  capture_sites the headers of live blocks form a list (one mutex). */
+/* ------------------------------------------------------------------ */
+typedef struct mem_header_t {
+    struct mem_header_t *prev, *next;
+    size_t   size;
+    uint64_t seq;               // allocation number, stable across runs of the same input
+    void    *site[MEM_SITE_FRAMES];     // innermost first: the library's malloc hook, then its callers
+    uint32_t tag;
+    uint32_t magic;
+} mem_header_t;
+
+#define HEADER_SIZE ((sizeof(mem_header_t) + 15) & ~(size_t)15)   // keeps 16-byte alignment
+
+static const char *tag_names[MEM_TAG_NUM] = {
+    [MEM_TAG_GFX]   = "sokol_gfx",
+    [MEM_TAG_FETCH] = "sokol_fetch",
+    [MEM_TAG_IMGUI] = "imgui",
+    [MEM_TAG_LUA]   = "lua",
+    [MEM_TAG_IMAGE] = "stb_image",
+};
+
+typedef struct mem_counters_t {
+    alignas(64) atomic_size_t current;
+    atomic_size_t             peak;
+    atomic_uint_fast64_t      allocs;
+    atomic_uint_fast64_t      frees;
+} mem_counters_t;
+
+static struct {
+    mem_counters_t tags[MEM_TAG_NUM];
+    atomic_uint_fast64_t seq;
+    atomic_bool    capture;
+    mutex_t        lock;        // live list
+    mem_header_t  *live;
+
+    /* main thread: rate windows */
+    double         window;
+    uint64_t       window_allocs[MEM_TAG_NUM];
+    uint64_t       window_frees[MEM_TAG_NUM];
+    float          allocs_per_second[MEM_TAG_NUM];
+    float          frees_per_second[MEM_TAG_NUM];
+} mt;
+
+static void count_alloc(mem_tag tag, size_t size)
+{
+    mem_counters_t *c = &mt.tags[tag];
+    size_t now = atomic_fetch_add_explicit(&c->current, size, memory_order_relaxed) + size;
+    size_t peak = atomic_load_explicit(&c->peak, memory_order_relaxed);
+    while (now > peak && !atomic_compare_exchange_weak_explicit(&c->peak, &peak, now,
+                                memory_order_relaxed, memory_order_relaxed)) {}
+    atomic_fetch_add_explicit(&c->allocs, 1, memory_order_relaxed);
+}
+
+static void count_free(mem_tag tag, size_t size)
+{
+    mem_counters_t *c = &mt.tags[tag];
+    atomic_fetch_sub_explicit(&c->current, size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&c->frees, 1, memory_order_relaxed);
+}
+
+static void link_block(mem_header_t *h)
+{
+    mutex_lock(&mt.lock);
+    h->prev = NULL;
+    h->next = mt.live;
+    if (mt.live) mt.live->prev = h;
+    mt.live = h;
+    mutex_unlock(&mt.lock);
+}
+
+/* with mt.lock held */
+static void unlink_block(mem_header_t *h)
+{
+    if (h->prev) h->prev->next = h->next;
+    else mt.live = h->next;
+    if (h->next) h->next->prev = h->prev;
+}
+
+/* the sokol/ImGui/stb hooks all funnel through one wrapper per library,
+   so a single return address would name that wrapper – keep a few frames */
+static MEM_NOINLINE void capture_site(void **site)
+{
+    memset(site, 0, MEM_SITE_FRAMES * sizeof(void*));
+#if defined(MEM_BACKTRACE)
+    void *frames[MEM_SITE_SKIP + MEM_SITE_FRAMES];
+    int n = (int)MEM_BACKTRACE(frames, MEM_SITE_SKIP + MEM_SITE_FRAMES);
+    for (int i = MEM_SITE_SKIP; i < n; i++) site[i - MEM_SITE_SKIP] = frames[i];
+#else
+    site[0] = __builtin_return_address(2);     // the caller of the library's hook
+#endif
+}
+
+static MEM_NOINLINE void* alloc_at(mem_tag tag, size_t size)
+{
+    if ((unsigned)tag >= MEM_TAG_NUM) tag = MEM_TAG_GFX;
+    mem_header_t *h = (mem_header_t*)malloc(HEADER_SIZE + size);
+    if (!h) return NULL;
+    h->size = size;
+    h->seq = atomic_fetch_add_explicit(&mt.seq, 1, memory_order_relaxed) + 1;
+    h->tag = (uint32_t)tag;
+    h->magic = MEM_MAGIC;
+    h->prev = h->next = NULL;
+    if (atomic_load_explicit(&mt.capture, memory_order_relaxed)) {
+        capture_site(h->site);
+        h->magic = MEM_MAGIC_LINKED;
+        link_block(h);
+    }
+    count_alloc(tag, size);
+    return (char*)h + HEADER_SIZE;
+}
+
+static mem_header_t* header_of(void *ptr)
+{
+    mem_header_t *h = (mem_header_t*)((char*)ptr - HEADER_SIZE);
+    if (h->magic != MEM_MAGIC && h->magic != MEM_MAGIC_LINKED) {
+        fprintf(stderr, "[MEM] %p was not allocated by mem_track (or is freed twice)\n", ptr);
+        abort();
+    }
+    return h;
+}
+
+void* mem_track_alloc(mem_tag tag, size_t size)
+{
+    return alloc_at(tag, size);
+}
+
+void mem_track_free(void *ptr)
+{
+    if (!ptr) return;
+    mem_header_t *h = header_of(ptr);
+    if (h->magic == MEM_MAGIC_LINKED) {
+        mutex_lock(&mt.lock);
+        unlink_block(h);
+        mutex_unlock(&mt.lock);
+    }
+    count_free((mem_tag)h->tag, h->size);
+    h->magic = 0;
+    free(h);
+}
+
+void* mem_track_realloc(mem_tag tag, void *ptr, size_t size)
+{
+    if (!ptr) return alloc_at(tag, size);
+    if (!size) {
+        mem_track_free(ptr);
+        return NULL;
+    }
+    mem_header_t *h = header_of(ptr);
+    size_t old = h->size;
+    bool linked = h->magic == MEM_MAGIC_LINKED;
+    if (linked) {                       // neighbours point at the header, which may move
+        mutex_lock(&mt.lock);
+        unlink_block(h);
+        mutex_unlock(&mt.lock);
+    }
+    mem_header_t *n = (mem_header_t*)realloc(h, HEADER_SIZE + size);
+    if (!n) {
+        if (linked) link_block(h);      // the old block is still valid
+        return NULL;
+    }
+    n->size = size;
+    if (linked) link_block(n);
+
+    mem_tag t = (mem_tag)n->tag;        // stays charged to its first tag
+    count_free(t, old);
+    count_alloc(t, size);
+    return (char*)n + HEADER_SIZE;
+}
+
+void* mem_track_alloc_cb(size_t size, void *user_data)
+{
+    return alloc_at((mem_tag)(uintptr_t)user_data, size);
+}
+
+void mem_track_free_cb(void *ptr, void *user_data)
+{
+    (void)user_data;
+    mem_track_free(ptr);
+}
+
+/* ------------------------------------------------------------------ */
+/*  Setup, rates, stats                                               */
+/* ------------------------------------------------------------------ */
+void mem_track_setup(bool capture_sites)
+{
+    mutex_init(&mt.lock);
+    atomic_store(&mt.capture, capture_sites);
+}
+
+void mem_track_new_frame(double frame_seconds)
+{
+    mt.window += frame_seconds;
+    if (mt.window < MEM_RATE_SECONDS) return;
+    for (int i = 0; i < MEM_TAG_NUM; i++) {
+        uint64_t a = atomic_load_explicit(&mt.tags[i].allocs, memory_order_relaxed);
+        uint64_t f = atomic_load_explicit(&mt.tags[i].frees, memory_order_relaxed);
+        mt.allocs_per_second[i] = (float)((double)(a - mt.window_allocs[i]) / mt.window);
+        mt.frees_per_second[i] = (float)((double)(f - mt.window_frees[i]) / mt.window);
+        mt.window_allocs[i] = a;
+        mt.window_frees[i] = f;
+    }
+    mt.window = 0.0;
+}
+
+mem_tag_stats mem_track_stats(mem_tag tag)
+{
+    mem_tag_stats s = { 0 };
+    if ((unsigned)tag >= MEM_TAG_NUM) return s;
+    const mem_counters_t *c = &mt.tags[tag];
+    s.name = tag_names[tag];
+    s.current_bytes = atomic_load_explicit(&c->current, memory_order_relaxed);
+    s.peak_bytes = atomic_load_explicit(&c->peak, memory_order_relaxed);
+    s.total_allocs = atomic_load_explicit(&c->allocs, memory_order_relaxed);
+    s.total_frees = atomic_load_explicit(&c->frees, memory_order_relaxed);
+    s.allocs_per_second = mt.allocs_per_second[tag];
+    s.frees_per_second = mt.frees_per_second[tag];
+    return s;
+}
+
+uint64_t mem_track_report_leaks(void)
+{
+    uint64_t leaked = 0;
+    for (int i = 0; i < MEM_TAG_NUM; i++) {
+        mem_tag_stats s = mem_track_stats((mem_tag)i);
+        uint64_t blocks = s.total_allocs - s.total_frees;
+        if (!blocks) continue;
+        leaked += blocks;
+        fprintf(stderr, "[MEM] %s: %llu block(s), %zu bytes still allocated\n", s.name,
+                (unsigned long long)blocks, s.current_bytes);
+        if (!atomic_load(&mt.capture)) continue;
+
+        int listed = 0;
+        mutex_lock(&mt.lock);
+        for (const mem_header_t *h = mt.live; h; h = h->next) {    // newest first
+            if (h->tag != (uint32_t)i) continue;
+            if (listed++ == MEM_REPORT_BLOCKS) {
+                fprintf(stderr, "[MEM]   ...\n");
+                break;
+            }
+            fprintf(stderr, "[MEM]   #%llu  %zu bytes  from", (unsigned long long)h->seq, h->size);
+            for (int f = 0; f < MEM_SITE_FRAMES && h->site[f]; f++) {
+                fprintf(stderr, "%s %p", f ? " <-" : "", h->site[f]);
+            }
+            fputc('\n', stderr);
+        }
+        mutex_unlock(&mt.lock);
+    }
+    if (!leaked) printf("[MEM] no leaks\n");
+    return leaked;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Window                                                            */
+/* ------------------------------------------------------------------ */
+static void text_bytes(size_t bytes)
+{
+    if (bytes >= (size_t)1 << 20) igText("%.2f MB", (double)bytes / (1 << 20));
+    else if (bytes >= 1024)       igText("%.1f KB", (double)bytes / 1024);
+    else                          igText("%zu B", bytes);
+}
+
+void mem_track_window(bool *open)
+{
+    if (!*open) return;
+    igSetNextWindowSize((ImVec2){ 560, 220 }, ImGuiCond_FirstUseEver);
+    if (!igBegin("Memory", open, ImGuiWindowFlags_None)) {
+        igEnd();
+        return;
+    }
+    if (igBeginTable("mem_tags", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders)) {
+        igTableSetupColumn("Subsystem", ImGuiTableColumnFlags_WidthStretch);
+        igTableSetupColumn("Live", ImGuiTableColumnFlags_WidthFixed);
+        igTableSetupColumn("Peak", ImGuiTableColumnFlags_WidthFixed);
+        igTableSetupColumn("Blocks", ImGuiTableColumnFlags_WidthFixed);
+        igTableSetupColumn("Allocs/s", ImGuiTableColumnFlags_WidthFixed);
+        igTableSetupColumn("Frees/s", ImGuiTableColumnFlags_WidthFixed);
+        igTableHeadersRow();
+
+        size_t live = 0;
+        for (int i = 0; i < MEM_TAG_NUM; i++) {
+            mem_tag_stats s = mem_track_stats((mem_tag)i);
+            live += s.current_bytes;
+            igTableNextRow();
+            igTableNextColumn(); igTextUnformatted(s.name);
+            igTableNextColumn(); text_bytes(s.current_bytes);
+            igTableNextColumn(); text_bytes(s.peak_bytes);
+            igTableNextColumn(); igText("%llu", (unsigned long long)(s.total_allocs - s.total_frees));
+            igTableNextColumn(); igText("%.0f", s.allocs_per_second);
+            igTableNextColumn(); igText("%.0f", s.frees_per_second);
+        }
+        igTableNextRow();
+        igTableNextColumn(); igTextUnformatted("total");
+        igTableNextColumn(); text_bytes(live);
+        igEndTable();
+    }
+    igEnd();
+}
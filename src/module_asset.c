@@ -0,0 +1,233 @@
+/*======================================================================
+  module_asset.c  –  coroutine asset loading on top of sokol_fetch
+======================================================================*/
+
+#include "module_asset.h"
+#include "module_gfx.h"
+#include "frame_prof.h"
+#include "mem_track.h"
+#include "sokol_fetch.h"
+#include "custom_log.h"
+#include "stb_image.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ASSET_MAX_REQUESTS  1024
+#define ASSET_NUM_LANES     16
+#define ASSET_CHUNK_SIZE    (64 * 1024)
+
+enum { KIND_BYTES, KIND_TEXTURE };
+
+/* one in-flight asset.load – the slot index travels as sfetch user_data */
+typedef struct request_t {
+    lua_State *co;              // coroutine waiting in lua_yield
+    int        co_ref;          // registry ref keeping it alive
+    int        kind;
+    uint8_t   *data;            // file bytes assembled from the chunks
+    size_t     size;
+    size_t     cap;
+    int        next_free;
+} request_t;
+
+static lua_State *L_main;
+static request_t  requests[ASSET_MAX_REQUESTS];
+static int        free_request = -1;
+static int        num_pending;
+static uint8_t    chunks[ASSET_NUM_LANES][ASSET_CHUNK_SIZE];
+
+/* ------------------------------------------------------------------ */
+/*  Resume the waiting coroutine with the decoded result              */
+/* ------------------------------------------------------------------ */
+static void finish(int slot, const sfetch_response_t *res)
+{
+    request_t *r = &requests[slot];
+    lua_State *co = r->co;
+    int nargs;
+
+    if (res->failed) {
+        lua_pushnil(co);
+        lua_pushfstring(co, "asset: cannot load '%s' (sfetch error %d)", res->path, (int)res->error_code);
+        nargs = 2;
+    } else if (r->kind == KIND_TEXTURE) {
+        int w, h, channels;
+        stbi_uc *pixels = stbi_load_from_memory(r->data, (int)r->size, &w, &h, &channels, 4);
+        int handle = pixels ? gfx_add_texture(w, h, pixels) : 0;
+        stbi_image_free(pixels);
+        if (handle) {
+            lua_pushinteger(co, handle);
+            lua_pushinteger(co, w);
+            lua_pushinteger(co, h);
+            nargs = 3;
+        } else {
+            lua_pushnil(co);
+            lua_pushfstring(co, "asset: cannot decode '%s'", res->path);
+            nargs = 2;
+        }
+    } else {
+        lua_pushlstring(co, (const char*)r->data, r->size);
+        nargs = 1;
+    }
+
+    free(r->data);
+    int co_ref = r->co_ref;
+    *r = (request_t){ .co_ref = LUA_NOREF, .next_free = free_request };
+    free_request = slot;
+    num_pending--;
+
+    int nres;
+    int status = lua_resume(co, L_main, nargs, &nres);
+    if (status == LUA_OK || status == LUA_YIELD) {
+        lua_pop(co, nres);      // LUA_YIELD: a nested asset.load already holds its own ref
+    } else {
+        luaL_traceback(L_main, co, lua_tostring(co, -1), 0);
+        LOG_ERROR("lua", "asset coroutine error: %s", lua_tostring(L_main, -1));
+        lua_pop(L_main, 1);
+    }
+    luaL_unref(L_main, LUA_REGISTRYINDEX, co_ref);
+}
+
+static void fetch_callback(const sfetch_response_t *res)
+{
+    int slot = *(const int*)res->user_data;
+    request_t *r = &requests[slot];
+
+    if (res->dispatched) {
+        sfetch_bind_buffer(res->handle, SFETCH_RANGE(chunks[res->lane]));
+    }
+    if (res->fetched) {
+        size_t need = r->size + res->data.size;
+        if (need > r->cap) {
+            size_t cap = r->cap ? r->cap : ASSET_CHUNK_SIZE;
+            while (cap < need) cap *= 2;
+            uint8_t *p = (uint8_t*)realloc(r->data, cap);
+            if (!p) {
+                fprintf(stderr, "[ASSET] out of memory loading %s\n", res->path);
+                sfetch_cancel(res->handle);
+                return;
+            }
+            r->data = p;
+            r->cap = cap;
+        }
+        memcpy(r->data + r->size, res->data.ptr, res->data.size);
+        r->size = need;
+    }
+    if (res->finished) {
+        finish(slot, res);
+    }
+}
+
+/* ------------------------------------------------------------------ */
+/*  asset.load(path) / asset.texture(path) – yield until decoded      */
+/* ------------------------------------------------------------------ */
+static int start_load(lua_State *L, int kind)
+{
+    const char *path = luaL_checkstring(L, 1);
+    if (!lua_isyieldable(L)) {
+        return luaL_error(L, "asset: '%s' must be loaded from a coroutine (see asset.spawn)", path);
+    }
+    if (free_request < 0) {
+        lua_pushnil(L);
+        lua_pushstring(L, "asset: too many pending requests");
+        return 2;
+    }
+    int slot = free_request;
+    sfetch_handle_t h = sfetch_send(&(sfetch_request_t){
+        .path = path,
+        .callback = fetch_callback,
+        .chunk_size = ASSET_CHUNK_SIZE,
+        .user_data = SFETCH_RANGE(slot),
+    });
+    if (!sfetch_handle_valid(h)) {
+        lua_pushnil(L);
+        lua_pushstring(L, "asset: sfetch queue full");
+        return 2;
+    }
+
+    request_t *r = &requests[slot];
+    free_request = r->next_free;
+    num_pending++;
+    r->co = L;
+    r->kind = kind;
+    lua_pushthread(L);
+    r->co_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    return lua_yield(L, 0);     // resumed by finish() with the result
+}
+
+/* bytes as a string, or nil, err */
+static int asset_load(lua_State *L)
+{
+    return start_load(L, KIND_BYTES);
+}
+
+/* gfx texture handle, width, height, or nil, err */
+static int asset_texture(lua_State *L)
+{
+    return start_load(L, KIND_TEXTURE);
+}
+
+/* asset.spawn(fn, ...) – run fn as a coroutine driven by the loader */
+static int asset_spawn(lua_State *L)
+{
+    luaL_checktype(L, 1, LUA_TFUNCTION);
+    int nargs = lua_gettop(L) - 1;
+    lua_State *co = lua_newthread(L);
+    lua_rotate(L, 1, 1);        // thread below fn and args
+    lua_xmove(L, co, nargs + 1);
+
+    int nres;
+    int status = lua_resume(co, L, nargs, &nres);
+    if (status != LUA_OK && status != LUA_YIELD) {
+        lua_xmove(co, L, 1);
+        return lua_error(L);
+    }
+    lua_pop(co, nres);
+    return 1;                   // the coroutine
+}
+
+static int asset_pending(lua_State *L)
+{
+    lua_pushinteger(L, num_pending);
+    return 1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Initialise the bridge                                             */
+/* ------------------------------------------------------------------ */
+void asset_module_init(lua_State *L)
+{
+    L_main = L;
+    for (int i = ASSET_MAX_REQUESTS - 1; i >= 0; i--) {
+        requests[i] = (request_t){ .co_ref = LUA_NOREF, .next_free = free_request };
+        free_request = i;
+    }
+    sfetch_setup(&(sfetch_desc_t){
+        .max_requests = ASSET_MAX_REQUESTS,
+        .num_channels = 1,
+        .num_lanes = ASSET_NUM_LANES,
+        .allocator = { mem_track_alloc_cb, mem_track_free_cb, MEM_TRACK_USER(MEM_TAG_FETCH) },
+        .logger.func = custom_log_slog,
+    });
+
+    lua_newtable(L);
+    lua_pushcfunction(L, asset_load);    lua_setfield(L, -2, "load");
+    lua_pushcfunction(L, asset_texture); lua_setfield(L, -2, "texture");
+    lua_pushcfunction(L, asset_spawn);   lua_setfield(L, -2, "spawn");
+    lua_pushcfunction(L, asset_pending); lua_setfield(L, -2, "pending");
+    lua_setglobal(L, "asset");
+}
+
+void asset_module_update(void)
+{
+    PROF_ZONE("sfetch_dowork") { sfetch_dowork(); }
+}
+
+void asset_module_shutdown(void)
+{
+    sfetch_shutdown();
+    for (int i = 0; i < ASSET_MAX_REQUESTS; i++) {
+        free(requests[i].data);
+        requests[i].data = NULL;
+    }
+    num_pending = 0;
+}
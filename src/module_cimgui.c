@@ -3,12 +3,21 @@
 ======================================================================*/
 
 #include "module_cimgui.h"
+#include "module_math.h"
+#include "custom_log.h"
 #include "cimgui.h"
+#include "sokol_time.h"
+#include <float.h>
 #include <stdio.h>
 #include <string.h>
 
+#define CIMGUI_CMD_CAPACITY     (64 * 1024)   // preallocated cmd slots
+#define CIMGUI_RESULT_CAPACITY  1024          // preallocated result slots
 
 static lua_State *L = NULL;               // same global state as module_lua.c
+static int cmd_ref = LUA_NOREF;           // registry ref of imgui.cmd
+static int results_ref = LUA_NOREF;       // registry ref of imgui.results
+static uint64_t bridge_ticks = 0;         // _render() + replay, last frame
 
 /* ------------------------------------------------------------------ */
 /*  Helper: push a C function onto the Lua stack and register it      */
@@ -21,70 +30,124 @@ static void register_cfunc(const char *name, lua_CFunction fn)
 
 
 /* --------------------------------------------------------------- */
-/*  SetNextWindowSize( {w,h}, cond )                               */
+/*  Vector argument: vmath.vec2 userdata (fast path, no table      */
+/*  probes) or a table {x,y} / {w,h} / {1,2}                        */
 /* --------------------------------------------------------------- */
-static int cimgui_SetNextWindowSize(lua_State *L)
+static ImVec2 check_imvec2(lua_State *L, int idx)
 {
-    luaL_checktype(L, 1, LUA_TTABLE);
+    vec2_t *v = math_test_vec2(L, idx);
+    if (v) return (ImVec2){ v->x, v->y };
 
-    // Try named fields: x or w
-    lua_getfield(L, 1, "x"); float w = (float)lua_tonumber(L, -1); lua_pop(L, 1);
-    if (w == 0) {
-        lua_getfield(L, 1, "w"); w = (float)lua_tonumber(L, -1); lua_pop(L, 1);
-    }
-    if (w == 0) { lua_rawgeti(L, 1, 1); w = (float)luaL_checknumber(L, -1); lua_pop(L, 1); }
+    luaL_checktype(L, idx, LUA_TTABLE);
 
-    // Height: y or h or index 2
-    lua_getfield(L, 1, "y"); float h = (float)lua_tonumber(L, -1); lua_pop(L, 1);
-    if (h == 0) {
-        lua_getfield(L, 1, "h"); h = (float)lua_tonumber(L, -1); lua_pop(L, 1);
-    }
-    if (h == 0) { lua_rawgeti(L, 1, 2); h = (float)luaL_checknumber(L, -1); lua_pop(L, 1); }
-
-    // Condition
-    ImGuiCond cond = ImGuiCond_Always;
-    if (lua_gettop(L) >= 2 && lua_isstring(L, 2)) {
-        const char *s = lua_tostring(L, 2);
-        if (strcmp(s, "Once") == 0)           cond = ImGuiCond_Once;
-        else if (strcmp(s, "FirstUseEver") == 0) cond = ImGuiCond_FirstUseEver;
-        else if (strcmp(s, "Appearing") == 0)    cond = ImGuiCond_Appearing;
+    // X: "x", "w" or index 1 – Y: "y", "h" or index 2; the first present one wins
+    float c[2];
+    static const char *const keys[2][2] = { { "x", "w" }, { "y", "h" } };
+    for (int i = 0; i < 2; i++) {
+        if (lua_getfield(L, idx, keys[i][0]) == LUA_TNIL) {
+            lua_pop(L, 1);
+            if (lua_getfield(L, idx, keys[i][1]) == LUA_TNIL) {
+                lua_pop(L, 1);
+                lua_rawgeti(L, idx, i + 1);
+            }
+        }
+        c[i] = (float)luaL_checknumber(L, -1);
+        lua_pop(L, 1);
     }
 
-    igSetNextWindowSize((ImVec2){w, h}, cond);
-    return 0;
+    return (ImVec2){ c[0], c[1] };
+}
+
+static ImVec4 check_imvec4(lua_State *L, int idx)
+{
+    vec4_t *v = math_test_vec4(L, idx);
+    if (v) return (ImVec4){ v->x, v->y, v->z, v->w };
+
+    luaL_checktype(L, idx, LUA_TTABLE);
+    float c[4];
+    static const char *const keys[4] = { "x", "y", "z", "w" };
+    for (int i = 0; i < 4; i++) {
+        if (lua_getfield(L, idx, keys[i]) == LUA_TNIL) {
+            lua_pop(L, 1);
+            lua_rawgeti(L, idx, i + 1);
+        }
+        c[i] = (float)lua_tonumber(L, -1);
+        lua_pop(L, 1);
+    }
+    return (ImVec4){ c[0], c[1], c[2], c[3] };
 }
 
 /* --------------------------------------------------------------- */
-/*  SetNextWindowPos( {x,y}, cond )                                */
+/*  In/out arrays for the generated bindings (ColorEdit4, Drag3…): */
+/*  a vmath vector of the same size or a table, updated in place   */
 /* --------------------------------------------------------------- */
-static int cimgui_SetNextWindowPos(lua_State *L)
+static float* test_vecn(lua_State *L, int idx, int n)
 {
-    luaL_checktype(L, 1, LUA_TTABLE);
+    switch (n) {
+    case 2: return (float*)math_test_vec2(L, idx);
+    case 3: return (float*)math_test_vec3(L, idx);
+    case 4: return (float*)math_test_vec4(L, idx);
+    default: return NULL;
+    }
+}
 
-    // X: try "x" or index 1
-    lua_getfield(L, 1, "x"); float x = (float)lua_tonumber(L, -1); lua_pop(L, 1);
-    if (x == 0) { lua_rawgeti(L, 1, 1); x = (float)luaL_checknumber(L, -1); lua_pop(L, 1); }
+static void gen_read_floats(lua_State *L, int idx, float *v, int n)
+{
+    float *src = test_vecn(L, idx, n);
+    if (src) { memcpy(v, src, (size_t)n * sizeof(float)); return; }
+    luaL_checktype(L, idx, LUA_TTABLE);
+    for (int i = 0; i < n; i++) {
+        lua_rawgeti(L, idx, i + 1);
+        v[i] = (float)lua_tonumber(L, -1);
+        lua_pop(L, 1);
+    }
+}
 
-    // Y: try "y" or index 2
-    lua_getfield(L, 1, "y"); float y = (float)lua_tonumber(L, -1); lua_pop(L, 1);
-    if (y == 0) { lua_rawgeti(L, 1, 2); y = (float)luaL_checknumber(L, -1); lua_pop(L, 1); }
+static void gen_write_floats(lua_State *L, int idx, const float *v, int n)
+{
+    float *dst = test_vecn(L, idx, n);
+    if (dst) { memcpy(dst, v, (size_t)n * sizeof(float)); return; }
+    for (int i = 0; i < n; i++) {
+        lua_pushnumber(L, v[i]);
+        lua_rawseti(L, idx, i + 1);
+    }
+}
+
+static void gen_read_ints(lua_State *L, int idx, int *v, int n)
+{
+    luaL_checktype(L, idx, LUA_TTABLE);
+    for (int i = 0; i < n; i++) {
+        lua_rawgeti(L, idx, i + 1);
+        v[i] = (int)lua_tointeger(L, -1);
+        lua_pop(L, 1);
+    }
+}
 
-    // Condition
-    ImGuiCond cond = ImGuiCond_Always;
-    if (lua_gettop(L) >= 2 && lua_isstring(L, 2)) {
-        const char *s = lua_tostring(L, 2);
-        if (strcmp(s, "Once") == 0)           cond = ImGuiCond_Once;
-        else if (strcmp(s, "FirstUseEver") == 0) cond = ImGuiCond_FirstUseEver;
-        else if (strcmp(s, "Appearing") == 0)    cond = ImGuiCond_Appearing;
+static void gen_write_ints(lua_State *L, int idx, const int *v, int n)
+{
+    for (int i = 0; i < n; i++) {
+        lua_pushinteger(L, v[i]);
+        lua_rawseti(L, idx, i + 1);
     }
+}
 
-    igSetNextWindowPos((ImVec2){x, y}, cond);  // Only 2 args!
-    return 0;
+/* InputText*: the script passes the current text, gets the edited one back */
+#define CIMGUI_LUA_TEXT_CAPACITY 4096
+
+static char* gen_text_buffer(const char *text, size_t len)
+{
+    static char buf[CIMGUI_LUA_TEXT_CAPACITY];
+    if (len >= sizeof(buf)) len = sizeof(buf) - 1;
+    memcpy(buf, text, len);
+    buf[len] = '\0';
+    return buf;
 }
 
+#include "cimgui_lua.gen.h"
 
 /* ------------------------------------------------------------------ */
-/*  Minimal wrappers for the Dear-ImGui functions you’ll need in Lua  */
+/*  BeginWindow/EndWindow – Begin/End without the p_open result, kept  */
+/*  for existing scripts (the generated imgui.Begin returns two values)*/
 /* ------------------------------------------------------------------ */
 static int cimgui_Begin(lua_State *L)
 {
@@ -101,19 +164,149 @@ static int cimgui_End(lua_State *L)
     return 0;
 }
 
-static int cimgui_Button(lua_State *L)
+/* ------------------------------------------------------------------ */
+/*  Batched mode – instead of one lua_CFunction call per widget, the   */
+/*  script appends opcodes + arguments to the preallocated imgui.cmd   */
+/*  table and sets cmd.n. C replays the whole buffer in one pass after */
+/*  _render() returns. Results (clicks, open state, checkbox values)   */
+/*  land in imgui.results[slot] and are read by the script next frame. */
+/*                                                                     */
+/*    local c, n = imgui.cmd, 0                                        */
+/*    n=n+1 c[n]=imgui.OP_TEXT   n=n+1 c[n]="Hello"                    */
+/*    n=n+1 c[n]=imgui.OP_BUTTON n=n+1 c[n]="Click" n=n+1 c[n]=1       */
+/*    c.n = n                                                          */
+/*    if imgui.results[1] then ... end                                 */
+/* ------------------------------------------------------------------ */
+enum {
+    OP_BEGIN = 1,               // title, slot          -> results[slot] = open
+    OP_END,                     //
+    OP_TEXT,                    // text
+    OP_BUTTON,                  // label, slot          -> results[slot] = clicked
+    OP_CHECKBOX,                // label, slot          <-> results[slot] = value
+    OP_SAMELINE,                //
+    OP_SEPARATOR,               //
+    OP_SET_NEXT_WINDOW_POS,     // x, y, cond
+    OP_SET_NEXT_WINDOW_SIZE,    // w, h, cond
+};
+
+static const char *cmd_string(int t, lua_Integer i)
 {
-    const char *label = luaL_checkstring(L, 1);
-    bool clicked = igButton(label);
-    lua_pushboolean(L, clicked);
-    return 1;
+    lua_rawgeti(L, t, i);
+    const char *s = lua_tostring(L, -1);   // string stays alive in imgui.cmd
+    lua_pop(L, 1);
+    return s ? s : "";
 }
 
-static int cimgui_Text(lua_State *L)
+static float cmd_number(int t, lua_Integer i)
 {
-    const char *text = luaL_checkstring(L, 1);
-    igText("%s", text);  // igText supports printf-style
-    return 0;
+    lua_rawgeti(L, t, i);
+    float v = (float)lua_tonumber(L, -1);
+    lua_pop(L, 1);
+    return v;
+}
+
+static lua_Integer cmd_integer(int t, lua_Integer i)
+{
+    lua_rawgeti(L, t, i);
+    lua_Integer v = lua_tointeger(L, -1);
+    lua_pop(L, 1);
+    return v;
+}
+
+static void set_result(int r, lua_Integer slot, bool value)
+{
+    lua_pushboolean(L, value);
+    lua_rawseti(L, r, slot);
+}
+
+static void cimgui_replay_commands(void)
+{
+    lua_rawgeti(L, LUA_REGISTRYINDEX, cmd_ref);
+    lua_rawgeti(L, LUA_REGISTRYINDEX, results_ref);
+    int t = lua_absindex(L, -2);
+    int r = lua_absindex(L, -1);
+
+    lua_getfield(L, t, "n");
+    lua_Integer n = lua_tointeger(L, -1);
+    lua_pop(L, 1);
+    if (n > 0) {
+        lua_pushinteger(L, 0);            // consumed – don't replay twice
+        lua_setfield(L, t, "n");
+    }
+
+    int skip = 0;                         // >0 while inside a collapsed window
+    lua_Integer i = 1;
+    while (i <= n) {
+        lua_Integer op = cmd_integer(t, i++);
+        switch (op) {
+        case OP_BEGIN: {
+            const char *title = cmd_string(t, i);
+            lua_Integer slot = cmd_integer(t, i + 1);
+            i += 2;
+            if (skip) {                     // nested in a collapsed window: not open either
+                set_result(r, slot, false);
+                skip++;
+                break;
+            }
+            bool open = igBegin(title, NULL, ImGuiWindowFlags_None);
+            set_result(r, slot, open);
+            if (!open) skip = 1;
+            break;
+        }
+        case OP_END:
+            if (skip && --skip) break;
+            igEnd();
+            break;
+        case OP_TEXT:
+            if (!skip) igTextUnformatted(cmd_string(t, i));
+            i += 1;
+            break;
+        case OP_BUTTON:
+            // a skipped button is not clicked – don't leave last frame's click in the slot
+            set_result(r, cmd_integer(t, i + 1), !skip && igButton(cmd_string(t, i)));
+            i += 2;
+            break;
+        case OP_CHECKBOX:               // skipped: the slot keeps its value
+            if (!skip) {
+                lua_Integer slot = cmd_integer(t, i + 1);
+                lua_rawgeti(L, r, slot);
+                bool v = lua_toboolean(L, -1);
+                lua_pop(L, 1);
+                if (igCheckbox(cmd_string(t, i), &v)) set_result(r, slot, v);
+            }
+            i += 2;
+            break;
+        case OP_SAMELINE:
+            if (!skip) igSameLine();
+            break;
+        case OP_SEPARATOR:
+            if (!skip) igSeparator();
+            break;
+        case OP_SET_NEXT_WINDOW_POS:
+            if (!skip) igSetNextWindowPos((ImVec2){cmd_number(t, i), cmd_number(t, i + 1)},
+                                          (ImGuiCond)cmd_integer(t, i + 2));
+            i += 3;
+            break;
+        case OP_SET_NEXT_WINDOW_SIZE:
+            if (!skip) igSetNextWindowSize((ImVec2){cmd_number(t, i), cmd_number(t, i + 1)},
+                                           (ImGuiCond)cmd_integer(t, i + 2));
+            i += 3;
+            break;
+        default:
+            fprintf(stderr, "imgui.cmd: bad opcode %lld at %lld\n",
+                    (long long)op, (long long)(i - 1));
+            i = n + 1;
+            break;
+        }
+    }
+    lua_pop(L, 2);
+}
+
+/* imgui.bridge_time() → ms spent in _render() + replay last frame */
+static int cimgui_bridge_time(lua_State *L)
+{
+    lua_pushnumber(L, stm_ms(bridge_ticks));
+    return 1;
 }
 
 /* ------------------------------------------------------------------ */
@@ -126,31 +319,51 @@ void cimgui_module_init(lua_State *L_in)
     /* create a global table `imgui` and fill it with wrappers */
     lua_newtable(L);
 
+    /* generated: every bindable ig* function + ImGui enums as integers */
+    cimgui_gen_register(L);
+
     /* window */
     lua_pushcfunction(L, cimgui_Begin);  lua_setfield(L, -2, "BeginWindow");
     lua_pushcfunction(L, cimgui_End);    lua_setfield(L, -2, "EndWindow");// end keyword is use by lua
     
 
-    /* widgets */
-    lua_pushcfunction(L, cimgui_Button); lua_setfield(L, -2, "Button"); 
-    lua_pushcfunction(L, cimgui_Text); lua_setfield(L, -2, "Text");
-    lua_pushcfunction(L, cimgui_SetNextWindowSize); lua_setfield(L, -2, "SetNextWindowSize");
-    lua_pushcfunction(L, cimgui_SetNextWindowPos);  lua_setfield(L, -2, "SetNextWindowPos");
+    /* batched mode */
+    lua_createtable(L, CIMGUI_CMD_CAPACITY, 1);
+    lua_pushinteger(L, 0); lua_setfield(L, -2, "n");
+    lua_pushvalue(L, -1); cmd_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    lua_setfield(L, -2, "cmd");
+    lua_createtable(L, CIMGUI_RESULT_CAPACITY, 0);
+    lua_pushvalue(L, -1); results_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    lua_setfield(L, -2, "results");
+
+    lua_pushinteger(L, OP_BEGIN);                lua_setfield(L, -2, "OP_BEGIN");
+    lua_pushinteger(L, OP_END);                  lua_setfield(L, -2, "OP_END");
+    lua_pushinteger(L, OP_TEXT);                 lua_setfield(L, -2, "OP_TEXT");
+    lua_pushinteger(L, OP_BUTTON);               lua_setfield(L, -2, "OP_BUTTON");
+    lua_pushinteger(L, OP_CHECKBOX);             lua_setfield(L, -2, "OP_CHECKBOX");
+    lua_pushinteger(L, OP_SAMELINE);             lua_setfield(L, -2, "OP_SAMELINE");
+    lua_pushinteger(L, OP_SEPARATOR);            lua_setfield(L, -2, "OP_SEPARATOR");
+    lua_pushinteger(L, OP_SET_NEXT_WINDOW_POS);  lua_setfield(L, -2, "OP_SET_NEXT_WINDOW_POS");
+    lua_pushinteger(L, OP_SET_NEXT_WINDOW_SIZE); lua_setfield(L, -2, "OP_SET_NEXT_WINDOW_SIZE");
+
+    lua_pushcfunction(L, cimgui_bridge_time);    lua_setfield(L, -2, "bridge_time");
 
     lua_setglobal(L, "imgui");
 }
 
 /* ------------------------------------------------------------------ */
-/*  Frame – call Lua _render() if it exists                           */
+/*  Frame – call Lua _render(alpha) if it exists                      */
 /* ------------------------------------------------------------------ */
-void cimgui_module_frame(void)
+void cimgui_module_frame(double alpha)
 {
     if (!L) return;
 
+    uint64_t start = stm_now();
     lua_getglobal(L, "_render");          // push _render or nil
     if (lua_isfunction(L, -1)) {
-        if (lua_pcall(L, 0, 0, 0) != LUA_OK) {
-            fprintf(stderr, "Lua _render error: %s\n", lua_tostring(L, -1));
+        lua_pushnumber(L, alpha);
+        if (lua_pcall(L, 1, 0, 0) != LUA_OK) {
+            LOG_ERROR("lua", "_render error: %s", lua_tostring(L, -1));
             lua_pop(L, 1);
         }
     } else {
@@ -162,5 +375,8 @@ void cimgui_module_frame(void)
         igText("Add a function _render() in your script.lua");
         igEnd();
     }
+
+    cimgui_replay_commands();             // batched widgets, if any
+    bridge_ticks = stm_since(start);
 }
 
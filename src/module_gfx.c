@@ -0,0 +1,894 @@
+/*======================================================================
+  module_gfx.c  –  sokol_gfx bridge for Lua
+======================================================================*/
+
+#include "module_gfx.h"
+#include "module_math.h"
+#include "gfx_shaders.h"
+#include "sokol_gfx.h"
+#include "sokol_app.h"
+#include "stb_image.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GFX_BUFFER_NAME "gfx.buffer"
+
+/* element types of the typed accessors, passed as upvalue 1 */
+enum { T_F32, T_U32, T_U16, T_U8, T_COUNT };
+static const char  *const type_names[T_COUNT] = { "f32", "u32", "u16", "u8" };
+static const size_t type_sizes[T_COUNT] = { 4, 4, 2, 1 };
+
+/* ------------------------------------------------------------------ */
+/*  Helpers                                                           */
+/* ------------------------------------------------------------------ */
+gfx_buffer_t* gfx_check_buffer(lua_State *L, int idx)
+{
+    return (gfx_buffer_t*)luaL_checkudata(L, idx, GFX_BUFFER_NAME);
+}
+
+static int buf_type(lua_State *L)
+{
+    return (int)lua_tointeger(L, lua_upvalueindex(1));
+}
+
+static void store(lua_State *L, int idx, int t, uint8_t *dst)
+{
+    switch (t) {
+    case T_F32: { float v = (float)luaL_checknumber(L, idx); memcpy(dst, &v, 4); break; }
+    case T_U32: { uint32_t v = (uint32_t)luaL_checkinteger(L, idx); memcpy(dst, &v, 4); break; }
+    case T_U16: { uint16_t v = (uint16_t)luaL_checkinteger(L, idx); memcpy(dst, &v, 2); break; }
+    default:    *dst = (uint8_t)luaL_checkinteger(L, idx); break;
+    }
+}
+
+static void load(lua_State *L, int t, const uint8_t *src)
+{
+    switch (t) {
+    case T_F32: { float v; memcpy(&v, src, 4); lua_pushnumber(L, v); break; }
+    case T_U32: { uint32_t v; memcpy(&v, src, 4); lua_pushinteger(L, v); break; }
+    case T_U16: { uint16_t v; memcpy(&v, src, 2); lua_pushinteger(L, v); break; }
+    default:    lua_pushinteger(L, *src); break;
+    }
+}
+
+/* bytes to upload: explicit count, else the push cursor, else everything */
+static size_t range_size(lua_State *L, int idx, const gfx_buffer_t *b)
+{
+    size_t bytes = b->used ? b->used : b->size;
+    if (!lua_isnoneornil(L, idx)) {
+        lua_Integer n = luaL_checkinteger(L, idx);
+        luaL_argcheck(L, n >= 0 && (size_t)n <= b->size, idx, "byte count out of range");
+        bytes = (size_t)n;
+    }
+    return bytes;
+}
+
+/* ------------------------------------------------------------------ */
+/*  gfx.buffer methods                                                */
+/* ------------------------------------------------------------------ */
+
+/* b:set_f32(i, v, ...) – consecutive elements from 1-based index i */
+static int buffer_set(lua_State *L)
+{
+    gfx_buffer_t *b = gfx_check_buffer(L, 1);
+    int t = buf_type(L);
+    size_t es = type_sizes[t];
+    lua_Integer i = luaL_checkinteger(L, 2);
+    int n = lua_gettop(L) - 2;
+    size_t cap = b->size / es;      // divided, not multiplied: a huge i must not wrap
+    luaL_argcheck(L, i >= 1 && (size_t)n <= cap && (size_t)(i - 1) <= cap - (size_t)n, 2, "index out of range");
+    uint8_t *dst = b->data + ((size_t)i - 1) * es;
+    for (int k = 0; k < n; k++, dst += es) {
+        store(L, k + 3, t, dst);
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+/* b:get_f32(i) */
+static int buffer_get(lua_State *L)
+{
+    gfx_buffer_t *b = gfx_check_buffer(L, 1);
+    int t = buf_type(L);
+    size_t es = type_sizes[t];
+    lua_Integer i = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, i >= 1 && (size_t)i <= b->size / es, 2, "index out of range");
+    load(L, t, b->data + ((size_t)i - 1) * es);
+    return 1;
+}
+
+/* b:push_f32(v, ...) – append at the cursor, e.g. one vertex per call */
+static int buffer_push(lua_State *L)
+{
+    gfx_buffer_t *b = gfx_check_buffer(L, 1);
+    int t = buf_type(L);
+    size_t es = type_sizes[t];
+    int n = lua_gettop(L) - 1;
+    size_t at = (b->used + es - 1) & ~(es - 1);
+    if (at + (size_t)n * es > b->size) {
+        return luaL_error(L, "gfx.buffer full (%d of %d bytes)", (int)b->used, (int)b->size);
+    }
+    for (int k = 0; k < n; k++) {
+        store(L, k + 2, t, b->data + at + (size_t)k * es);
+    }
+    b->used = at + (size_t)n * es;
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int buffer_reset(lua_State *L)
+{
+    gfx_check_buffer(L, 1)->used = 0;
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int buffer_used(lua_State *L)
+{
+    lua_pushinteger(L, (lua_Integer)gfx_check_buffer(L, 1)->used);
+    return 1;
+}
+
+static int buffer_len(lua_State *L)
+{
+    lua_pushinteger(L, (lua_Integer)gfx_check_buffer(L, 1)->size);
+    return 1;
+}
+
+/* b:write(byte_offset, src) – src is a gfx.buffer, vmath.floats or string */
+static int buffer_write(lua_State *L)
+{
+    gfx_buffer_t *b = gfx_check_buffer(L, 1);
+    lua_Integer off = luaL_checkinteger(L, 2);
+    const void *src;
+    size_t bytes;
+    if (lua_type(L, 3) == LUA_TSTRING) {
+        src = lua_tolstring(L, 3, &bytes);
+    } else if (luaL_testudata(L, 3, GFX_BUFFER_NAME)) {
+        gfx_buffer_t *o = gfx_check_buffer(L, 3);
+        src = o->data;
+        bytes = o->used ? o->used : o->size;
+    } else {
+        size_t count;
+        src = math_check_floats(L, 3, &count);
+        bytes = count * sizeof(float);
+    }
+    luaL_argcheck(L, off >= 0 && bytes <= b->size && (size_t)off <= b->size - bytes, 2, "write out of range");
+    memmove(b->data + off, src, bytes);
+    if ((size_t)off + bytes > b->used) b->used = (size_t)off + bytes;
+    lua_settop(L, 1);
+    return 1;
+}
+
+/* b:floats([first, count]) – vmath.floats view for the bulk kernels */
+static int buffer_floats(lua_State *L)
+{
+    gfx_buffer_t *b = gfx_check_buffer(L, 1);
+    size_t total = b->size / sizeof(float);
+    lua_Integer first = luaL_optinteger(L, 2, 1);
+    lua_Integer count = luaL_optinteger(L, 3, (lua_Integer)total - first + 1);
+    luaL_argcheck(L, first >= 1 && count >= 0 && (size_t)count <= total &&
+                     (size_t)(first - 1) <= total - (size_t)count, 2, "range out of buffer");
+    math_push_floats_view(L, (float*)b->data + (first - 1), (size_t)count, 1);
+    return 1;
+}
+
+static void register_buffer(lua_State *L)
+{
+    luaL_newmetatable(L, GFX_BUFFER_NAME);
+    lua_newtable(L);
+    char name[16];
+    for (int t = 0; t < T_COUNT; t++) {
+        snprintf(name, sizeof(name), "set_%s", type_names[t]);
+        lua_pushinteger(L, t); lua_pushcclosure(L, buffer_set, 1); lua_setfield(L, -2, name);
+        snprintf(name, sizeof(name), "get_%s", type_names[t]);
+        lua_pushinteger(L, t); lua_pushcclosure(L, buffer_get, 1); lua_setfield(L, -2, name);
+        snprintf(name, sizeof(name), "push_%s", type_names[t]);
+        lua_pushinteger(L, t); lua_pushcclosure(L, buffer_push, 1); lua_setfield(L, -2, name);
+    }
+    lua_pushcfunction(L, buffer_reset);  lua_setfield(L, -2, "reset");
+    lua_pushcfunction(L, buffer_used);   lua_setfield(L, -2, "used");
+    lua_pushcfunction(L, buffer_write);  lua_setfield(L, -2, "write");
+    lua_pushcfunction(L, buffer_floats); lua_setfield(L, -2, "floats");
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, buffer_len); lua_setfield(L, -2, "__len");
+    lua_pop(L, 1);
+}
+
+/* gfx.buffer(size_bytes) */
+static int gfx_buffer(lua_State *L)
+{
+    lua_Integer size = luaL_checkinteger(L, 1);
+    luaL_argcheck(L, size > 0, 1, "size must be positive");
+    gfx_buffer_t *b = (gfx_buffer_t*)lua_newuserdatauv(L, sizeof(gfx_buffer_t) + (size_t)size + 15, 0);
+    b->size = (size_t)size;
+    b->used = 0;
+    b->data = (uint8_t*)(((uintptr_t)(b + 1) + 15) & ~(uintptr_t)15);
+    memset(b->data, 0, b->size);
+    luaL_setmetatable(L, GFX_BUFFER_NAME);
+    return 1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  sg_buffer – integer handles (sg_buffer.id)                        */
+/* ------------------------------------------------------------------ */
+
+/* gfx.make_buffer{ size=, type="vertex"|"index"|"storage",
+                    usage="dynamic"|"stream"|"immutable", data=buffer, label= } */
+static int gfx_make_buffer(lua_State *L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    sg_buffer_desc desc = { 0 };
+
+    lua_getfield(L, 1, "type");
+    const char *type = luaL_optstring(L, -1, "vertex");
+    desc.usage.vertex_buffer  = strcmp(type, "vertex") == 0;
+    desc.usage.index_buffer   = strcmp(type, "index") == 0;
+    desc.usage.storage_buffer = strcmp(type, "storage") == 0;
+    lua_pop(L, 1);
+
+    lua_getfield(L, 1, "usage");
+    const char *usage = luaL_optstring(L, -1, "immutable");
+    desc.usage.dynamic_update = strcmp(usage, "dynamic") == 0;
+    desc.usage.stream_update  = strcmp(usage, "stream") == 0;
+    desc.usage.immutable      = !desc.usage.dynamic_update && !desc.usage.stream_update;
+    lua_pop(L, 1);
+
+    lua_getfield(L, 1, "data");
+    if (!lua_isnil(L, -1)) {
+        gfx_buffer_t *b = gfx_check_buffer(L, -1);
+        desc.data = (sg_range){ b->data, b->used ? b->used : b->size };
+    }
+    lua_pop(L, 1);
+
+    lua_getfield(L, 1, "size");
+    desc.size = (size_t)luaL_optinteger(L, -1, 0);
+    lua_pop(L, 1);
+
+    lua_getfield(L, 1, "label");
+    desc.label = lua_tostring(L, -1);     // only read during sg_make_buffer
+
+    sg_buffer buf = sg_make_buffer(&desc);
+    lua_pop(L, 1);
+    lua_pushinteger(L, buf.id);
+    return 1;
+}
+
+/* gfx.update_buffer(id, buffer [, bytes]) – once per frame per buffer */
+static int gfx_update_buffer(lua_State *L)
+{
+    sg_buffer buf = { (uint32_t)luaL_checkinteger(L, 1) };
+    gfx_buffer_t *b = gfx_check_buffer(L, 2);
+    sg_update_buffer(buf, &(sg_range){ b->data, range_size(L, 3, b) });
+    return 0;
+}
+
+/* gfx.append_buffer(id, buffer [, bytes]) → byte offset for the bindings */
+static int gfx_append_buffer(lua_State *L)
+{
+    sg_buffer buf = { (uint32_t)luaL_checkinteger(L, 1) };
+    gfx_buffer_t *b = gfx_check_buffer(L, 2);
+    lua_pushinteger(L, sg_append_buffer(buf, &(sg_range){ b->data, range_size(L, 3, b) }));
+    return 1;
+}
+
+static int gfx_destroy_buffer(lua_State *L)
+{
+    sg_destroy_buffer((sg_buffer){ (uint32_t)luaL_checkinteger(L, 1) });
+    return 0;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Retained resources – 1-based integer handles into fixed tables    */
+/* ------------------------------------------------------------------ */
+#define GFX_MAX_MESHES     1024
+#define GFX_MAX_TEXTURES   256
+#define GFX_MAX_PIPELINES  64
+#define GFX_MAX_MATERIALS  1024
+
+enum { SHADER_COLOR, SHADER_TEXTURED, SHADER_COUNT };
+
+typedef struct mesh_t {
+    sg_buffer vbuf;
+    sg_buffer ibuf;             // id 0 → non-indexed
+    int       count;            // indices (or vertices) per draw
+    bool      own_vbuf;         // made from data here, not a gfx.make_buffer id
+    bool      own_ibuf;
+} mesh_t;
+
+typedef struct texture_t {
+    sg_image img;
+    sg_view  view;
+} texture_t;
+
+typedef struct pipeline_t {
+    sg_pipeline pip;
+    int         shader;
+} pipeline_t;
+
+typedef struct material_t {
+    int pipeline;
+    int texture;                // 0 → none
+} material_t;
+
+static mesh_t     meshes[GFX_MAX_MESHES + 1];
+static texture_t  textures[GFX_MAX_TEXTURES + 1];
+static pipeline_t pipelines[GFX_MAX_PIPELINES + 1];
+static material_t materials[GFX_MAX_MATERIALS + 1];
+static int num_meshes, num_textures, num_pipelines, num_materials;
+
+static sg_shader  shaders[SHADER_COUNT];
+static sg_sampler sampler;      // shared linear sampler, made on first texture
+
+/* destroys what the tables own and restarts every handle at 1; the
+   shaders and the sampler are shared and stay */
+static void release_resources(void)
+{
+    for (int i = 1; i <= num_meshes; i++) {
+        if (meshes[i].own_vbuf) sg_destroy_buffer(meshes[i].vbuf);
+        if (meshes[i].own_ibuf) sg_destroy_buffer(meshes[i].ibuf);
+    }
+    for (int i = 1; i <= num_textures; i++) {
+        sg_destroy_view(textures[i].view);
+        sg_destroy_image(textures[i].img);
+    }
+    for (int i = 1; i <= num_pipelines; i++) {
+        sg_destroy_pipeline(pipelines[i].pip);
+    }
+    num_meshes = num_textures = num_pipelines = num_materials = 0;
+}
+
+static int check_handle(lua_State *L, int idx, int count, const char *what)
+{
+    lua_Integer h = luaL_checkinteger(L, idx);
+    if (h < 1 || h > count) {
+        return luaL_error(L, "invalid %s handle %d", what, (int)h);
+    }
+    return (int)h;
+}
+
+/* vertex or index data: gfx.buffer, vmath.floats or a gfx.make_buffer id */
+static sg_buffer opt_buffer(lua_State *L, int idx, bool index, const char *label)
+{
+    if (lua_isnoneornil(L, idx)) {
+        return (sg_buffer){ 0 };
+    }
+    if (lua_isinteger(L, idx)) {
+        return (sg_buffer){ (uint32_t)lua_tointeger(L, idx) };
+    }
+    sg_range data;
+    if (luaL_testudata(L, idx, GFX_BUFFER_NAME)) {
+        gfx_buffer_t *b = gfx_check_buffer(L, idx);
+        data = (sg_range){ b->data, b->used ? b->used : b->size };
+    } else {
+        size_t count;
+        data.ptr = math_check_floats(L, idx, &count);
+        data.size = count * sizeof(float);
+    }
+    return sg_make_buffer(&(sg_buffer_desc){
+        .usage.index_buffer = index,
+        .usage.vertex_buffer = !index,
+        .data = data,
+        .label = label,
+    });
+}
+
+/* gfx.mesh{ vertices=, indices=, count= } → mesh handle */
+static int gfx_mesh(lua_State *L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    if (num_meshes == GFX_MAX_MESHES) {
+        return luaL_error(L, "too many meshes (max %d)", GFX_MAX_MESHES);
+    }
+    mesh_t m = { 0 };
+    lua_getfield(L, 1, "vertices");
+    luaL_argcheck(L, !lua_isnil(L, -1), 1, "mesh needs vertices");
+    m.own_vbuf = !lua_isinteger(L, -1);
+    m.vbuf = opt_buffer(L, -1, false, "lua-mesh-vertices");
+    lua_getfield(L, 1, "indices");
+    m.own_ibuf = !lua_isinteger(L, -1);
+    m.ibuf = opt_buffer(L, -1, true, "lua-mesh-indices");
+    lua_getfield(L, 1, "count");
+    m.count = (int)luaL_checkinteger(L, -1);
+    lua_pop(L, 3);
+
+    meshes[++num_meshes] = m;
+    lua_pushinteger(L, num_meshes);
+    return 1;
+}
+
+int gfx_add_texture(int width, int height, const void *rgba)
+{
+    if (num_textures == GFX_MAX_TEXTURES) {
+        fprintf(stderr, "[GFX] too many textures (max %d)\n", GFX_MAX_TEXTURES);
+        return 0;
+    }
+    texture_t t;
+    t.img = sg_make_image(&(sg_image_desc){
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .data.mip_levels[0] = { rgba, (size_t)width * (size_t)height * 4 },
+        .label = "lua-texture",
+    });
+    t.view = sg_make_view(&(sg_view_desc){ .texture = { .image = t.img }, .label = "lua-texture-view" });
+    if (sampler.id == SG_INVALID_ID) {
+        sampler = sg_make_sampler(&(sg_sampler_desc){
+            .min_filter = SG_FILTER_LINEAR,
+            .mag_filter = SG_FILTER_LINEAR,
+            .label = "lua-sampler",
+        });
+    }
+    textures[++num_textures] = t;
+    return num_textures;
+}
+
+/* gfx.texture{ path= } or gfx.texture{ width=, height=, data=buffer } (RGBA8) */
+static int gfx_texture(lua_State *L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    int handle;
+
+    lua_getfield(L, 1, "path");
+    const char *path = lua_tostring(L, -1);
+    if (path) {
+        int w, h, channels;
+        stbi_uc *pixels = stbi_load(path, &w, &h, &channels, 4);
+        if (!pixels) {
+            return luaL_error(L, "gfx.texture: cannot load '%s'", path);
+        }
+        handle = gfx_add_texture(w, h, pixels);
+        stbi_image_free(pixels);
+    } else {
+        lua_getfield(L, 1, "width");
+        lua_getfield(L, 1, "height");
+        lua_getfield(L, 1, "data");
+        int w = (int)luaL_checkinteger(L, -3);
+        int h = (int)luaL_checkinteger(L, -2);
+        gfx_buffer_t *b = gfx_check_buffer(L, -1);
+        luaL_argcheck(L, w > 0 && h > 0 && b->size >= (size_t)w * (size_t)h * 4,
+                      1, "data smaller than width*height*4");
+        handle = gfx_add_texture(w, h, b->data);
+        lua_pop(L, 3);
+    }
+    if (handle == 0) {
+        return luaL_error(L, "too many textures (max %d)", GFX_MAX_TEXTURES);
+    }
+    lua_pushinteger(L, handle);
+    return 1;
+}
+
+static sg_vertex_format check_format(lua_State *L, int idx)
+{
+    static const char *const names[] = {
+        "float", "float2", "float3", "float4", "ubyte4n", "short2n", "ushort2n", "short4n", NULL
+    };
+    static const sg_vertex_format formats[] = {
+        SG_VERTEXFORMAT_FLOAT, SG_VERTEXFORMAT_FLOAT2, SG_VERTEXFORMAT_FLOAT3, SG_VERTEXFORMAT_FLOAT4,
+        SG_VERTEXFORMAT_UBYTE4N, SG_VERTEXFORMAT_SHORT2N, SG_VERTEXFORMAT_USHORT2N, SG_VERTEXFORMAT_SHORT4N,
+    };
+    return formats[luaL_checkoption(L, idx, NULL, names)];
+}
+
+/* gfx.pipeline{ shader="color"|"textured", layout={"float3","float4"},
+                 index_type="none"|"u16"|"u32", cull="none"|"back"|"front",
+                 primitive="triangles"|"lines", depth=true, label= } → handle */
+static int gfx_pipeline(lua_State *L)
+{
+    static const char *const shader_names[] = { "color", "textured", NULL };
+    static const char *const index_names[]   = { "none", "u16", "u32", NULL };
+    static const char *const cull_names[]    = { "none", "back", "front", NULL };
+    static const char *const prim_names[]    = { "triangles", "lines", NULL };
+    static const sg_index_type index_types[] = { SG_INDEXTYPE_NONE, SG_INDEXTYPE_UINT16, SG_INDEXTYPE_UINT32 };
+    static const sg_cull_mode cull_modes[]   = { SG_CULLMODE_NONE, SG_CULLMODE_BACK, SG_CULLMODE_FRONT };
+    static const sg_primitive_type prims[]   = { SG_PRIMITIVETYPE_TRIANGLES, SG_PRIMITIVETYPE_LINES };
+
+    luaL_checktype(L, 1, LUA_TTABLE);
+    if (num_pipelines == GFX_MAX_PIPELINES) {
+        return luaL_error(L, "too many pipelines (max %d)", GFX_MAX_PIPELINES);
+    }
+    sg_pipeline_desc desc = { 0 };
+    pipeline_t p;
+
+    lua_getfield(L, 1, "shader");
+    p.shader = luaL_checkoption(L, -1, "color", shader_names);
+    lua_getfield(L, 1, "index_type");
+    desc.index_type = index_types[luaL_checkoption(L, -1, "u16", index_names)];
+    lua_getfield(L, 1, "cull");
+    desc.cull_mode = cull_modes[luaL_checkoption(L, -1, "back", cull_names)];
+    lua_getfield(L, 1, "primitive");
+    desc.primitive_type = prims[luaL_checkoption(L, -1, "triangles", prim_names)];
+    lua_getfield(L, 1, "depth");
+    if (lua_isnil(L, -1) || lua_toboolean(L, -1)) {
+        desc.depth.write_enabled = true;
+        desc.depth.compare = SG_COMPAREFUNC_LESS_EQUAL;
+    }
+    lua_pop(L, 5);
+
+    lua_getfield(L, 1, "layout");
+    luaL_argcheck(L, lua_istable(L, -1), 1, "pipeline needs a layout table");
+    int n = (int)lua_rawlen(L, -1);
+    luaL_argcheck(L, n >= 1 && n <= SG_MAX_VERTEX_ATTRIBUTES, 1, "bad layout size");
+    for (int i = 0; i < n; i++) {
+        lua_rawgeti(L, -1, i + 1);
+        desc.layout.attrs[i].format = check_format(L, -1);
+        lua_pop(L, 1);
+    }
+    lua_pop(L, 1);
+
+    if (shaders[p.shader].id == SG_INVALID_ID) {
+        shaders[p.shader] = sg_make_shader(p.shader == SHADER_TEXTURED
+            ? gfx_shader_textured_desc(sg_query_backend())
+            : gfx_shader_color_desc(sg_query_backend()));
+    }
+    desc.shader = shaders[p.shader];
+
+    lua_getfield(L, 1, "label");
+    desc.label = lua_tostring(L, -1);
+    p.pip = sg_make_pipeline(&desc);
+    lua_pop(L, 1);
+
+    pipelines[++num_pipelines] = p;
+    lua_pushinteger(L, num_pipelines);
+    return 1;
+}
+
+/* gfx.material{ pipeline=, texture= } → handle */
+static int gfx_material(lua_State *L)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    if (num_materials == GFX_MAX_MATERIALS) {
+        return luaL_error(L, "too many materials (max %d)", GFX_MAX_MATERIALS);
+    }
+    material_t m = { 0 };
+    lua_getfield(L, 1, "pipeline");
+    m.pipeline = check_handle(L, -1, num_pipelines, "pipeline");
+    lua_getfield(L, 1, "texture");
+    if (!lua_isnil(L, -1)) {
+        m.texture = check_handle(L, -1, num_textures, "texture");
+    }
+    lua_pop(L, 2);
+    if (pipelines[m.pipeline].shader == SHADER_TEXTURED && m.texture == 0) {
+        return luaL_error(L, "textured pipeline needs a texture");
+    }
+
+    materials[++num_materials] = m;
+    lua_pushinteger(L, num_materials);
+    return 1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Draw list                                                         */
+/*                                                                    */
+/*  Items persist across frames and only change when Lua touches      */
+/*  them. A transform is either stored in the item or read straight   */
+/*  from 16 floats of a vmath.floats array (e.g. the output of        */
+/*  vmath.model_matrices), so animating N objects is one kernel call. */
+/*  gfx.draw() adds one-frame items. Both lists are sorted by         */
+/*  pipeline → texture → mesh and merged while drawing.               */
+/* ------------------------------------------------------------------ */
+typedef struct item_t {
+    uint64_t     key;
+    int          mesh;
+    int          material;
+    mat44_t      model;
+    const float *src;           // non-NULL → transform lives in a floats array
+    int          src_ref;       // registry ref keeping that array alive
+    bool         visible;
+    bool         live;
+} item_t;
+
+static item_t  *items;          // retained, slot = handle - 1
+static int      num_items, cap_items;
+static int      free_item = -1; // head of the free slot chain (via mesh)
+static int     *order;          // live items sorted by key
+static int      num_order;
+static bool     order_dirty;
+
+static item_t  *transient;      // gfx.draw() this frame
+static int      num_transient, cap_transient;
+
+static mat44_t  view_proj;
+static struct { int draws, pipelines, bindings; } last_stats;
+
+static uint64_t make_key(int mesh, int material)
+{
+    const material_t *m = &materials[material];
+    return ((uint64_t)m->pipeline << 48) | ((uint64_t)m->texture << 32) | (uint64_t)mesh;
+}
+
+static void* grow(void *p, int *cap, size_t elem)
+{
+    int n = *cap ? *cap * 2 : 256;
+    void *q = realloc(p, (size_t)n * elem);
+    if (!q) {
+        fprintf(stderr, "[GFX] out of memory for %d draw items\n", n);
+        return NULL;
+    }
+    *cap = n;
+    return q;
+}
+
+/* mat44 userdata, or floats array + 1-based matrix index */
+static void set_transform(lua_State *L, item_t *it, int idx)
+{
+    if (it->src_ref != LUA_NOREF) {
+        luaL_unref(L, LUA_REGISTRYINDEX, it->src_ref);
+        it->src_ref = LUA_NOREF;
+        it->src = NULL;
+    }
+    if (lua_isnoneornil(L, idx)) {
+        it->model = mat44_identity();
+        return;
+    }
+    mat44_t *m = math_test_mat44(L, idx);
+    if (m) {
+        it->model = *m;
+        return;
+    }
+    size_t count;
+    float *f = math_check_floats(L, idx, &count);
+    lua_Integer i = luaL_optinteger(L, idx + 1, 1);
+    luaL_argcheck(L, i >= 1 && (size_t)i <= count / 16, idx + 1, "matrix index out of range");
+    it->src = f + (i - 1) * 16;
+    lua_pushvalue(L, idx);
+    it->src_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+static item_t* check_item(lua_State *L, int idx)
+{
+    lua_Integer h = luaL_checkinteger(L, idx);
+    if (h < 1 || h > num_items || !items[h - 1].live) {
+        luaL_error(L, "invalid draw item %d", (int)h);
+    }
+    return &items[h - 1];
+}
+
+/* gfx.add(mesh, material[, mat44 | floats, index]) → item handle */
+static int gfx_add(lua_State *L)
+{
+    int mesh = check_handle(L, 1, num_meshes, "mesh");
+    int material = check_handle(L, 2, num_materials, "material");
+    int slot = free_item;
+    if (slot >= 0) {
+        free_item = items[slot].mesh;
+    } else {
+        if (num_items == cap_items) {
+            int cap = cap_items;
+            item_t *p = grow(items, &cap, sizeof(item_t));
+            if (!p) return luaL_error(L, "gfx.add: out of memory");
+            items = p;
+            int *o = realloc(order, (size_t)cap * sizeof(int));
+            if (!o) return luaL_error(L, "gfx.add: out of memory");
+            order = o;
+            cap_items = cap;
+        }
+        slot = num_items++;
+    }
+    item_t *it = &items[slot];
+    *it = (item_t){ .key = make_key(mesh, material), .mesh = mesh, .material = material,
+                    .src_ref = LUA_NOREF, .visible = true, .live = true };
+    set_transform(L, it, 3);
+    order_dirty = true;
+    lua_pushinteger(L, slot + 1);
+    return 1;
+}
+
+/* gfx.set_transform(item, mat44 | floats, index) */
+static int gfx_set_transform(lua_State *L)
+{
+    set_transform(L, check_item(L, 1), 2);
+    return 0;
+}
+
+static int gfx_set_material(lua_State *L)
+{
+    item_t *it = check_item(L, 1);
+    it->material = check_handle(L, 2, num_materials, "material");
+    it->key = make_key(it->mesh, it->material);
+    order_dirty = true;
+    return 0;
+}
+
+static int gfx_set_visible(lua_State *L)
+{
+    check_item(L, 1)->visible = lua_toboolean(L, 2);
+    return 0;
+}
+
+static void remove_item(lua_State *L, int slot)
+{
+    item_t *it = &items[slot];
+    luaL_unref(L, LUA_REGISTRYINDEX, it->src_ref);
+    it->live = false;
+    it->mesh = free_item;
+    free_item = slot;
+    order_dirty = true;
+}
+
+static int gfx_remove(lua_State *L)
+{
+    check_item(L, 1);
+    remove_item(L, (int)lua_tointeger(L, 1) - 1);
+    return 0;
+}
+
+/* gfx.clear() – drop every item and release the meshes, textures,
+   pipelines and materials, e.g. at the top of a hot-reloaded script */
+static int gfx_clear(lua_State *L)
+{
+    for (int i = 0; i < num_items; i++) {
+        if (items[i].live) luaL_unref(L, LUA_REGISTRYINDEX, items[i].src_ref);
+    }
+    num_items = 0;
+    num_order = 0;
+    num_transient = 0;
+    free_item = -1;
+    order_dirty = false;
+    release_resources();
+    return 0;
+}
+
+/* gfx.draw(mesh, material[, mat44 | floats, index]) – this frame only */
+static int gfx_draw(lua_State *L)
+{
+    int mesh = check_handle(L, 1, num_meshes, "mesh");
+    int material = check_handle(L, 2, num_materials, "material");
+    if (num_transient == cap_transient) {
+        item_t *p = grow(transient, &cap_transient, sizeof(item_t));
+        if (!p) return luaL_error(L, "gfx.draw: out of memory");
+        transient = p;
+    }
+    item_t *it = &transient[num_transient++];
+    *it = (item_t){ .key = make_key(mesh, material), .mesh = mesh, .material = material,
+                    .src_ref = LUA_NOREF, .visible = true, .live = true };
+    if (lua_isnoneornil(L, 3)) {
+        it->model = mat44_identity();
+    } else if (math_test_mat44(L, 3)) {
+        it->model = *math_test_mat44(L, 3);
+    } else {
+        // copied now – the array may be collected before the frame ends
+        size_t count;
+        float *f = math_check_floats(L, 3, &count);
+        lua_Integer i = luaL_optinteger(L, 4, 1);
+        luaL_argcheck(L, i >= 1 && (size_t)i <= count / 16, 4, "matrix index out of range");
+        memcpy(&it->model, f + (i - 1) * 16, sizeof(mat44_t));
+    }
+    return 0;
+}
+
+/* gfx.camera(view_proj) */
+static int gfx_camera(lua_State *L)
+{
+    mat44_t *m = math_test_mat44(L, 1);
+    luaL_argexpected(L, m != NULL, 1, "mat44");
+    view_proj = *m;
+    return 0;
+}
+
+static int gfx_aspect(lua_State *L)
+{
+    lua_pushnumber(L, sapp_widthf() / sapp_heightf());
+    return 1;
+}
+
+/* gfx.draw_stats() → draws, pipeline changes, binding changes (last frame) */
+static int gfx_draw_stats(lua_State *L)
+{
+    lua_pushinteger(L, last_stats.draws);
+    lua_pushinteger(L, last_stats.pipelines);
+    lua_pushinteger(L, last_stats.bindings);
+    return 3;
+}
+
+static int cmp_order(const void *a, const void *b)
+{
+    uint64_t ka = items[*(const int*)a].key, kb = items[*(const int*)b].key;
+    return (ka > kb) - (ka < kb);
+}
+
+static int cmp_item(const void *a, const void *b)
+{
+    uint64_t ka = ((const item_t*)a)->key, kb = ((const item_t*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+void gfx_module_draw(void)
+{
+    if (order_dirty) {
+        num_order = 0;
+        for (int i = 0; i < num_items; i++) {
+            if (items[i].live) order[num_order++] = i;
+        }
+        qsort(order, (size_t)num_order, sizeof(int), cmp_order);
+        order_dirty = false;
+    }
+    if (num_transient > 1) {
+        qsort(transient, (size_t)num_transient, sizeof(item_t), cmp_item);
+    }
+
+    uint64_t cur_pip = 0, cur_bind = 0;
+    int i = 0, j = 0;
+    last_stats.draws = last_stats.pipelines = last_stats.bindings = 0;
+    while (i < num_order || j < num_transient) {
+        const item_t *it;
+        if (j == num_transient || (i < num_order && items[order[i]].key <= transient[j].key)) {
+            it = &items[order[i++]];
+        } else {
+            it = &transient[j++];
+        }
+        if (!it->visible) {
+            continue;
+        }
+        const material_t *mat = &materials[it->material];
+        const mesh_t *mesh = &meshes[it->mesh];
+        if ((it->key >> 48) != cur_pip) {
+            cur_pip = it->key >> 48;
+            cur_bind = 0;
+            sg_apply_pipeline(pipelines[mat->pipeline].pip);
+            last_stats.pipelines++;
+        }
+        if (it->key != cur_bind) {
+            cur_bind = it->key;
+            sg_bindings bind = { .vertex_buffers[0] = mesh->vbuf, .index_buffer = mesh->ibuf };
+            if (mat->texture) {
+                bind.views[0] = textures[mat->texture].view;
+                bind.samplers[0] = sampler;
+            }
+            sg_apply_bindings(&bind);
+            last_stats.bindings++;
+        }
+        mat44_t model;
+        if (it->src) memcpy(&model, it->src, sizeof(mat44_t));
+        else model = it->model;
+        const mat44_t mvp = mat44_mul_mat44(model, view_proj);
+        sg_apply_uniforms(0, &SG_RANGE(mvp));
+        sg_draw(0, mesh->count, 1);
+        last_stats.draws++;
+    }
+    num_transient = 0;
+}
+
+void gfx_module_shutdown(void)
+{
+    release_resources();
+    free(items);
+    free(order);
+    free(transient);
+    items = transient = NULL;
+    order = NULL;
+    num_items = cap_items = num_order = num_transient = cap_transient = 0;
+    free_item = -1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Initialise the bridge                                             */
+/* ------------------------------------------------------------------ */
+void gfx_module_init(lua_State *L)
+{
+    register_buffer(L);
+    view_proj = mat44_identity();
+
+    lua_newtable(L);
+    lua_pushcfunction(L, gfx_buffer);         lua_setfield(L, -2, "buffer");
+    lua_pushcfunction(L, gfx_make_buffer);    lua_setfield(L, -2, "make_buffer");
+    lua_pushcfunction(L, gfx_update_buffer);  lua_setfield(L, -2, "update_buffer");
+    lua_pushcfunction(L, gfx_append_buffer);  lua_setfield(L, -2, "append_buffer");
+    lua_pushcfunction(L, gfx_destroy_buffer); lua_setfield(L, -2, "destroy_buffer");
+    lua_pushcfunction(L, gfx_mesh);           lua_setfield(L, -2, "mesh");
+    lua_pushcfunction(L, gfx_texture);        lua_setfield(L, -2, "texture");
+    lua_pushcfunction(L, gfx_pipeline);       lua_setfield(L, -2, "pipeline");
+    lua_pushcfunction(L, gfx_material);       lua_setfield(L, -2, "material");
+    lua_pushcfunction(L, gfx_add);            lua_setfield(L, -2, "add");
+    lua_pushcfunction(L, gfx_set_transform);  lua_setfield(L, -2, "set_transform");
+    lua_pushcfunction(L, gfx_set_material);   lua_setfield(L, -2, "set_material");
+    lua_pushcfunction(L, gfx_set_visible);    lua_setfield(L, -2, "set_visible");
+    lua_pushcfunction(L, gfx_remove);         lua_setfield(L, -2, "remove");
+    lua_pushcfunction(L, gfx_clear);          lua_setfield(L, -2, "clear");
+    lua_pushcfunction(L, gfx_draw);           lua_setfield(L, -2, "draw");
+    lua_pushcfunction(L, gfx_camera);         lua_setfield(L, -2, "camera");
+    lua_pushcfunction(L, gfx_aspect);         lua_setfield(L, -2, "aspect");
+    lua_pushcfunction(L, gfx_draw_stats);     lua_setfield(L, -2, "draw_stats");
+    lua_setglobal(L, "gfx");
+}
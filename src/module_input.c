@@ -0,0 +1,236 @@
+/*======================================================================
+  module_input.c  –  sapp events → Lua _event(e)
+======================================================================*/
+
+#include "module_input.h"
+#include "custom_log.h"
+#include <stdio.h>
+#include <string.h>
+
+#define INPUT_QUEUE_SIZE    256         // events between two frames
+#define EVENT_NAME          "input.event"
+
+/* ------------------------------------------------------------------ */
+/*  Queue filled by the sapp callback, drained once per frame.        */
+/*  Consecutive mouse moves fold into one (latest position, summed    */
+/*  deltas), so a 1000 Hz mouse is still one _event per frame.        */
+/* ------------------------------------------------------------------ */
+typedef struct input_event_t {
+    sapp_event ev;
+    bool       ui;              // imgui wants this one
+} input_event_t;
+
+static lua_State    *L_main;
+static input_event_t queue[INPUT_QUEUE_SIZE];
+static int           queue_len;
+static int           dropped;
+static int           event_ref = LUA_NOREF;      // the one userdata, reused
+
+void input_module_event(const sapp_event *ev, bool ui)
+{
+    if (ev->type == SAPP_EVENTTYPE_MOUSE_MOVE && queue_len > 0) {
+        input_event_t *last = &queue[queue_len - 1];
+        if (last->ev.type == SAPP_EVENTTYPE_MOUSE_MOVE) {
+            float dx = last->ev.mouse_dx + ev->mouse_dx;
+            float dy = last->ev.mouse_dy + ev->mouse_dy;
+            last->ev = *ev;
+            last->ev.mouse_dx = dx;
+            last->ev.mouse_dy = dy;
+            last->ui = last->ui || ui;
+            return;
+        }
+    }
+    if (queue_len == INPUT_QUEUE_SIZE) {
+        dropped++;
+        return;
+    }
+    queue[queue_len++] = (input_event_t){ .ev = *ev, .ui = ui };
+}
+
+void input_module_dispatch(void)
+{
+    if (dropped) {
+        fprintf(stderr, "[INPUT] event queue full, dropped %d event(s)\n", dropped);
+        dropped = 0;
+    }
+    if (!queue_len || !L_main) {
+        queue_len = 0;
+        return;
+    }
+    lua_State *L = L_main;
+    if (lua_getglobal(L, "_event") != LUA_TFUNCTION) {
+        lua_pop(L, 1);
+        queue_len = 0;
+        return;
+    }
+    lua_rawgeti(L, LUA_REGISTRYINDEX, event_ref);
+    input_event_t *e = (input_event_t*)lua_touserdata(L, -1);
+
+    for (int i = 0; i < queue_len; i++) {
+        *e = queue[i];
+        lua_pushvalue(L, -2);
+        lua_pushvalue(L, -2);
+        if (lua_pcall(L, 1, 0, 0) != LUA_OK) {
+            LOG_ERROR("lua", "_event error: %s", lua_tostring(L, -1));
+            lua_pop(L, 1);
+            break;              // don't repeat the same error for every event
+        }
+    }
+    lua_pop(L, 2);
+    queue_len = 0;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Event userdata – fields resolved through a name → id table, no    */
+/*  strings or tables created per access                              */
+/* ------------------------------------------------------------------ */
+enum {
+    F_TYPE, F_FRAME, F_KEY, F_CHAR, F_REPEAT, F_MODS, F_BUTTON,
+    F_X, F_Y, F_DX, F_DY, F_SCROLL_X, F_SCROLL_Y, F_TOUCHES,
+    F_WIDTH, F_HEIGHT, F_UI, F_TOUCH,
+};
+
+static const char *field_names[] = {
+    "type", "frame", "key", "char", "repeat", "mods", "button",
+    "x", "y", "dx", "dy", "scroll_x", "scroll_y", "touches",
+    "width", "height", "ui", "touch",
+};
+
+static const char *type_names[] = {
+    "invalid", "key_down", "key_up", "char", "mouse_down", "mouse_up",
+    "mouse_scroll", "mouse_move", "mouse_enter", "mouse_leave",
+    "touches_began", "touches_moved", "touches_ended", "touches_cancelled",
+    "resized", "iconified", "restored", "focused", "unfocused",
+    "suspended", "resumed", "quit_requested", "clipboard_pasted", "files_dropped",
+};
+
+/* e:touch(i) → id, x, y, changed */
+static int event_touch(lua_State *L)
+{
+    const input_event_t *e = (const input_event_t*)luaL_checkudata(L, 1, EVENT_NAME);
+    lua_Integer i = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, i >= 1 && i <= e->ev.num_touches, 2, "touch index out of range");
+    const sapp_touchpoint *t = &e->ev.touches[i - 1];
+    lua_pushinteger(L, (lua_Integer)t->identifier);
+    lua_pushnumber(L, t->pos_x);
+    lua_pushnumber(L, t->pos_y);
+    lua_pushboolean(L, t->changed);
+    return 4;
+}
+
+/* upvalues: 1 = field ids, 2 = type names, 3 = event_touch */
+static int event_index(lua_State *L)
+{
+    const input_event_t *e = (const input_event_t*)lua_touserdata(L, 1);
+    const sapp_event *ev = &e->ev;
+    lua_pushvalue(L, 2);
+    if (lua_rawget(L, lua_upvalueindex(1)) != LUA_TNUMBER) return 1;   // nil
+
+    switch ((int)lua_tointeger(L, -1)) {
+    case F_TYPE:     lua_rawgeti(L, lua_upvalueindex(2), (lua_Integer)ev->type + 1); break;
+    case F_FRAME:    lua_pushinteger(L, (lua_Integer)ev->frame_count); break;
+    case F_KEY:      lua_pushinteger(L, ev->key_code); break;
+    case F_CHAR:     lua_pushinteger(L, ev->char_code); break;
+    case F_REPEAT:   lua_pushboolean(L, ev->key_repeat); break;
+    case F_MODS:     lua_pushinteger(L, ev->modifiers); break;
+    case F_BUTTON:   lua_pushinteger(L, ev->mouse_button); break;
+    case F_X:        lua_pushnumber(L, ev->mouse_x); break;
+    case F_Y:        lua_pushnumber(L, ev->mouse_y); break;
+    case F_DX:       lua_pushnumber(L, ev->mouse_dx); break;
+    case F_DY:       lua_pushnumber(L, ev->mouse_dy); break;
+    case F_SCROLL_X: lua_pushnumber(L, ev->scroll_x); break;
+    case F_SCROLL_Y: lua_pushnumber(L, ev->scroll_y); break;
+    case F_TOUCHES:  lua_pushinteger(L, ev->num_touches); break;
+    case F_WIDTH:    lua_pushinteger(L, ev->framebuffer_width); break;
+    case F_HEIGHT:   lua_pushinteger(L, ev->framebuffer_height); break;
+    case F_UI:       lua_pushboolean(L, e->ui); break;
+    case F_TOUCH:    lua_pushvalue(L, lua_upvalueindex(3)); break;
+    default:         lua_pushnil(L); break;
+    }
+    return 1;
+}
+
+static int event_newindex(lua_State *L)
+{
+    return luaL_error(L, "input event is read-only");
+}
+
+static int event_tostring(lua_State *L)
+{
+    const input_event_t *e = (const input_event_t*)lua_touserdata(L, 1);
+    int t = (int)e->ev.type;
+    lua_pushfstring(L, "input.event(%s)",
+        t >= 0 && t < (int)(sizeof(type_names) / sizeof(type_names[0])) ? type_names[t] : "?");
+    return 1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Constants                                                         */
+/* ------------------------------------------------------------------ */
+#define K(name) { "KEY_" #name, SAPP_KEYCODE_##name },
+static const struct { const char *name; int value; } constants[] = {
+    K(SPACE) K(APOSTROPHE) K(COMMA) K(MINUS) K(PERIOD) K(SLASH) K(0) K(1)
+    K(2) K(3) K(4) K(5) K(6) K(7) K(8) K(9)
+    K(SEMICOLON) K(EQUAL) K(A) K(B) K(C) K(D) K(E) K(F)
+    K(G) K(H) K(I) K(J) K(K) K(L) K(M) K(N)
+    K(O) K(P) K(Q) K(R) K(S) K(T) K(U) K(V)
+    K(W) K(X) K(Y) K(Z) K(LEFT_BRACKET) K(BACKSLASH) K(RIGHT_BRACKET) K(GRAVE_ACCENT)
+    K(WORLD_1) K(WORLD_2) K(ESCAPE) K(ENTER) K(TAB) K(BACKSPACE) K(INSERT) K(DELETE)
+    K(RIGHT) K(LEFT) K(DOWN) K(UP) K(PAGE_UP) K(PAGE_DOWN) K(HOME) K(END)
+    K(CAPS_LOCK) K(SCROLL_LOCK) K(NUM_LOCK) K(PRINT_SCREEN) K(PAUSE) K(F1) K(F2) K(F3)
+    K(F4) K(F5) K(F6) K(F7) K(F8) K(F9) K(F10) K(F11)
+    K(F12) K(F13) K(F14) K(F15) K(F16) K(F17) K(F18) K(F19)
+    K(F20) K(F21) K(F22) K(F23) K(F24) K(F25) K(KP_0) K(KP_1)
+    K(KP_2) K(KP_3) K(KP_4) K(KP_5) K(KP_6) K(KP_7) K(KP_8) K(KP_9)
+    K(KP_DECIMAL) K(KP_DIVIDE) K(KP_MULTIPLY) K(KP_SUBTRACT) K(KP_ADD) K(KP_ENTER) K(KP_EQUAL) K(LEFT_SHIFT)
+    K(LEFT_CONTROL) K(LEFT_ALT) K(LEFT_SUPER) K(RIGHT_SHIFT) K(RIGHT_CONTROL) K(RIGHT_ALT) K(RIGHT_SUPER) K(MENU)
+    { "MOUSE_LEFT",   SAPP_MOUSEBUTTON_LEFT },
+    { "MOUSE_RIGHT",  SAPP_MOUSEBUTTON_RIGHT },
+    { "MOUSE_MIDDLE", SAPP_MOUSEBUTTON_MIDDLE },
+    { "MOD_SHIFT",    SAPP_MODIFIER_SHIFT },
+    { "MOD_CTRL",     SAPP_MODIFIER_CTRL },
+    { "MOD_ALT",      SAPP_MODIFIER_ALT },
+    { "MOD_SUPER",    SAPP_MODIFIER_SUPER },
+    { "MOD_LMB",      SAPP_MODIFIER_LMB },
+    { "MOD_RMB",      SAPP_MODIFIER_RMB },
+    { "MOD_MMB",      SAPP_MODIFIER_MMB },
+};
+#undef K
+
+/* ------------------------------------------------------------------ */
+/*  Initialise the bridge                                             */
+/* ------------------------------------------------------------------ */
+void input_module_init(lua_State *L)
+{
+    L_main = L;
+    queue_len = 0;
+
+    luaL_newmetatable(L, EVENT_NAME);
+    lua_createtable(L, 0, (int)(sizeof(field_names) / sizeof(field_names[0])));
+    for (int i = 0; i < (int)(sizeof(field_names) / sizeof(field_names[0])); i++) {
+        lua_pushinteger(L, i);
+        lua_setfield(L, -2, field_names[i]);
+    }
+    lua_createtable(L, (int)(sizeof(type_names) / sizeof(type_names[0])), 0);
+    for (int i = 0; i < (int)(sizeof(type_names) / sizeof(type_names[0])); i++) {
+        lua_pushstring(L, type_names[i]);
+        lua_rawseti(L, -2, i + 1);
+    }
+    lua_pushcfunction(L, event_touch);
+    lua_pushcclosure(L, event_index, 3);     lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, event_newindex);    lua_setfield(L, -2, "__newindex");
+    lua_pushcfunction(L, event_tostring);    lua_setfield(L, -2, "__tostring");
+    lua_pop(L, 1);
+
+    lua_newuserdatauv(L, sizeof(input_event_t), 0);
+    memset(lua_touserdata(L, -1), 0, sizeof(input_event_t));
+    luaL_setmetatable(L, EVENT_NAME);
+    event_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+
+    lua_createtable(L, 0, (int)(sizeof(constants) / sizeof(constants[0])));
+    for (int i = 0; i < (int)(sizeof(constants) / sizeof(constants[0])); i++) {
+        lua_pushinteger(L, constants[i].value);
+        lua_setfield(L, -2, constants[i].name);
+    }
+    lua_setglobal(L, "input");
+}
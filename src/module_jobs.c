@@ -0,0 +1,548 @@
+/*======================================================================
+  module_jobs.c  –  Lua worker pool (one lua_State per thread)
+======================================================================*/
+
+#include "module_jobs.h"
+#include "module_math.h"
+#include "lua_alloc.h"
+#include "thread_util.h"
+#include "frame_prof.h"
+#include "custom_log.h"
+#include "lualib.h"
+#include <stdatomic.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JOBS_MAX_THREADS    16
+#define JOBS_QUEUE_SIZE     1024        // slots per queue, power of two
+#define JOBS_MAX_DEPTH      16          // nested tables in a message
+#define JOBS_NAME_SIZE      64
+#define JOBS_PATH_SIZE      256
+
+/* ------------------------------------------------------------------ */
+/*  Messages – header + serialized Lua values in one allocation       */
+/* ------------------------------------------------------------------ */
+typedef struct job_msg_t {
+    lua_Integer id;
+    bool        ok;                     // result: false → data is the error string
+    char        name[JOBS_NAME_SIZE];   // job: global function to call
+    size_t      size;
+    uint8_t     data[];
+} job_msg_t;
+
+enum {
+    TAG_NIL, TAG_FALSE, TAG_TRUE, TAG_INT, TAG_NUM, TAG_STR,
+    TAG_TABLE, TAG_END, TAG_FLOATS
+};
+
+typedef struct msg_buf_t {
+    uint8_t *p;
+    size_t   size, cap;
+} msg_buf_t;
+
+static bool buf_init(msg_buf_t *b)
+{
+    b->cap  = 256;
+    b->size = sizeof(job_msg_t);
+    b->p    = malloc(b->cap);
+    return b->p != NULL;
+}
+
+static bool buf_put(msg_buf_t *b, const void *src, size_t n)
+{
+    if (b->size + n > b->cap) {
+        size_t cap = b->cap;
+        while (b->size + n > cap) cap *= 2;
+        uint8_t *p = realloc(b->p, cap);
+        if (!p) return false;
+        b->p = p;
+        b->cap = cap;
+    }
+    memcpy(b->p + b->size, src, n);
+    b->size += n;
+    return true;
+}
+
+static bool buf_tag(msg_buf_t *b, uint8_t tag) { return buf_put(b, &tag, 1); }
+
+static job_msg_t* buf_finish(msg_buf_t *b)
+{
+    job_msg_t *m = (job_msg_t*)b->p;
+    memset(m, 0, sizeof(*m));
+    m->size = b->size - sizeof(job_msg_t);
+    b->p = NULL;
+    return m;
+}
+
+/* append the value at idx – returns an error message or NULL */
+static const char* write_value(lua_State *L, int idx, msg_buf_t *b, int depth)
+{
+    switch (lua_type(L, idx)) {
+    case LUA_TNIL:
+        return buf_tag(b, TAG_NIL) ? NULL : "out of memory";
+    case LUA_TBOOLEAN:
+        return buf_tag(b, lua_toboolean(L, idx) ? TAG_TRUE : TAG_FALSE) ? NULL : "out of memory";
+    case LUA_TNUMBER:
+        if (lua_isinteger(L, idx)) {
+            lua_Integer i = lua_tointeger(L, idx);
+            return buf_tag(b, TAG_INT) && buf_put(b, &i, sizeof(i)) ? NULL : "out of memory";
+        } else {
+            lua_Number n = lua_tonumber(L, idx);
+            return buf_tag(b, TAG_NUM) && buf_put(b, &n, sizeof(n)) ? NULL : "out of memory";
+        }
+    case LUA_TSTRING: {
+        size_t len;
+        const char *s = lua_tolstring(L, idx, &len);
+        return buf_tag(b, TAG_STR) && buf_put(b, &len, sizeof(len)) && buf_put(b, s, len)
+            ? NULL : "out of memory";
+    }
+    case LUA_TTABLE: {
+        if (depth >= JOBS_MAX_DEPTH) return "tables nested too deeply";
+        if (!lua_checkstack(L, 3)) return "stack overflow";
+        if (!buf_tag(b, TAG_TABLE)) return "out of memory";
+        idx = lua_absindex(L, idx);
+        lua_pushnil(L);
+        while (lua_next(L, idx)) {
+            const char *err = write_value(L, -2, b, depth + 1);
+            if (!err) err = write_value(L, -1, b, depth + 1);
+            if (err) { lua_pop(L, 2); return err; }
+            lua_pop(L, 1);
+        }
+        return buf_tag(b, TAG_END) ? NULL : "out of memory";
+    }
+    case LUA_TUSERDATA: {
+        size_t count;
+        float *f = math_test_floats(L, idx, &count);
+        if (!f) return "cannot send userdata (only vmath.floats)";
+        return buf_tag(b, TAG_FLOATS) && buf_put(b, &count, sizeof(count))
+            && buf_put(b, f, count * sizeof(float)) ? NULL : "out of memory";
+    }
+    default:
+        return "cannot send functions, threads or light userdata";
+    }
+}
+
+/* push the next value, *p advances past it (messages are our own, not validated) */
+static void read_value(lua_State *L, const uint8_t **p)
+{
+    uint8_t tag = *(*p)++;
+    switch (tag) {
+    case TAG_FALSE: lua_pushboolean(L, 0); break;
+    case TAG_TRUE:  lua_pushboolean(L, 1); break;
+    case TAG_INT: {
+        lua_Integer i;
+        memcpy(&i, *p, sizeof(i)); *p += sizeof(i);
+        lua_pushinteger(L, i);
+    } break;
+    case TAG_NUM: {
+        lua_Number n;
+        memcpy(&n, *p, sizeof(n)); *p += sizeof(n);
+        lua_pushnumber(L, n);
+    } break;
+    case TAG_STR: {
+        size_t len;
+        memcpy(&len, *p, sizeof(len)); *p += sizeof(len);
+        lua_pushlstring(L, (const char*)*p, len);
+        *p += len;
+    } break;
+    case TAG_TABLE:
+        luaL_checkstack(L, 3, "jobs message");
+        lua_newtable(L);
+        while (**p != TAG_END) {
+            read_value(L, p);
+            read_value(L, p);
+            lua_rawset(L, -3);
+        }
+        (*p)++;
+        break;
+    case TAG_FLOATS: {
+        size_t count;
+        memcpy(&count, *p, sizeof(count)); *p += sizeof(count);
+        float *f = math_push_floats(L, count);
+        memcpy(f, *p, count * sizeof(float));
+        *p += count * sizeof(float);
+    } break;
+    default: lua_pushnil(L); break;
+    }
+}
+
+/* push every value in m, returns how many */
+static int read_values(lua_State *L, const job_msg_t *m)
+{
+    const uint8_t *p = m->data, *end = m->data + m->size;
+    int n = 0;
+    while (p < end) {
+        luaL_checkstack(L, 1, "jobs message");
+        read_value(L, &p);
+        n++;
+    }
+    return n;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Bounded MPMC queue (Vyukov) – each cell carries a sequence number */
+/*  saying whose turn it is, so push/pop only CAS the head/tail.      */
+/* ------------------------------------------------------------------ */
+typedef struct queue_cell_t {
+    atomic_size_t seq;
+    job_msg_t    *msg;
+} queue_cell_t;
+
+typedef struct queue_t {
+    queue_cell_t cells[JOBS_QUEUE_SIZE];
+    alignas(64) atomic_size_t head;     // next push
+    alignas(64) atomic_size_t tail;     // next pop
+} queue_t;
+
+static void queue_init(queue_t *q)
+{
+    for (size_t i = 0; i < JOBS_QUEUE_SIZE; i++) {
+        atomic_init(&q->cells[i].seq, i);
+        q->cells[i].msg = NULL;
+    }
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+}
+
+static bool queue_push(queue_t *q, job_msg_t *msg)
+{
+    size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+    queue_cell_t *c;
+    for (;;) {
+        c = &q->cells[pos & (JOBS_QUEUE_SIZE - 1)];
+        size_t seq = atomic_load_explicit(&c->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return false;                               // full
+        } else {
+            pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+        }
+    }
+    c->msg = msg;
+    atomic_store_explicit(&c->seq, pos + 1, memory_order_release);
+    return true;
+}
+
+static job_msg_t* queue_pop(queue_t *q)
+{
+    size_t pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    queue_cell_t *c;
+    for (;;) {
+        c = &q->cells[pos & (JOBS_QUEUE_SIZE - 1)];
+        size_t seq = atomic_load_explicit(&c->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->tail, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return NULL;                                // empty
+        } else {
+            pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+        }
+    }
+    job_msg_t *msg = c->msg;
+    atomic_store_explicit(&c->seq, pos + JOBS_QUEUE_SIZE, memory_order_release);
+    return msg;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Pool state – the mutex/condvar only park idle workers, the queues */
+/*  themselves never lock                                             */
+/* ------------------------------------------------------------------ */
+typedef struct worker_t {
+    thread_t thread;
+    int      index;
+} worker_t;
+
+static struct {
+    bool        running;
+    int         num_workers;
+    worker_t    workers[JOBS_MAX_THREADS];
+    queue_t     jobs;
+    queue_t     results;
+    mutex_t     mutex;
+    cond_t      wake;
+    atomic_bool quit;
+    atomic_int  in_flight;              // posted, result not yet polled
+    lua_Integer next_id;
+    char        script[JOBS_PATH_SIZE];
+} pool;
+
+/* ------------------------------------------------------------------ */
+/*  Worker thread                                                     */
+/* ------------------------------------------------------------------ */
+static job_msg_t* make_error(const char *msg)
+{
+    msg_buf_t b;
+    if (!buf_init(&b)) return NULL;
+    size_t len = strlen(msg);
+    if (!buf_tag(&b, TAG_STR) || !buf_put(&b, &len, sizeof(len)) || !buf_put(&b, msg, len)) {
+        free(b.p);
+        return NULL;
+    }
+    return buf_finish(&b);
+}
+
+/* runs under lua_pcall – a failed lookup, unpack or call, out of memory
+   included, comes back as an error instead of a panic on the worker */
+static int call_job(lua_State *L)
+{
+    const job_msg_t *job = (const job_msg_t*)lua_touserdata(L, 1);
+    lua_pop(L, 1);
+    if (lua_getglobal(L, job->name) != LUA_TFUNCTION)
+        return luaL_error(L, "no global function '%s' in %s", job->name, pool.script);
+    lua_call(L, read_values(L, job), LUA_MULTRET);
+    return lua_gettop(L);
+}
+
+static job_msg_t* run_job(lua_State *L, const job_msg_t *job)
+{
+    int top = lua_gettop(L);
+    job_msg_t *res = NULL;
+    char err_msg[256];
+
+    lua_pushcfunction(L, call_job);
+    lua_pushlightuserdata(L, (void*)job);
+    if (lua_pcall(L, 1, LUA_MULTRET, 0) == LUA_OK) {
+        msg_buf_t b;
+        const char *err = buf_init(&b) ? NULL : "out of memory";
+        for (int i = top + 1; !err && i <= lua_gettop(L); i++)
+            err = write_value(L, i, &b, 0);
+        if (!err) {
+            res = buf_finish(&b);
+            res->ok = true;
+        } else {
+            free(b.p);
+            snprintf(err_msg, sizeof(err_msg), "cannot return from '%s': %s", job->name, err);
+            res = make_error(err_msg);
+        }
+    } else {
+        res = make_error(lua_type(L, -1) == LUA_TSTRING ? lua_tostring(L, -1) : "error");
+    }
+    lua_settop(L, top);
+    if (res) res->id = job->id;
+    return res;
+}
+
+static void worker_main(void *arg)
+{
+    worker_t *w = (worker_t*)arg;
+    lua_alloc_t *a = lua_alloc_create();
+    lua_State *L = a ? lua_newstate(lua_alloc_fn, a) : NULL;
+    if (!L) {
+        fprintf(stderr, "ERROR: jobs worker %d: cannot create Lua state\n", w->index);
+        lua_alloc_destroy(a);
+        a = NULL;
+    } else {
+        luaL_openlibs(L);
+        math_module_init(L);
+        lua_pushinteger(L, w->index);
+        lua_setglobal(L, "WORKER_ID");
+        if (luaL_dofile(L, pool.script) != LUA_OK) {
+            LOG_ERROR("lua", "jobs worker %d: %s", w->index, lua_tostring(L, -1));
+            lua_pop(L, 1);
+        }
+    }
+
+    for (;;) {
+        job_msg_t *job = queue_pop(&pool.jobs);
+        if (!job) {
+            mutex_lock(&pool.mutex);
+            while (!atomic_load(&pool.quit) && !(job = queue_pop(&pool.jobs)))
+                cond_wait(&pool.wake, &pool.mutex);
+            mutex_unlock(&pool.mutex);
+            if (!job) break;
+        }
+
+        job_msg_t *res = NULL;
+        PROF_ZONE("jobs.run") { res = L ? run_job(L, job) : make_error("worker has no Lua state"); }
+        if (res) res->id = job->id;
+        free(job);
+        if (!res) {
+            atomic_fetch_sub(&pool.in_flight, 1);
+            continue;
+        }
+        // the main thread drains results every poll – wait for room, not forever
+        while (!queue_push(&pool.results, res)) {
+            if (atomic_load(&pool.quit)) { free(res); break; }
+            thread_yield();
+        }
+    }
+
+    if (L) lua_close(L);
+    lua_alloc_destroy(a);
+    frame_prof_thread_exit();       // pools restart on every jobs.start – rings get reused
+    custom_log_thread_exit();
+}
+
+/* ------------------------------------------------------------------ */
+/*  Pool control                                                      */
+/* ------------------------------------------------------------------ */
+static void pool_stop(void)
+{
+    if (!pool.running) return;
+
+    mutex_lock(&pool.mutex);
+    atomic_store(&pool.quit, true);
+    cond_broadcast(&pool.wake);
+    mutex_unlock(&pool.mutex);
+    for (int i = 0; i < pool.num_workers; i++)
+        thread_join(pool.workers[i].thread);
+
+    job_msg_t *m;
+    while ((m = queue_pop(&pool.jobs)))    free(m);
+    while ((m = queue_pop(&pool.results))) free(m);
+    atomic_store(&pool.in_flight, 0);
+    pool.num_workers = 0;
+    pool.running = false;
+}
+
+static int pool_start(const char *script, int threads)
+{
+    pool_stop();
+
+    snprintf(pool.script, sizeof(pool.script), "%s", script);
+    queue_init(&pool.jobs);
+    queue_init(&pool.results);
+    atomic_store(&pool.quit, false);
+
+    for (int i = 0; i < threads; i++) {
+        pool.workers[i].index = i + 1;
+        if (!thread_start(&pool.workers[i].thread, worker_main, &pool.workers[i])) {
+            fprintf(stderr, "ERROR: jobs: cannot start worker %d\n", i + 1);
+            break;
+        }
+        pool.num_workers++;
+    }
+    pool.running = pool.num_workers > 0;
+    return pool.num_workers;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Lua API                                                           */
+/* ------------------------------------------------------------------ */
+
+/* jobs.start(script[, threads]) → number of workers; restarts a running pool */
+static int l_jobs_start(lua_State *L)
+{
+    const char *script = luaL_checkstring(L, 1);
+    int def = thread_cpu_count() - 1;
+    int threads = (int)luaL_optinteger(L, 2, def);
+    if (threads < 1) threads = 1;
+    if (threads > JOBS_MAX_THREADS) threads = JOBS_MAX_THREADS;
+    luaL_argcheck(L, strlen(script) < JOBS_PATH_SIZE, 1, "path too long");
+
+    int n = pool_start(script, threads);
+    if (n) printf("jobs: %d worker(s) running %s\n", n, script);
+    lua_pushinteger(L, n);
+    return 1;
+}
+
+/* jobs.post(fname, ...) → id | nil, err */
+static int l_jobs_post(lua_State *L)
+{
+    size_t len;
+    const char *name = luaL_checklstring(L, 1, &len);
+    luaL_argcheck(L, len < JOBS_NAME_SIZE, 1, "function name too long");
+    if (!pool.running) {
+        lua_pushnil(L);
+        lua_pushliteral(L, "jobs not started");
+        return 2;
+    }
+
+    msg_buf_t b;
+    if (!buf_init(&b)) return luaL_error(L, "jobs.post: out of memory");
+    int top = lua_gettop(L);
+    for (int i = 2; i <= top; i++) {
+        const char *err = write_value(L, i, &b, 0);
+        if (err) {
+            free(b.p);
+            return luaL_error(L, "jobs.post: argument #%d: %s", i, err);
+        }
+    }
+    job_msg_t *job = buf_finish(&b);
+    memcpy(job->name, name, len + 1);
+    lua_Integer id = job->id = ++pool.next_id;
+
+    if (!queue_push(&pool.jobs, job)) {
+        free(job);
+        lua_pushnil(L);
+        lua_pushliteral(L, "job queue full");
+        return 2;
+    }
+    atomic_fetch_add(&pool.in_flight, 1);
+    mutex_lock(&pool.mutex);
+    cond_signal(&pool.wake);
+    mutex_unlock(&pool.mutex);
+
+    lua_pushinteger(L, id);             // job belongs to the workers now
+    return 1;
+}
+
+/* jobs.poll() → id, ok, results... | nil   (ok=false: results is the error) */
+static int l_jobs_poll(lua_State *L)
+{
+    job_msg_t *res = pool.running ? queue_pop(&pool.results) : NULL;
+    if (!res) {
+        lua_pushnil(L);
+        return 1;
+    }
+    atomic_fetch_sub(&pool.in_flight, 1);
+    lua_pushinteger(L, res->id);
+    lua_pushboolean(L, res->ok);
+    int n = read_values(L, res);
+    free(res);
+    return 2 + n;
+}
+
+/* jobs.pending() → jobs posted whose result was not polled yet */
+static int l_jobs_pending(lua_State *L)
+{
+    lua_pushinteger(L, atomic_load(&pool.in_flight));
+    return 1;
+}
+
+/* jobs.threads() → running workers (0 when stopped) */
+static int l_jobs_threads(lua_State *L)
+{
+    lua_pushinteger(L, pool.num_workers);
+    return 1;
+}
+
+static int l_jobs_stop(lua_State *L)
+{
+    (void)L;
+    pool_stop();
+    return 0;
+}
+
+void jobs_module_init(lua_State *L)
+{
+    static bool once = false;
+    if (!once) {
+        mutex_init(&pool.mutex);
+        cond_init(&pool.wake);
+        once = true;
+    }
+
+    lua_newtable(L);
+    lua_pushcfunction(L, l_jobs_start);   lua_setfield(L, -2, "start");
+    lua_pushcfunction(L, l_jobs_stop);    lua_setfield(L, -2, "stop");
+    lua_pushcfunction(L, l_jobs_post);    lua_setfield(L, -2, "post");
+    lua_pushcfunction(L, l_jobs_poll);    lua_setfield(L, -2, "poll");
+    lua_pushcfunction(L, l_jobs_pending); lua_setfield(L, -2, "pending");
+    lua_pushcfunction(L, l_jobs_threads); lua_setfield(L, -2, "threads");
+    lua_setglobal(L, "jobs");
+}
+
+void jobs_module_shutdown(void)
+{
+    pool_stop();
+}
@@ -3,8 +3,22 @@
 ======================================================================*/
 
 #include "module_lua.h"
+#include "lua_alloc.h"
+#include "file_watch.h"
+#include "module_sched.h"
+#include "custom_log.h"
 #include "sokol_app.h"
+#include "sokol_time.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <direct.h>
+#define make_dir(path) _mkdir(path)
+#else
+#include <sys/stat.h>
+#define make_dir(path) mkdir(path, 0755)
+#endif
 #include "cimgui.h"
 // #include "sokol_imgui.h"
 
@@ -12,6 +26,24 @@
 /*  Global Lua state (file-scope, not static inside function)         */
 /* ------------------------------------------------------------------ */
 static lua_State *L = NULL;
+static lua_alloc_t *A = NULL;             // pools + TLSF heap behind L
+
+/* ------------------------------------------------------------------ */
+/*  GC scheduler – automatic collection is stopped, lua_module_gc_step */
+/*  runs incremental slices in the time left after sg_commit(). Past   */
+/*  pressure_kb the collector switches to automatic generational mode  */
+/*  until usage drops below half of it again.                          */
+/* ------------------------------------------------------------------ */
+#define GC_BUDGET_SHARE     0.75                // of the frame duration
+#define GC_PRESSURE_KB      (64 * 1024)
+#define GC_PAUSE_PERCENT    150                 // like LUA_GCSETPAUSE
+
+static struct {
+    uint64_t frame_start;
+    int      pressure_kb;
+    int      idle_until_kb;                     // no new cycle below this
+    lua_gc_stats_t stats;
+} gc = { .pressure_kb = GC_PRESSURE_KB };
 
 /* ------------------------------------------------------------------ */
 /*  C → Lua : test_call()  →  hello_world()                           */
@@ -31,21 +63,303 @@ static int lua_sapp_frame_count(lua_State *L)
 }
 
 
+/* ------------------------------------------------------------------ */
+/*  mem.stats() → current, peak, frame_allocs, frame_bytes            */
+/*  (multiple returns so the query itself allocates nothing)          */
+/* ------------------------------------------------------------------ */
+static int lua_mem_stats(lua_State *L)
+{
+    lua_alloc_stats_t s = lua_alloc_get_stats(A);
+    lua_pushinteger(L, (lua_Integer)s.current_bytes);
+    lua_pushinteger(L, (lua_Integer)s.peak_bytes);
+    lua_pushinteger(L, (lua_Integer)s.frame_allocs);
+    lua_pushinteger(L, (lua_Integer)s.frame_bytes);
+    return 4;
+}
+
+/* mem.gc_stats() → frame_ms, frame_worst_ms, steps, generational */
+static int lua_mem_gc_stats(lua_State *L)
+{
+    lua_pushnumber(L, gc.stats.frame_ms);
+    lua_pushnumber(L, gc.stats.frame_worst_ms);
+    lua_pushinteger(L, gc.stats.frame_steps);
+    lua_pushboolean(L, gc.stats.generational);
+    return 4;
+}
+
+/* luaL_newstate() installs these for us, lua_newstate() does not */
+static int lua_on_panic(lua_State *L)
+{
+    LOG_ERROR("lua", "PANIC: %s", lua_tostring(L, -1));
+    custom_log_flush();                     // Lua aborts right after this
+    return 0;
+}
+
+static void lua_on_warn(void *ud, const char *msg, int tocont)
+{
+    (void)ud;
+    fprintf(stderr, "%s%s", msg, tocont ? "" : "\n");
+}
+
+/* ------------------------------------------------------------------ */
+/*  Sampling profiler – a LUA_MASKCOUNT hook walks the Lua stack every */
+/*  `interval` VM instructions and bumps one node of a call tree.      */
+/*  Children are looked up in a single open-addressed hash keyed by    */
+/*  (parent, function), so a sample costs a stack walk and a few       */
+/*  probes. When disabled no hook is installed at all. Coroutines      */
+/*  inherit the hook only if created while sampling is on.             */
+/* ------------------------------------------------------------------ */
+#define PROF_MAX_FUNCS      4096
+#define PROF_MAX_NODES      16384
+#define PROF_HASH_SIZE      32768               // power of two, > 2 * max
+#define PROF_MAX_DEPTH      64
+#define PROF_TOP_N          25
+
+typedef struct prof_func_t {
+    const void *id;                             // source string or lua_CFunction
+    int         line;                           // linedefined, -1 for C
+    uint32_t    self;                           // samples with it on top
+    uint32_t    total;                          // samples with it anywhere
+    char        name[96];
+} prof_func_t;
+
+typedef struct prof_node_t {
+    int      parent;                            // -1 for roots
+    int      func;
+    uint32_t self;
+} prof_node_t;
+
+static struct {
+    bool        enabled;
+    int         interval;
+    uint32_t    samples;
+    uint32_t    dropped;                        // tables full
+    int         num_funcs;
+    int         num_nodes;
+    int         func_hash[PROF_HASH_SIZE];      // index + 1, 0 = empty
+    int         node_hash[PROF_HASH_SIZE];
+    prof_func_t funcs[PROF_MAX_FUNCS];
+    prof_node_t nodes[PROF_MAX_NODES];
+} prof = { .interval = 1000 };
+
+static uint32_t prof_hash(uintptr_t a, uintptr_t b)
+{
+    uint64_t h = (uint64_t)a * 0x9E3779B97F4A7C15ull ^ (uint64_t)b * 0xC2B2AE3D27D4EB4Full;
+    return (uint32_t)(h ^ (h >> 29)) & (PROF_HASH_SIZE - 1);
+}
+
+/* function index for a stack level, interned on first sight */
+static int prof_func(lua_State *L, lua_Debug *ar)
+{
+    if (!lua_getinfo(L, "S", ar)) return -1;
+    const void *id = ar->source;
+    int line = ar->linedefined;
+    if (ar->what[0] == 'C') {
+        lua_getinfo(L, "f", ar);
+        id = (const void*)lua_tocfunction(L, -1);
+        lua_pop(L, 1);
+        line = -1;
+    }
+
+    uint32_t h = prof_hash((uintptr_t)id, (uintptr_t)line);
+    for (int i; (i = prof.func_hash[h]) != 0; h = (h + 1) & (PROF_HASH_SIZE - 1)) {
+        prof_func_t *f = &prof.funcs[i - 1];
+        if (f->id == id && f->line == line) return i - 1;
+    }
+    if (prof.num_funcs == PROF_MAX_FUNCS) return -1;
+
+    prof_func_t *f = &prof.funcs[prof.num_funcs];
+    *f = (prof_func_t){ .id = id, .line = line };
+    lua_getinfo(L, "n", ar);
+    const char *name = ar->name ? ar->name : (ar->what[0] == 'm' ? "main chunk" : "?");
+    if (line >= 0) snprintf(f->name, sizeof(f->name), "%s (%s:%d)", name, ar->short_src, line);
+    else snprintf(f->name, sizeof(f->name), "%s [C]", name);
+    prof.func_hash[h] = ++prof.num_funcs;
+    return prof.num_funcs - 1;
+}
+
+static int prof_child(int parent, int func)
+{
+    uint32_t h = prof_hash((uintptr_t)(parent + 1), (uintptr_t)func);
+    for (int i; (i = prof.node_hash[h]) != 0; h = (h + 1) & (PROF_HASH_SIZE - 1)) {
+        prof_node_t *n = &prof.nodes[i - 1];
+        if (n->parent == parent && n->func == func) return i - 1;
+    }
+    if (prof.num_nodes == PROF_MAX_NODES) return -1;
+    prof.nodes[prof.num_nodes] = (prof_node_t){ .parent = parent, .func = func };
+    prof.node_hash[h] = ++prof.num_nodes;
+    return prof.num_nodes - 1;
+}
+
+static void prof_hook(lua_State *L, lua_Debug *ar)
+{
+    (void)ar;
+    if (!prof.enabled) {                        // a coroutine that inherited the hook while on
+        lua_sethook(L, NULL, 0, 0);
+        return;
+    }
+    int stack[PROF_MAX_DEPTH];                  // [0] = running function
+    int depth = 0;
+    lua_Debug d;
+    for (int level = 0; depth < PROF_MAX_DEPTH && lua_getstack(L, level, &d); level++) {
+        int f = prof_func(L, &d);
+        if (f >= 0) stack[depth++] = f;
+    }
+    if (depth == 0) return;
+
+    int node = -1;
+    for (int i = depth - 1; i >= 0 && (node = prof_child(node, stack[i])) >= 0; i--) {}
+    if (node < 0) {
+        prof.dropped++;
+        return;
+    }
+    prof.samples++;
+    prof.nodes[node].self++;
+    prof.funcs[stack[0]].self++;
+    for (int i = 0; i < depth; i++) {           // recursion counts once
+        int j = 0;
+        while (j < i && stack[j] != stack[i]) j++;
+        if (j == i) prof.funcs[stack[i]].total++;
+    }
+}
+
+/* The hook goes on the main thread; lua_newthread copies it, so coroutines
+   created while sampling are sampled too and drop it on their next count
+   event after disable. Coroutines that already exist when sampling starts
+   keep running unhooked – their time is not in the profile. */
+void lua_module_profiler_enable(bool enable, int interval)
+{
+    if (interval > 0) prof.interval = interval;
+    prof.enabled = enable;
+    if (L) lua_sethook(L, enable ? prof_hook : NULL, enable ? LUA_MASKCOUNT : 0, prof.interval);
+}
+
+void lua_module_profiler_reset(void)
+{
+    prof.samples = prof.dropped = 0;
+    prof.num_funcs = prof.num_nodes = 0;
+    memset(prof.func_hash, 0, sizeof(prof.func_hash));
+    memset(prof.node_hash, 0, sizeof(prof.node_hash));
+}
+
+/* collapsed stacks ("a;b;c 42" per line) for flamegraph.pl / speedscope */
+int lua_module_profiler_dump(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        fprintf(stderr, "Lua profiler: cannot write '%s'\n", path);
+        return -1;
+    }
+    int chain[PROF_MAX_DEPTH];
+    for (int i = 0; i < prof.num_nodes; i++) {
+        if (prof.nodes[i].self == 0) continue;
+        int depth = 0;
+        for (int n = i; n >= 0; n = prof.nodes[n].parent) chain[depth++] = prof.nodes[n].func;
+        while (depth--) fprintf(f, "%s%c", prof.funcs[chain[depth]].name, depth ? ';' : ' ');
+        fprintf(f, "%u\n", prof.nodes[i].self);
+    }
+    fclose(f);
+    printf("Lua profiler: %u samples written to '%s'\n", prof.samples, path);
+    return 0;
+}
+
+static int prof_cmp_self(const void *a, const void *b)
+{
+    uint32_t sa = prof.funcs[*(const int*)a].self, sb = prof.funcs[*(const int*)b].self;
+    return (sa < sb) - (sa > sb);
+}
+
+/* live top-N window, *open is cleared by the close button */
+void lua_module_profiler_window(bool *open)
+{
+    if (!*open) return;
+    igSetNextWindowSize((ImVec2){ 520, 420 }, ImGuiCond_FirstUseEver);
+    if (igBegin("Lua Profiler", open, ImGuiWindowFlags_None)) {
+        bool enabled = prof.enabled;
+        if (igCheckbox("Sampling", &enabled)) lua_module_profiler_enable(enabled, 0);
+        igSameLine();
+        if (igButton("Reset")) lua_module_profiler_reset();
+        igSameLine();
+        if (igButton("Dump lua_profile.folded")) lua_module_profiler_dump("lua_profile.folded");
+        int interval = prof.interval;
+        if (igSliderInt("Instructions / sample", &interval, 100, 100000) && interval != prof.interval) {
+            lua_module_profiler_enable(prof.enabled, interval);
+        }
+        igText("%u samples, %d functions, %d nodes, %u dropped",
+               prof.samples, prof.num_funcs, prof.num_nodes, prof.dropped);
+
+        static int order[PROF_MAX_FUNCS];
+        for (int i = 0; i < prof.num_funcs; i++) order[i] = i;
+        qsort(order, (size_t)prof.num_funcs, sizeof(int), prof_cmp_self);
+        int rows = prof.num_funcs < PROF_TOP_N ? prof.num_funcs : PROF_TOP_N;
+        double scale = prof.samples ? 100.0 / prof.samples : 0.0;
+
+        if (igBeginTable("prof_top", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders)) {
+            igTableSetupColumn("Function", ImGuiTableColumnFlags_WidthStretch);
+            igTableSetupColumn("Self %", ImGuiTableColumnFlags_WidthFixed);
+            igTableSetupColumn("Total %", ImGuiTableColumnFlags_WidthFixed);
+            igTableHeadersRow();
+            for (int r = 0; r < rows; r++) {
+                const prof_func_t *fn = &prof.funcs[order[r]];
+                igTableNextRow();
+                igTableNextColumn(); igTextUnformatted(fn->name);
+                igTableNextColumn(); igText("%5.1f", fn->self * scale);
+                igTableNextColumn(); igText("%5.1f", fn->total * scale);
+            }
+            igEndTable();
+        }
+    }
+    igEnd();
+}
+
+/* profiler.start([interval]) / stop() / reset() / dump([path]) */
+static int lua_prof_start(lua_State *L)
+{
+    lua_module_profiler_enable(true, (int)luaL_optinteger(L, 1, 0));
+    return 0;
+}
+
+static int lua_prof_stop(lua_State *L)
+{
+    (void)L;
+    lua_module_profiler_enable(false, 0);
+    return 0;
+}
+
+static int lua_prof_reset(lua_State *L)
+{
+    (void)L;
+    lua_module_profiler_reset();
+    return 0;
+}
+
+static int lua_prof_dump(lua_State *L)
+{
+    lua_pushboolean(L, lua_module_profiler_dump(luaL_optstring(L, 1, "lua_profile.folded")) == 0);
+    return 1;
+}
+
 /* ------------------------------------------------------------------ */
 /*  Initialise Lua, register function and load script.lua             */
 /* ------------------------------------------------------------------ */
 void lua_module_init(void)
 {
-    // Close previous state if any (for hot-reload, optional)
+    // Close previous state if any (full reset – edits are picked up in place by lua_module_poll_reload)
     if (L) {
         lua_close(L);
+        lua_alloc_destroy(A);
     }
 
-    L = luaL_newstate();
+    A = lua_alloc_create();
+    L = A ? lua_newstate(lua_alloc_fn, A) : NULL;
     if (!L) {
         fprintf(stderr, "ERROR: cannot create Lua state\n");
+        lua_alloc_destroy(A);
+        A = NULL;
         return;
     }
+    lua_atpanic(L, lua_on_panic);
+    lua_setwarnf(L, lua_on_warn, NULL);
 
     luaL_openlibs(L);
 
@@ -53,6 +367,25 @@ void lua_module_init(void)
     lua_pushcfunction(L, test_call);lua_setglobal(L, "hello_world");
     lua_pushcfunction(L, lua_sapp_frame_count);lua_setglobal(L, "sapp_frame_count");
 
+    lua_newtable(L);
+    lua_pushcfunction(L, lua_mem_stats); lua_setfield(L, -2, "stats");
+    lua_pushcfunction(L, lua_mem_gc_stats); lua_setfield(L, -2, "gc_stats");
+    lua_setglobal(L, "mem");
+
+    lua_newtable(L);
+    lua_pushcfunction(L, lua_prof_start); lua_setfield(L, -2, "start");
+    lua_pushcfunction(L, lua_prof_stop);  lua_setfield(L, -2, "stop");
+    lua_pushcfunction(L, lua_prof_reset); lua_setfield(L, -2, "reset");
+    lua_pushcfunction(L, lua_prof_dump);  lua_setfield(L, -2, "dump");
+    lua_setglobal(L, "profiler");
+    lua_module_profiler_reset();
+    prof.enabled = false;
+
+    // collection only happens in lua_module_gc_step()
+    lua_gc(L, LUA_GCSTOP);
+    gc.stats = (lua_gc_stats_t){ 0 };
+    gc.idle_until_kb = 0;
+
     // Load script.lua
     // const char *script = "script.lua";
     // if (luaL_dofile(L, script) != LUA_OK) {
@@ -67,6 +400,223 @@ lua_State* get_lua_state(void)
     return L;
 }
 
+/* ------------------------------------------------------------------ */
+/*  Per-frame allocator bookkeeping                                   */
+/* ------------------------------------------------------------------ */
+void lua_module_new_frame(void)
+{
+    gc.frame_start = stm_now();
+    if (A) lua_alloc_new_frame(A);
+}
+
+/* ------------------------------------------------------------------ */
+/*  GC slices in the frame's leftover time (call after sg_commit)     */
+/* ------------------------------------------------------------------ */
+void lua_module_gc_step(double frame_duration)
+{
+    if (!L) return;
+
+    gc.stats.frame_ms = 0.0;
+    gc.stats.frame_worst_ms = 0.0;
+    gc.stats.frame_steps = 0;
+
+    int kb = lua_gc(L, LUA_GCCOUNT);
+    if (!gc.stats.generational && kb > gc.pressure_kb) {
+        fprintf(stderr, "Lua GC: %d KB in use, switching to generational\n", kb);
+        lua_gc(L, LUA_GCGEN, 0, 0);
+        lua_gc(L, LUA_GCRESTART);
+        gc.stats.generational = true;
+    } else if (gc.stats.generational && kb < gc.pressure_kb / 2) {
+        lua_gc(L, LUA_GCINC, 0, 0, 0);
+        lua_gc(L, LUA_GCSTOP);
+        gc.stats.generational = false;
+    }
+    if (gc.stats.generational) return;   // collector runs on its own
+    if (kb < gc.idle_until_kb) return;    // last cycle freed enough
+
+    double budget_ms = frame_duration * 1000.0 * GC_BUDGET_SHARE
+                     - stm_ms(stm_since(gc.frame_start));
+    uint64_t lap = stm_now();
+    while (budget_ms > 0.0) {
+        int done = lua_gc(L, LUA_GCSTEP, 0);
+        double ms = stm_ms(stm_laptime(&lap));
+        budget_ms -= ms;
+        gc.stats.frame_ms += ms;
+        gc.stats.frame_steps++;
+        if (ms > gc.stats.frame_worst_ms) gc.stats.frame_worst_ms = ms;
+        if (done) {                       // cycle finished
+            gc.idle_until_kb = lua_gc(L, LUA_GCCOUNT) * GC_PAUSE_PERCENT / 100;
+            break;
+        }
+    }
+    gc.stats.total_ms += gc.stats.frame_ms;
+    if (gc.stats.frame_worst_ms > gc.stats.worst_ms) {
+        gc.stats.worst_ms = gc.stats.frame_worst_ms;
+    }
+}
+
+lua_gc_stats_t lua_module_gc_stats(void)
+{
+    return gc.stats;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Hot-reload – re-run changed scripts inside the existing state so   */
+/*  globals survive; scripts guard their data with `x = x or {}`      */
+/* ------------------------------------------------------------------ */
+void lua_module_poll_reload(void)
+{
+    if (!L) return;
+
+    int ids[FILE_WATCH_MAX];
+    int n = file_watch_poll(ids, FILE_WATCH_MAX);
+    for (int i = 0; i < n; i++) {
+        const char *path = file_watch_path(ids[i]);
+        printf("Lua: '%s' changed – reloading\n", path);
+        load_script(path);
+    }
+}
+
+lua_alloc_stats_t lua_module_alloc_stats(void)
+{
+    lua_alloc_stats_t s = { 0 };
+    if (A) s = lua_alloc_get_stats(A);
+    return s;
+}
+
+
+/* ------------------------------------------------------------------ */
+/*  Bytecode cache – LUA_CACHE_DIR/<script>.luac holds a small header  */
+/*  (magic, FNV-1a hash of Lua release + source) followed by the       */
+/*  lua_dump() of the compiled chunk. A header mismatch means the      */
+/*  source or the Lua version changed and the entry is rewritten.      */
+/* ------------------------------------------------------------------ */
+#define LUA_CACHE_DIR    ".luacache"
+#define LUA_CACHE_MAGIC  0x4843434cu       // "LCCH"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t reserved;
+    uint64_t hash;
+} cache_header_t;
+
+typedef struct {
+    char  *data;
+    size_t size;
+    size_t capacity;
+} dump_buffer_t;
+
+static uint64_t fnv1a(uint64_t h, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+static char* read_file(const char *filename, size_t *size)
+{
+    FILE *f = fopen(filename, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = len >= 0 ? (char*)malloc((size_t)len + 1) : NULL;
+    if (data && fread(data, 1, (size_t)len, f) != (size_t)len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    if (data) {
+        data[len] = 0;
+        *size = (size_t)len;
+    }
+    return data;
+}
+
+static void cache_path(const char *filename, char *buf, size_t buf_size)
+{
+    int n = snprintf(buf, buf_size, "%s/", LUA_CACHE_DIR);
+    for (const char *c = filename; *c && n < (int)buf_size - 6; c++) {
+        buf[n++] = (*c == '/' || *c == '\\' || *c == ':') ? '_' : *c;
+    }
+    snprintf(buf + n, buf_size - (size_t)n, ".luac");
+}
+
+static int dump_writer(lua_State *L, const void *p, size_t sz, void *ud)
+{
+    (void)L;
+    dump_buffer_t *b = (dump_buffer_t*)ud;
+    if (b->size + sz > b->capacity) {
+        size_t cap = b->capacity ? b->capacity * 2 : 4096;
+        while (cap < b->size + sz) cap *= 2;
+        char *data = (char*)realloc(b->data, cap);
+        if (!data) return 1;
+        b->data = data;
+        b->capacity = cap;
+    }
+    memcpy(b->data + b->size, p, sz);
+    b->size += sz;
+    return 0;
+}
+
+/* dump the function on top of the stack into the cache */
+static void cache_store(const char *path, uint64_t hash)
+{
+    dump_buffer_t b = { 0 };
+    cache_header_t h = { LUA_CACHE_MAGIC, 0, hash };
+    if (dump_writer(L, &h, sizeof(h), &b) == 0 && lua_dump(L, dump_writer, &b, 0) == 0) {
+        make_dir(LUA_CACHE_DIR);
+        FILE *f = fopen(path, "wb");
+        if (f) {
+            fwrite(b.data, 1, b.size, f);
+            fclose(f);
+        }
+    }
+    free(b.data);
+}
+
+/* push the compiled chunk of filename; cached bytecode if still valid */
+static int load_chunk(const char *filename, const char *src, size_t src_size, bool *cache_hit)
+{
+    char chunkname[512];
+    char path[512];
+    snprintf(chunkname, sizeof(chunkname), "@%s", filename);
+    cache_path(filename, path, sizeof(path));
+
+    uint64_t hash = fnv1a(0xcbf29ce484222325ull, LUA_RELEASE, sizeof(LUA_RELEASE));
+    hash = fnv1a(hash, src, src_size);
+
+    size_t size = 0;
+    char *cached = read_file(path, &size);
+    if (cached && size > sizeof(cache_header_t)) {
+        cache_header_t h;
+        memcpy(&h, cached, sizeof(h));
+        if (h.magic == LUA_CACHE_MAGIC && h.hash == hash) {
+            if (luaL_loadbufferx(L, cached + sizeof(h), size - sizeof(h), chunkname, "b") == LUA_OK) {
+                free(cached);
+                *cache_hit = true;
+                return LUA_OK;
+            }
+            lua_pop(L, 1);                // corrupt entry – recompile below
+        }
+    }
+    free(cached);
+    *cache_hit = false;
+
+    /* skip a '#!' first line like luaL_loadfile, keep the newline for line numbers */
+    const char *code = src;
+    if (*code == '#') {
+        while (*code && *code != '\n') code++;
+    }
+    int status = luaL_loadbufferx(L, code, src_size - (size_t)(code - src), chunkname, "t");
+    if (status == LUA_OK) {
+        cache_store(path, hash);
+    }
+    return status;
+}
 
 /* ------------------------------------------------------------------ */
 /*  2. Load and run a script if the file exists                       */
@@ -78,27 +628,76 @@ int load_script(const char *filename)
         return -1;
     }
 
+    uint64_t start = stm_now();
+    file_watch_add(filename);             // also picks the file up once created
+
     // Check if file exists
-    FILE *f = fopen(filename, "rb");
-    if (!f) {
+    size_t size = 0;
+    char *src = read_file(filename, &size);
+    if (!src) {
         // Not an error — just skip
         printf("Lua: file '%s' not found — skipped\n", filename);
         return 0;
     }
-    fclose(f);
 
-    // Load and execute
-    if (luaL_dofile(L, filename) != LUA_OK) {
-        fprintf(stderr, "Lua ERROR in %s: %s\n",
-                filename, lua_tostring(L, -1));
+    // Load (compile or cached bytecode) and execute
+    bool cache_hit = false;
+    int status = load_chunk(filename, src, size, &cache_hit);
+    free(src);
+    if (status == LUA_OK) {
+        sched_module_reset();               // a reload must not double the timers
+        status = lua_pcall(L, 0, 0, 0);
+    }
+    if (status != LUA_OK) {
+        LOG_ERROR("lua", "error in %s: %s", filename, lua_tostring(L, -1));
         lua_pop(L, 1);
         return -1;
     }
 
-    printf("Lua: '%s' loaded successfully\n", filename);
+    printf("Lua: '%s' loaded successfully (%s, %.3f ms)\n", filename,
+           cache_hit ? "warm: cached bytecode" : "cold: compiled", stm_ms(stm_since(start)));
     return 0;
 }
 
+/* ------------------------------------------------------------------ */
+/*  Fixed-step simulation hooks (the clock lives in main.c)           */
+/* ------------------------------------------------------------------ */
+
+/* UPDATE_HZ global of the script, read every frame so reloads apply */
+double lua_module_update_hz(double fallback)
+{
+    if (!L) return fallback;
+    lua_getglobal(L, "UPDATE_HZ");
+    double hz = lua_tonumber(L, -1);
+    lua_pop(L, 1);
+    return hz > 0.0 ? hz : fallback;
+}
+
+bool lua_module_has_update(void)
+{
+    if (!L) return false;
+    bool found = lua_getglobal(L, "_update") == LUA_TFUNCTION;
+    lua_pop(L, 1);
+    return found;
+}
+
+/* _update(dt) – false when missing or on error */
+bool lua_module_update(double dt)
+{
+    if (!L) return false;
+    if (lua_getglobal(L, "_update") != LUA_TFUNCTION) {
+        lua_pop(L, 1);
+        return false;
+    }
+    lua_pushnumber(L, dt);
+    if (lua_pcall(L, 1, 0, 0) != LUA_OK) {
+        LOG_ERROR("lua", "_update error: %s", lua_tostring(L, -1));
+        lua_pop(L, 1);
+        return false;
+    }
+    return true;
+}
+
 /* ------------------------------------------------------------------ */
 /*  Helper: call Lua function hello_world() from C                    */
 /* ------------------------------------------------------------------ */
@@ -112,7 +711,7 @@ static void call_lua_hello(void)
     lua_getglobal(L, "hello_world");
     if (lua_isfunction(L, -1)) {
         if (lua_pcall(L, 0, 0, 0) != LUA_OK) {
-            fprintf(stderr, "Lua error: %s\n", lua_tostring(L, -1));
+            LOG_ERROR("lua", "hello_world error: %s", lua_tostring(L, -1));
             lua_pop(L, 1);
         }
     } else {
@@ -142,4 +741,6 @@ void lua_module_shutdown(void)
         lua_close(L);
         L = NULL;
     }
+    lua_alloc_destroy(A);
+    A = NULL;
 }
\ No newline at end of file
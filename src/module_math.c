@@ -0,0 +1,874 @@
+/*======================================================================
+  module_math.c  –  vec2/vec3/vec4/mat44 userdata for Lua (vecmath.h)
+======================================================================*/
+
+#include "module_math.h"
+#include "math_kernels.h"
+#include <stdint.h>
+#include <string.h>
+
+#define MAT44_NAME  "mat44"
+#define FLOATS_NAME "floats"
+
+/* typed float array – data is 16-byte aligned inside the userdata */
+typedef struct {
+    size_t count;
+    float *data;
+} floats_t;
+
+static const char *const vec_names[5] = { NULL, NULL, "vec2", "vec3", "vec4" };
+
+/* ------------------------------------------------------------------ */
+/*  Helpers – every vec function gets its component count as          */
+/*  upvalue 1, so vec2/vec3/vec4 share one implementation             */
+/* ------------------------------------------------------------------ */
+static int vec_n(lua_State *L)
+{
+    return (int)lua_tointeger(L, lua_upvalueindex(1));
+}
+
+static float* check_vec(lua_State *L, int idx, int n)
+{
+    return (float*)luaL_checkudata(L, idx, vec_names[n]);
+}
+
+static float* test_vec(lua_State *L, int idx, int n)
+{
+    return (float*)luaL_testudata(L, idx, vec_names[n]);
+}
+
+static float* push_vec(lua_State *L, int n)
+{
+    float *v = (float*)lua_newuserdatauv(L, sizeof(float) * (size_t)n, 0);
+    luaL_setmetatable(L, vec_names[n]);
+    return v;
+}
+
+static mat44_t* check_mat(lua_State *L, int idx)
+{
+    return (mat44_t*)luaL_checkudata(L, idx, MAT44_NAME);
+}
+
+static mat44_t* push_mat(lua_State *L)
+{
+    mat44_t *m = (mat44_t*)lua_newuserdatauv(L, sizeof(mat44_t), 0);
+    luaL_setmetatable(L, MAT44_NAME);
+    return m;
+}
+
+vec2_t*  math_test_vec2(lua_State *L, int idx)  { return (vec2_t*)test_vec(L, idx, 2); }
+vec3_t*  math_test_vec3(lua_State *L, int idx)  { return (vec3_t*)test_vec(L, idx, 3); }
+vec4_t*  math_test_vec4(lua_State *L, int idx)  { return (vec4_t*)test_vec(L, idx, 4); }
+mat44_t* math_test_mat44(lua_State *L, int idx) { return (mat44_t*)luaL_testudata(L, idx, MAT44_NAME); }
+
+void math_push_vec3(lua_State *L, vec3_t v)
+{
+    memcpy(push_vec(L, 3), &v, sizeof(v));
+}
+
+void math_push_mat44(lua_State *L, mat44_t m)
+{
+    *push_mat(L) = m;
+}
+
+/* component index of "x"/"y"/"z"/"w" or 1..n, -1 otherwise */
+static int component(lua_State *L, int idx, int n)
+{
+    int c = -1;
+    if (lua_type(L, idx) == LUA_TSTRING) {
+        size_t len;
+        const char *k = lua_tolstring(L, idx, &len);
+        if (len == 1) {
+            switch (k[0]) {
+            case 'x': c = 0; break;
+            case 'y': c = 1; break;
+            case 'z': c = 2; break;
+            case 'w': c = 3; break;
+            }
+        }
+    } else if (lua_isinteger(L, idx)) {
+        c = (int)lua_tointeger(L, idx) - 1;
+    }
+    return c < n ? c : -1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  vec metamethods – operators return new userdata                    */
+/* ------------------------------------------------------------------ */
+static int vec_index(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    int c = component(L, 2, n);
+    if (c >= 0) {
+        lua_pushnumber(L, v[c]);
+    } else {
+        lua_pushvalue(L, 2);
+        lua_rawget(L, lua_upvalueindex(2));   // methods
+    }
+    return 1;
+}
+
+static int vec_newindex(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    int c = component(L, 2, n);
+    luaL_argcheck(L, c >= 0, 2, "no such component");
+    v[c] = (float)luaL_checknumber(L, 3);
+    return 0;
+}
+
+/* a op b where either side may be a number */
+static void vec_operands(lua_State *L, int n, float a[4], float b[4])
+{
+    for (int i = 0; i < 2; i++) {
+        float *out = i == 0 ? a : b;
+        if (lua_type(L, i + 1) == LUA_TNUMBER) {
+            float s = (float)lua_tonumber(L, i + 1);
+            for (int c = 0; c < n; c++) out[c] = s;
+        } else {
+            memcpy(out, check_vec(L, i + 1, n), sizeof(float) * (size_t)n);
+        }
+    }
+}
+
+static int vec_add(lua_State *L)
+{
+    int n = vec_n(L);
+    float a[4], b[4];
+    vec_operands(L, n, a, b);
+    float *r = push_vec(L, n);
+    for (int c = 0; c < n; c++) r[c] = a[c] + b[c];
+    return 1;
+}
+
+static int vec_sub(lua_State *L)
+{
+    int n = vec_n(L);
+    float a[4], b[4];
+    vec_operands(L, n, a, b);
+    float *r = push_vec(L, n);
+    for (int c = 0; c < n; c++) r[c] = a[c] - b[c];
+    return 1;
+}
+
+static int vec_mul(lua_State *L)
+{
+    int n = vec_n(L);
+    if (n == 4 && lua_type(L, 2) == LUA_TUSERDATA) {
+        mat44_t *m = math_test_mat44(L, 2);
+        if (m) {                               // row vector * matrix
+            vec4_t r = vec4_mul_mat44(*(vec4_t*)check_vec(L, 1, 4), *m);
+            memcpy(push_vec(L, 4), &r, sizeof(r));
+            return 1;
+        }
+    }
+    float a[4], b[4];
+    vec_operands(L, n, a, b);
+    float *r = push_vec(L, n);
+    for (int c = 0; c < n; c++) r[c] = a[c] * b[c];
+    return 1;
+}
+
+static int vec_div(lua_State *L)
+{
+    int n = vec_n(L);
+    float a[4], b[4];
+    vec_operands(L, n, a, b);
+    float *r = push_vec(L, n);
+    for (int c = 0; c < n; c++) r[c] = a[c] / b[c];
+    return 1;
+}
+
+static int vec_unm(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    float *r = push_vec(L, n);
+    for (int c = 0; c < n; c++) r[c] = -v[c];
+    return 1;
+}
+
+/* __eq also runs for two different vector types – those are just unequal */
+static int vec_eq(lua_State *L)
+{
+    int n = vec_n(L);
+    float *a = test_vec(L, 1, n);
+    float *b = test_vec(L, 2, n);
+    lua_pushboolean(L, a && b && memcmp(a, b, sizeof(float) * (size_t)n) == 0);
+    return 1;
+}
+
+static int vec_len(lua_State *L)
+{
+    lua_pushinteger(L, vec_n(L));
+    return 1;
+}
+
+static int vec_tostring(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    switch (n) {
+    case 2:  lua_pushfstring(L, "vec2(%f, %f)", (lua_Number)v[0], (lua_Number)v[1]); break;
+    case 3:  lua_pushfstring(L, "vec3(%f, %f, %f)", (lua_Number)v[0], (lua_Number)v[1], (lua_Number)v[2]); break;
+    default: lua_pushfstring(L, "vec4(%f, %f, %f, %f)", (lua_Number)v[0], (lua_Number)v[1],
+                             (lua_Number)v[2], (lua_Number)v[3]); break;
+    }
+    return 1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  vec methods – trailing '_' mutates self and returns it (no garbage)*/
+/* ------------------------------------------------------------------ */
+static int vec_set(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    float *o = test_vec(L, 2, n);
+    if (o) {
+        memcpy(v, o, sizeof(float) * (size_t)n);
+    } else {
+        for (int c = 0; c < n; c++) v[c] = (float)luaL_optnumber(L, c + 2, 0.0);
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int vec_add_(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    float *o = check_vec(L, 2, n);
+    for (int c = 0; c < n; c++) v[c] += o[c];
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int vec_sub_(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    float *o = check_vec(L, 2, n);
+    for (int c = 0; c < n; c++) v[c] -= o[c];
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int vec_mul_(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    if (lua_type(L, 2) == LUA_TNUMBER) {
+        float s = (float)lua_tonumber(L, 2);
+        for (int c = 0; c < n; c++) v[c] *= s;
+    } else {
+        float *o = check_vec(L, 2, n);
+        for (int c = 0; c < n; c++) v[c] *= o[c];
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int vec_lerp_(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    float *o = check_vec(L, 2, n);
+    float t = (float)luaL_checknumber(L, 3);
+    for (int c = 0; c < n; c++) v[c] += (o[c] - v[c]) * t;
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int vec_normalize_(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    float l = 0.0f;
+    for (int c = 0; c < n; c++) l += v[c] * v[c];
+    l = vecmath_sqrt(l);
+    if (l != 0.0f) {
+        for (int c = 0; c < n; c++) v[c] /= l;
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int vec_dot(lua_State *L)
+{
+    int n = vec_n(L);
+    float *a = check_vec(L, 1, n);
+    float *b = check_vec(L, 2, n);
+    float d = 0.0f;
+    for (int c = 0; c < n; c++) d += a[c] * b[c];
+    lua_pushnumber(L, d);
+    return 1;
+}
+
+static int vec_length(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    float l = 0.0f;
+    for (int c = 0; c < n; c++) l += v[c] * v[c];
+    lua_pushnumber(L, vecmath_sqrt(l));
+    return 1;
+}
+
+static int vec_copy(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    memcpy(push_vec(L, n), v, sizeof(float) * (size_t)n);
+    return 1;
+}
+
+static int vec_unpack(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = check_vec(L, 1, n);
+    for (int c = 0; c < n; c++) lua_pushnumber(L, v[c]);
+    return n;
+}
+
+static int vec3_cross_m(lua_State *L)
+{
+    vec3_t r = vec3_cross(*(vec3_t*)check_vec(L, 1, 3), *(vec3_t*)check_vec(L, 2, 3));
+    math_push_vec3(L, r);
+    return 1;
+}
+
+static int vec_new(lua_State *L)
+{
+    int n = vec_n(L);
+    float *v = push_vec(L, n);
+    for (int c = 0; c < n; c++) v[c] = (float)luaL_optnumber(L, c + 1, 0.0);
+    return 1;
+}
+
+static const luaL_Reg vec_meta[] = {
+    { "__index",    vec_index },
+    { "__newindex", vec_newindex },
+    { "__add",      vec_add },
+    { "__sub",      vec_sub },
+    { "__mul",      vec_mul },
+    { "__div",      vec_div },
+    { "__unm",      vec_unm },
+    { "__eq",       vec_eq },
+    { "__len",      vec_len },
+    { "__tostring", vec_tostring },
+    { NULL, NULL }
+};
+
+static const luaL_Reg vec_methods[] = {
+    { "set",        vec_set },
+    { "add_",       vec_add_ },
+    { "sub_",       vec_sub_ },
+    { "mul_",       vec_mul_ },
+    { "lerp_",      vec_lerp_ },
+    { "normalize_", vec_normalize_ },
+    { "dot",        vec_dot },
+    { "length",     vec_length },
+    { "copy",       vec_copy },
+    { "unpack",     vec_unpack },
+    { NULL, NULL }
+};
+
+static void register_vec(lua_State *L, int n)
+{
+    luaL_newmetatable(L, vec_names[n]);
+
+    /* methods table, shared as upvalue 2 of __index */
+    lua_newtable(L);
+    for (const luaL_Reg *r = vec_methods; r->name; r++) {
+        lua_pushinteger(L, n);
+        lua_pushcclosure(L, r->func, 1);
+        lua_setfield(L, -2, r->name);
+    }
+    if (n == 3) {
+        lua_pushcfunction(L, vec3_cross_m);
+        lua_setfield(L, -2, "cross");
+    }
+
+    for (const luaL_Reg *r = vec_meta; r->name; r++) {
+        lua_pushinteger(L, n);
+        if (r->func == vec_index) {
+            lua_pushvalue(L, -2);
+            lua_pushcclosure(L, r->func, 2);
+        } else {
+            lua_pushcclosure(L, r->func, 1);
+        }
+        lua_setfield(L, -3, r->name);
+    }
+    lua_pop(L, 2);
+}
+
+/* ------------------------------------------------------------------ */
+/*  mat44 – rows like vecmath.h, row vectors: v * m                    */
+/*  In-place ops post-multiply: m:translate_(x,y,z) is m = m * T       */
+/* ------------------------------------------------------------------ */
+static int mat_mul(lua_State *L)
+{
+    mat44_t *a = check_mat(L, 1);
+    if (lua_type(L, 2) == LUA_TNUMBER) {
+        *push_mat(L) = mat44_mulf(*a, (float)lua_tonumber(L, 2));
+    } else if (math_test_mat44(L, 2)) {
+        *push_mat(L) = mat44_mul_mat44(*a, *check_mat(L, 2));
+    } else {                                   // matrix * column vector
+        vec4_t r = mat44_mul_vec4(*a, *(vec4_t*)check_vec(L, 2, 4));
+        memcpy(push_vec(L, 4), &r, sizeof(r));
+    }
+    return 1;
+}
+
+static int mat_eq(lua_State *L)
+{
+    lua_pushboolean(L, memcmp(check_mat(L, 1), check_mat(L, 2), sizeof(mat44_t)) == 0);
+    return 1;
+}
+
+static int mat_tostring(lua_State *L)
+{
+    const float *f = (const float*)check_mat(L, 1);
+    luaL_Buffer b;
+    luaL_buffinit(L, &b);
+    luaL_addstring(&b, "mat44(");
+    for (int i = 0; i < 16; i++) {
+        lua_pushfstring(L, i < 15 ? "%f, " : "%f)", (lua_Number)f[i]);
+        luaL_addvalue(&b);
+    }
+    luaL_pushresult(&b);
+    return 1;
+}
+
+static int mat_get(lua_State *L)
+{
+    float *f = (float*)check_mat(L, 1);
+    lua_Integer r = luaL_checkinteger(L, 2), c = luaL_checkinteger(L, 3);
+    luaL_argcheck(L, r >= 1 && r <= 4, 2, "row out of range");
+    luaL_argcheck(L, c >= 1 && c <= 4, 3, "column out of range");
+    lua_pushnumber(L, f[(r - 1) * 4 + (c - 1)]);
+    return 1;
+}
+
+static int mat_set(lua_State *L)
+{
+    float *f = (float*)check_mat(L, 1);
+    mat44_t *o = math_test_mat44(L, 2);
+    if (o) {
+        *(mat44_t*)f = *o;
+    } else {
+        lua_Integer r = luaL_checkinteger(L, 2), c = luaL_checkinteger(L, 3);
+        luaL_argcheck(L, r >= 1 && r <= 4, 2, "row out of range");
+        luaL_argcheck(L, c >= 1 && c <= 4, 3, "column out of range");
+        f[(r - 1) * 4 + (c - 1)] = (float)luaL_checknumber(L, 4);
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_identity_(lua_State *L)
+{
+    *check_mat(L, 1) = mat44_identity();
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_mul_(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    *m = mat44_mul_mat44(*m, *check_mat(L, 2));
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_translate_(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    *m = mat44_mul_mat44(*m, mat44_translation((float)luaL_checknumber(L, 2),
+                         (float)luaL_checknumber(L, 3), (float)luaL_checknumber(L, 4)));
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_scale_(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    float sx = (float)luaL_checknumber(L, 2);
+    *m = mat44_mul_mat44(*m, mat44_scaling(sx, (float)luaL_optnumber(L, 3, sx),
+                                                (float)luaL_optnumber(L, 4, sx)));
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_rotate_x_(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    *m = mat44_mul_mat44(*m, mat44_rotation_x((float)luaL_checknumber(L, 2)));
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_rotate_y_(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    *m = mat44_mul_mat44(*m, mat44_rotation_y((float)luaL_checknumber(L, 2)));
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_rotate_z_(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    *m = mat44_mul_mat44(*m, mat44_rotation_z((float)luaL_checknumber(L, 2)));
+    lua_settop(L, 1);
+    return 1;
+}
+
+static int mat_transpose(lua_State *L)
+{
+    *push_mat(L) = mat44_transpose(*check_mat(L, 1));
+    return 1;
+}
+
+/* m:inverse() → new matrix, or nil when singular */
+static int mat_inverse(lua_State *L)
+{
+    mat44_t r;
+    if (!mat44_inverse(&r, NULL, *check_mat(L, 1))) {
+        lua_pushnil(L);
+        return 1;
+    }
+    *push_mat(L) = r;
+    return 1;
+}
+
+/* m:transform_point(v3) → new vec3, w = 1 */
+static int mat_transform_point(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    vec3_t *p = (vec3_t*)check_vec(L, 2, 3);
+    vec4_t r = vec4_mul_mat44(vec4(p->x, p->y, p->z, 1.0f), *m);
+    math_push_vec3(L, vec3(r.x, r.y, r.z));
+    return 1;
+}
+
+static int mat_copy(lua_State *L)
+{
+    *push_mat(L) = *check_mat(L, 1);
+    return 1;
+}
+
+static const luaL_Reg mat_methods[] = {
+    { "get",             mat_get },
+    { "set",             mat_set },
+    { "identity_",       mat_identity_ },
+    { "mul_",            mat_mul_ },
+    { "translate_",      mat_translate_ },
+    { "scale_",          mat_scale_ },
+    { "rotate_x_",       mat_rotate_x_ },
+    { "rotate_y_",       mat_rotate_y_ },
+    { "rotate_z_",       mat_rotate_z_ },
+    { "transpose",       mat_transpose },
+    { "inverse",         mat_inverse },
+    { "transform_point", mat_transform_point },
+    { "copy",            mat_copy },
+    { NULL, NULL }
+};
+
+static void register_mat(lua_State *L)
+{
+    luaL_newmetatable(L, MAT44_NAME);
+    lua_newtable(L);
+    luaL_setfuncs(L, mat_methods, 0);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, mat_mul);      lua_setfield(L, -2, "__mul");
+    lua_pushcfunction(L, mat_eq);       lua_setfield(L, -2, "__eq");
+    lua_pushcfunction(L, mat_tostring); lua_setfield(L, -2, "__tostring");
+    lua_pop(L, 1);
+}
+
+/* ------------------------------------------------------------------ */
+/*  floats – fixed-size float array for the bulk kernels below        */
+/* ------------------------------------------------------------------ */
+float* math_check_floats(lua_State *L, int idx, size_t *count)
+{
+    floats_t *a = (floats_t*)luaL_checkudata(L, idx, FLOATS_NAME);
+    *count = a->count;
+    return a->data;
+}
+
+/* floats view into memory owned by the value at owner_idx (kept alive as uservalue) */
+void math_push_floats_view(lua_State *L, float *data, size_t count, int owner_idx)
+{
+    owner_idx = lua_absindex(L, owner_idx);
+    floats_t *a = (floats_t*)lua_newuserdatauv(L, sizeof(floats_t), 1);
+    a->count = count;
+    a->data = data;
+    lua_pushvalue(L, owner_idx);
+    lua_setiuservalue(L, -2, 1);
+    luaL_setmetatable(L, FLOATS_NAME);
+}
+
+static floats_t* push_floats(lua_State *L, size_t count)
+{
+    if (count > (SIZE_MAX - sizeof(floats_t) - 15) / sizeof(float)) {
+        luaL_error(L, "vmath.floats: %zu elements is too many", count);
+    }
+    floats_t *a = (floats_t*)lua_newuserdatauv(L, sizeof(floats_t) + count * sizeof(float) + 15, 0);
+    a->count = count;
+    a->data = (float*)(((uintptr_t)(a + 1) + 15) & ~(uintptr_t)15);
+    luaL_setmetatable(L, FLOATS_NAME);
+    return a;
+}
+
+float* math_test_floats(lua_State *L, int idx, size_t *count)
+{
+    floats_t *a = (floats_t*)luaL_testudata(L, idx, FLOATS_NAME);
+    if (!a) return NULL;
+    *count = a->count;
+    return a->data;
+}
+
+float* math_push_floats(lua_State *L, size_t count)
+{
+    return push_floats(L, count)->data;
+}
+
+static int floats_index(lua_State *L)
+{
+    floats_t *a = (floats_t*)luaL_checkudata(L, 1, FLOATS_NAME);
+    if (lua_isinteger(L, 2)) {
+        lua_Integer i = lua_tointeger(L, 2);
+        luaL_argcheck(L, i >= 1 && (size_t)i <= a->count, 2, "index out of range");
+        lua_pushnumber(L, a->data[i - 1]);
+    } else {
+        lua_pushvalue(L, 2);
+        lua_rawget(L, lua_upvalueindex(1));   // methods
+    }
+    return 1;
+}
+
+static int floats_newindex(lua_State *L)
+{
+    floats_t *a = (floats_t*)luaL_checkudata(L, 1, FLOATS_NAME);
+    lua_Integer i = luaL_checkinteger(L, 2);
+    luaL_argcheck(L, i >= 1 && (size_t)i <= a->count, 2, "index out of range");
+    a->data[i - 1] = (float)luaL_checknumber(L, 3);
+    return 0;
+}
+
+static int floats_len(lua_State *L)
+{
+    floats_t *a = (floats_t*)luaL_checkudata(L, 1, FLOATS_NAME);
+    lua_pushinteger(L, (lua_Integer)a->count);
+    return 1;
+}
+
+static int floats_fill(lua_State *L)
+{
+    floats_t *a = (floats_t*)luaL_checkudata(L, 1, FLOATS_NAME);
+    float v = (float)luaL_checknumber(L, 2);
+    for (size_t i = 0; i < a->count; i++) a->data[i] = v;
+    lua_settop(L, 1);
+    return 1;
+}
+
+/* a:from({...}) – copy a Lua array in (setup time, not per frame) */
+static int floats_from(lua_State *L)
+{
+    floats_t *a = (floats_t*)luaL_checkudata(L, 1, FLOATS_NAME);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    size_t n = (size_t)lua_rawlen(L, 2);
+    if (n > a->count) n = a->count;
+    for (size_t i = 0; i < n; i++) {
+        lua_rawgeti(L, 2, (lua_Integer)i + 1);
+        a->data[i] = (float)lua_tonumber(L, -1);
+        lua_pop(L, 1);
+    }
+    lua_settop(L, 1);
+    return 1;
+}
+
+static void register_floats(lua_State *L)
+{
+    luaL_newmetatable(L, FLOATS_NAME);
+    lua_newtable(L);
+    lua_pushcfunction(L, floats_fill); lua_setfield(L, -2, "fill");
+    lua_pushcfunction(L, floats_from); lua_setfield(L, -2, "from");
+    lua_pushcclosure(L, floats_index, 1);
+    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, floats_newindex); lua_setfield(L, -2, "__newindex");
+    lua_pushcfunction(L, floats_len);      lua_setfield(L, -2, "__len");
+    lua_pop(L, 1);
+}
+
+/* vmath.floats(n [, value]) */
+static int vmath_floats(lua_State *L)
+{
+    lua_Integer n = luaL_checkinteger(L, 1);
+    luaL_argcheck(L, n >= 0, 1, "negative size");
+    floats_t *a = push_floats(L, (size_t)n);
+    float v = (float)luaL_optnumber(L, 2, 0.0);
+    for (size_t i = 0; i < a->count; i++) a->data[i] = v;
+    return 1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Bulk kernels – one call replaces a loop in the interpreter.       */
+/*  The element count is the shortest input; outputs must fit it.    */
+/* ------------------------------------------------------------------ */
+static size_t min_count(size_t a, size_t b) { return a < b ? a : b; }
+
+/* vmath.transform_points(m, xs, ys, zs [, ox, oy, oz]) – in place by default */
+static int vmath_transform_points(lua_State *L)
+{
+    mat44_t *m = check_mat(L, 1);
+    size_t nx, ny, nz, n;
+    float *xs = math_check_floats(L, 2, &nx);
+    float *ys = math_check_floats(L, 3, &ny);
+    float *zs = math_check_floats(L, 4, &nz);
+    n = min_count(nx, min_count(ny, nz));
+
+    float *ox = xs, *oy = ys, *oz = zs;
+    if (!lua_isnoneornil(L, 5)) {
+        ox = math_check_floats(L, 5, &nx);
+        oy = math_check_floats(L, 6, &ny);
+        oz = math_check_floats(L, 7, &nz);
+        luaL_argcheck(L, min_count(nx, min_count(ny, nz)) >= n, 5, "output too small");
+    }
+    kernel_transform_points(m, xs, ys, zs, ox, oy, oz, n);
+    return 0;
+}
+
+/* vmath.lerp(out, a, b, t) – t is a number or a floats array */
+static int vmath_lerp(lua_State *L)
+{
+    size_t no, na, nb, nt;
+    float *out = math_check_floats(L, 1, &no);
+    float *a = math_check_floats(L, 2, &na);
+    float *b = math_check_floats(L, 3, &nb);
+    size_t n = min_count(na, nb);
+    luaL_argcheck(L, no >= n, 1, "output too small");
+    if (lua_type(L, 4) == LUA_TNUMBER) {
+        kernel_lerp(out, a, b, (float)lua_tonumber(L, 4), n);
+    } else {
+        float *t = math_check_floats(L, 4, &nt);
+        n = min_count(n, nt);
+        kernel_lerp_array(out, a, b, t, n);
+    }
+    return 0;
+}
+
+/* vmath.madd(out, a, b, s) – out = a + b * s */
+static int vmath_madd(lua_State *L)
+{
+    size_t no, na, nb;
+    float *out = math_check_floats(L, 1, &no);
+    float *a = math_check_floats(L, 2, &na);
+    float *b = math_check_floats(L, 3, &nb);
+    size_t n = min_count(na, nb);
+    luaL_argcheck(L, no >= n, 1, "output too small");
+    kernel_madd(out, a, b, (float)luaL_checknumber(L, 4), n);
+    return 0;
+}
+
+/* vmath.model_matrices(out, px,py,pz, qx,qy,qz,qw, sx,sy,sz) – out holds 16 floats each */
+static int vmath_model_matrices(lua_State *L)
+{
+    size_t no, c;
+    float *out = math_check_floats(L, 1, &no);
+    const float *s[10];
+    size_t n = (size_t)-1;
+    for (int i = 0; i < 10; i++) {
+        s[i] = math_check_floats(L, i + 2, &c);
+        n = min_count(n, c);
+    }
+    luaL_argcheck(L, no / 16 >= n, 1, "output too small");
+    kernel_model_matrices((mat44_t*)out, s[0], s[1], s[2], s[3], s[4], s[5], s[6],
+                          s[7], s[8], s[9], n);
+    return 0;
+}
+
+/* ------------------------------------------------------------------ */
+/*  vmath.* constructors                                              */
+/* ------------------------------------------------------------------ */
+static int vmath_mat44(lua_State *L)
+{
+    mat44_t *o = math_test_mat44(L, 1);
+    *push_mat(L) = o ? *o : mat44_identity();
+    return 1;
+}
+
+static int vmath_translation(lua_State *L)
+{
+    *push_mat(L) = mat44_translation((float)luaL_checknumber(L, 1),
+                                     (float)luaL_checknumber(L, 2), (float)luaL_checknumber(L, 3));
+    return 1;
+}
+
+static int vmath_scaling(lua_State *L)
+{
+    float sx = (float)luaL_checknumber(L, 1);
+    *push_mat(L) = mat44_scaling(sx, (float)luaL_optnumber(L, 2, sx), (float)luaL_optnumber(L, 3, sx));
+    return 1;
+}
+
+static int vmath_rotation_x(lua_State *L) { *push_mat(L) = mat44_rotation_x((float)luaL_checknumber(L, 1)); return 1; }
+static int vmath_rotation_y(lua_State *L) { *push_mat(L) = mat44_rotation_y((float)luaL_checknumber(L, 1)); return 1; }
+static int vmath_rotation_z(lua_State *L) { *push_mat(L) = mat44_rotation_z((float)luaL_checknumber(L, 1)); return 1; }
+
+static int vmath_rotation_axis(lua_State *L)
+{
+    *push_mat(L) = mat44_rotation_axis(*(vec3_t*)check_vec(L, 1, 3), (float)luaL_checknumber(L, 2));
+    return 1;
+}
+
+/* perspective(fovy, aspect, zn, zf) – right handed like the GL samples */
+static int vmath_perspective(lua_State *L)
+{
+    *push_mat(L) = mat44_perspective_fov_rh((float)luaL_checknumber(L, 1), (float)luaL_checknumber(L, 2),
+                                            (float)luaL_checknumber(L, 3), (float)luaL_checknumber(L, 4));
+    return 1;
+}
+
+static int vmath_look_at(lua_State *L)
+{
+    *push_mat(L) = mat44_look_at_rh(*(vec3_t*)check_vec(L, 1, 3), *(vec3_t*)check_vec(L, 2, 3),
+                                    *(vec3_t*)check_vec(L, 3, 3));
+    return 1;
+}
+
+void math_module_init(lua_State *L)
+{
+    register_vec(L, 2);
+    register_vec(L, 3);
+    register_vec(L, 4);
+    register_mat(L);
+    register_floats(L);
+
+    lua_newtable(L);
+    for (int n = 2; n <= 4; n++) {
+        lua_pushinteger(L, n);
+        lua_pushcclosure(L, vec_new, 1);
+        lua_setfield(L, -2, vec_names[n]);
+    }
+    lua_pushcfunction(L, vmath_mat44);         lua_setfield(L, -2, "mat44");
+    lua_pushcfunction(L, vmath_translation);   lua_setfield(L, -2, "translation");
+    lua_pushcfunction(L, vmath_scaling);       lua_setfield(L, -2, "scaling");
+    lua_pushcfunction(L, vmath_rotation_x);    lua_setfield(L, -2, "rotation_x");
+    lua_pushcfunction(L, vmath_rotation_y);    lua_setfield(L, -2, "rotation_y");
+    lua_pushcfunction(L, vmath_rotation_z);    lua_setfield(L, -2, "rotation_z");
+    lua_pushcfunction(L, vmath_rotation_axis); lua_setfield(L, -2, "rotation_axis");
+    lua_pushcfunction(L, vmath_perspective);   lua_setfield(L, -2, "perspective");
+    lua_pushcfunction(L, vmath_look_at);       lua_setfield(L, -2, "look_at");
+
+    lua_pushcfunction(L, vmath_floats);           lua_setfield(L, -2, "floats");
+    lua_pushcfunction(L, vmath_transform_points); lua_setfield(L, -2, "transform_points");
+    lua_pushcfunction(L, vmath_lerp);             lua_setfield(L, -2, "lerp");
+    lua_pushcfunction(L, vmath_madd);             lua_setfield(L, -2, "madd");
+    lua_pushcfunction(L, vmath_model_matrices);   lua_setfield(L, -2, "model_matrices");
+    lua_setglobal(L, "vmath");
+}
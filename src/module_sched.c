@@ -0,0 +1,323 @@
+/*======================================================================
+  module_sched.c  –  coroutine timers on a min-heap of wake times
+======================================================================*/
+
+#include "module_sched.h"
+#include "custom_log.h"
+#include "sokol_time.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCHED_INITIAL_CAP   256
+#define SCHED_NS_PER_SEC    1e9             // stm ticks are nanoseconds
+
+/* one sleeping coroutine or timer callback – the heap holds slot indices */
+typedef struct task_t {
+    uint64_t wake;              // stm_now() ticks
+    uint64_t interval;          // every(): ticks between calls, 0 = one-shot
+    uint32_t seq;               // insertion order, breaks ties and guards update()
+    uint32_t gen;               // bumped on reuse, part of the id
+    int      ref;               // registry ref: coroutine (sleep) or function
+    bool     is_thread;
+    bool     cancelled;         // cancel() from inside its own callback
+    int      heap_pos;          // -1 while not queued
+    int      next_free;
+} task_t;
+
+static lua_State *L_main;
+static task_t    *tasks;
+static int        tasks_cap;
+static int        free_task = -1;
+static int       *heap;         // slot indices, earliest wake at [0]
+static int        heap_len;
+static uint32_t   next_seq;
+
+/* ------------------------------------------------------------------ */
+/*  Slots                                                             */
+/* ------------------------------------------------------------------ */
+static int task_alloc(void)
+{
+    if (free_task < 0) {
+        int cap = tasks_cap ? tasks_cap * 2 : SCHED_INITIAL_CAP;
+        task_t *t = (task_t*)realloc(tasks, (size_t)cap * sizeof(task_t));
+        if (!t) return -1;
+        int *h = (int*)realloc(heap, (size_t)cap * sizeof(int));
+        tasks = t;
+        if (!h) return -1;
+        heap = h;
+        for (int i = cap - 1; i >= tasks_cap; i--) {
+            tasks[i] = (task_t){ .ref = LUA_NOREF, .heap_pos = -1, .next_free = free_task };
+            free_task = i;
+        }
+        tasks_cap = cap;
+    }
+    int slot = free_task;
+    free_task = tasks[slot].next_free;
+    return slot;
+}
+
+static void task_free(int slot)
+{
+    task_t *t = &tasks[slot];
+    luaL_unref(L_main, LUA_REGISTRYINDEX, t->ref);
+    *t = (task_t){ .gen = t->gen + 1, .ref = LUA_NOREF, .heap_pos = -1, .next_free = free_task };
+    free_task = slot;
+}
+
+static lua_Integer task_id(int slot)
+{
+    return ((lua_Integer)tasks[slot].gen << 32) | (lua_Integer)(slot + 1);
+}
+
+/* slot for a live id, -1 otherwise */
+static int task_from_id(lua_Integer id)
+{
+    int slot = (int)(id & 0xffffffff) - 1;
+    if (slot < 0 || slot >= tasks_cap) return -1;
+    if (tasks[slot].ref == LUA_NOREF || tasks[slot].gen != (uint32_t)(id >> 32)) return -1;
+    return slot;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Binary min-heap on (wake, seq)                                    */
+/* ------------------------------------------------------------------ */
+static bool heap_less(int a, int b)
+{
+    const task_t *ta = &tasks[heap[a]], *tb = &tasks[heap[b]];
+    if (ta->wake != tb->wake) return ta->wake < tb->wake;
+    return (int32_t)(ta->seq - tb->seq) < 0;
+}
+
+static void heap_swap(int a, int b)
+{
+    int t = heap[a];
+    heap[a] = heap[b];
+    heap[b] = t;
+    tasks[heap[a]].heap_pos = a;
+    tasks[heap[b]].heap_pos = b;
+}
+
+static void heap_up(int i)
+{
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!heap_less(i, parent)) break;
+        heap_swap(i, parent);
+        i = parent;
+    }
+}
+
+static void heap_down(int i)
+{
+    for (;;) {
+        int l = 2 * i + 1, r = l + 1, m = i;
+        if (l < heap_len && heap_less(l, m)) m = l;
+        if (r < heap_len && heap_less(r, m)) m = r;
+        if (m == i) break;
+        heap_swap(i, m);
+        i = m;
+    }
+}
+
+static void heap_push(int slot)
+{
+    tasks[slot].seq = next_seq++;
+    heap[heap_len] = slot;
+    tasks[slot].heap_pos = heap_len;
+    heap_up(heap_len++);
+}
+
+static void heap_remove(int pos)
+{
+    int slot = heap[pos];
+    heap_len--;
+    if (pos != heap_len) {
+        heap[pos] = heap[heap_len];
+        tasks[heap[pos]].heap_pos = pos;
+        heap_down(pos);
+        heap_up(pos);
+    }
+    tasks[slot].heap_pos = -1;
+}
+
+static uint64_t to_ticks(lua_Number sec)
+{
+    return sec > 0 ? (uint64_t)(sec * SCHED_NS_PER_SEC) : 0;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Lua API                                                           */
+/* ------------------------------------------------------------------ */
+
+/* sched.sleep(seconds) – yield the calling coroutine until it is due */
+static int sched_sleep(lua_State *L)
+{
+    lua_Number sec = luaL_checknumber(L, 1);
+    if (!lua_isyieldable(L)) {
+        return luaL_error(L, "sched.sleep must be called from a coroutine");
+    }
+    int slot = task_alloc();
+    if (slot < 0) return luaL_error(L, "sched: out of memory");
+
+    task_t *t = &tasks[slot];
+    t->wake = stm_now() + to_ticks(sec);
+    t->is_thread = true;
+    lua_pushthread(L);
+    t->ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    heap_push(slot);
+    return lua_yield(L, 0);     // resumed by sched_module_update()
+}
+
+static int add_timer(lua_State *L, lua_Number delay, lua_Number interval)
+{
+    luaL_checktype(L, 2, LUA_TFUNCTION);
+    int slot = task_alloc();
+    if (slot < 0) return luaL_error(L, "sched: out of memory");
+
+    task_t *t = &tasks[slot];
+    t->wake = stm_now() + to_ticks(delay);
+    t->interval = interval > 0 ? to_ticks(interval) : 0;
+    lua_pushvalue(L, 2);
+    t->ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    heap_push(slot);
+    lua_pushinteger(L, task_id(slot));
+    return 1;
+}
+
+/* sched.after(seconds, fn) → id   (fn runs once) */
+static int sched_after(lua_State *L)
+{
+    return add_timer(L, luaL_checknumber(L, 1), 0);
+}
+
+/* sched.every(seconds, fn) → id   (fn returning false stops it) */
+static int sched_every(lua_State *L)
+{
+    lua_Number interval = luaL_checknumber(L, 1);
+    luaL_argcheck(L, interval > 0, 1, "interval must be positive");
+    return add_timer(L, interval, interval);
+}
+
+/* sched.cancel(id) → true if the timer was still live */
+static int sched_cancel(lua_State *L)
+{
+    int slot = task_from_id(luaL_checkinteger(L, 1));
+    if (slot < 0 || tasks[slot].is_thread) {
+        lua_pushboolean(L, 0);
+        return 1;
+    }
+    if (tasks[slot].heap_pos >= 0) {
+        heap_remove(tasks[slot].heap_pos);
+        task_free(slot);
+    } else {
+        tasks[slot].cancelled = true;       // running right now
+    }
+    lua_pushboolean(L, 1);
+    return 1;
+}
+
+/* sched.pending() → queued sleeps + timers */
+static int sched_pending(lua_State *L)
+{
+    lua_pushinteger(L, heap_len);
+    return 1;
+}
+
+/* ------------------------------------------------------------------ */
+/*  Per-frame dispatch – cost is O(due · log n), idle tasks are free  */
+/* ------------------------------------------------------------------ */
+static void resume_task(int slot)
+{
+    lua_rawgeti(L_main, LUA_REGISTRYINDEX, tasks[slot].ref);
+    lua_State *co = lua_tothread(L_main, -1);
+    task_free(slot);            // the stack slot keeps co alive while it runs
+
+    int nres;
+    int status = lua_resume(co, L_main, 0, &nres);
+    if (status == LUA_OK || status == LUA_YIELD) {
+        lua_pop(co, nres);
+    } else {
+        luaL_traceback(L_main, co, lua_tostring(co, -1), 0);
+        LOG_ERROR("lua", "sched coroutine error: %s", lua_tostring(L_main, -1));
+        lua_pop(L_main, 1);
+    }
+    lua_pop(L_main, 1);
+}
+
+static void call_timer(int slot, uint64_t now)
+{
+    lua_rawgeti(L_main, LUA_REGISTRYINDEX, tasks[slot].ref);
+    bool keep = tasks[slot].interval > 0;
+    if (lua_pcall(L_main, 0, 1, 0) != LUA_OK) {
+        LOG_ERROR("lua", "sched timer error: %s", lua_tostring(L_main, -1));
+        keep = false;
+    } else if (lua_isboolean(L_main, -1) && !lua_toboolean(L_main, -1)) {
+        keep = false;
+    }
+    lua_pop(L_main, 1);
+
+    task_t *t = &tasks[slot];   // the callback may have grown the array
+    if (!keep || t->cancelled) {
+        task_free(slot);
+        return;
+    }
+    t->wake += t->interval;
+    if (t->wake <= now) t->wake = now + t->interval;   // fell behind: skip, don't burst
+    heap_push(slot);
+}
+
+void sched_module_update(void)
+{
+    if (!heap_len) return;
+    uint64_t now = stm_now();
+    uint32_t seq_end = next_seq;    // tasks queued from here on wait for next frame
+
+    while (heap_len) {
+        int slot = heap[0];
+        const task_t *t = &tasks[slot];
+        if (t->wake > now || (int32_t)(t->seq - seq_end) >= 0) break;
+        heap_remove(0);
+        if (t->is_thread) resume_task(slot);
+        else              call_timer(slot, now);
+    }
+}
+
+/* drops every queued sleep and timer – the coroutines and callbacks
+   of the previous run of a reloaded script are never resumed again */
+void sched_module_reset(void)
+{
+    while (heap_len) {
+        int slot = heap[heap_len - 1];
+        heap_len--;
+        task_free(slot);
+    }
+}
+
+/* ------------------------------------------------------------------ */
+/*  Initialise the bridge                                             */
+/* ------------------------------------------------------------------ */
+void sched_module_init(lua_State *L)
+{
+    L_main = L;
+
+    lua_newtable(L);
+    lua_pushcfunction(L, sched_sleep);   lua_setfield(L, -2, "sleep");
+    lua_pushcfunction(L, sched_after);   lua_setfield(L, -2, "after");
+    lua_pushcfunction(L, sched_every);   lua_setfield(L, -2, "every");
+    lua_pushcfunction(L, sched_cancel);  lua_setfield(L, -2, "cancel");
+    lua_pushcfunction(L, sched_pending); lua_setfield(L, -2, "pending");
+    lua_setglobal(L, "sched");
+}
+
+/* the Lua state owns the refs – just drop the arrays */
+void sched_module_shutdown(void)
+{
+    free(tasks);
+    free(heap);
+    tasks = NULL;
+    heap = NULL;
+    tasks_cap = heap_len = 0;
+    free_task = -1;
+}
@@ -0,0 +1,91 @@
+/*======================================================================
+  thread_util.c  –  Win32 / pthreads shim
+======================================================================*/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L     // nanosleep under -std=c11
+#endif
+#include "thread_util.h"
+#include <stdlib.h>
+#if !defined(_WIN32)
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/* the OS entry point signatures differ – trampoline through a heap pair */
+typedef struct thread_boot_t {
+    thread_fn fn;
+    void     *arg;
+} thread_boot_t;
+
+#if defined(_WIN32)
+static DWORD WINAPI thread_entry(LPVOID p)
+#else
+static void* thread_entry(void *p)
+#endif
+{
+    thread_boot_t boot = *(thread_boot_t*)p;
+    free(p);
+    boot.fn(boot.arg);
+    return 0;
+}
+
+bool thread_start(thread_t *t, thread_fn fn, void *arg)
+{
+    thread_boot_t *boot = (thread_boot_t*)malloc(sizeof(*boot));
+    if (!boot) return false;
+    boot->fn = fn;
+    boot->arg = arg;
+#if defined(_WIN32)
+    *t = CreateThread(NULL, 0, thread_entry, boot, 0, NULL);
+    if (*t) return true;
+#else
+    if (pthread_create(t, NULL, thread_entry, boot) == 0) return true;
+#endif
+    free(boot);
+    return false;
+}
+
+#if defined(_WIN32)
+void thread_join(thread_t t)           { WaitForSingleObject(t, INFINITE); CloseHandle(t); }
+void thread_yield(void)                { SwitchToThread(); }
+void thread_sleep_ms(int ms)           { Sleep((DWORD)ms); }
+int  thread_cpu_count(void)
+{
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (int)si.dwNumberOfProcessors;
+}
+
+void mutex_init(mutex_t *m)            { InitializeSRWLock(m); }
+void mutex_destroy(mutex_t *m)         { (void)m; }
+void mutex_lock(mutex_t *m)            { AcquireSRWLockExclusive(m); }
+void mutex_unlock(mutex_t *m)          { ReleaseSRWLockExclusive(m); }
+
+void cond_init(cond_t *c)              { InitializeConditionVariable(c); }
+void cond_destroy(cond_t *c)           { (void)c; }
+void cond_wait(cond_t *c, mutex_t *m)  { SleepConditionVariableSRW(c, m, INFINITE, 0); }
+void cond_signal(cond_t *c)            { WakeConditionVariable(c); }
+void cond_broadcast(cond_t *c)         { WakeAllConditionVariable(c); }
+#else
+void thread_join(thread_t t)           { pthread_join(t, NULL); }
+void thread_yield(void)                { sched_yield(); }
+void thread_sleep_ms(int ms)
+{
+    struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+int  thread_cpu_count(void)            { return (int)sysconf(_SC_NPROCESSORS_ONLN); }
+
+void mutex_init(mutex_t *m)            { pthread_mutex_init(m, NULL); }
+void mutex_destroy(mutex_t *m)         { pthread_mutex_destroy(m); }
+void mutex_lock(mutex_t *m)            { pthread_mutex_lock(m); }
+void mutex_unlock(mutex_t *m)          { pthread_mutex_unlock(m); }
+
+void cond_init(cond_t *c)              { pthread_cond_init(c, NULL); }
+void cond_destroy(cond_t *c)           { pthread_cond_destroy(c); }
+void cond_wait(cond_t *c, mutex_t *m)  { pthread_cond_wait(c, m); }
+void cond_signal(cond_t *c)            { pthread_cond_signal(c); }
+void cond_broadcast(cond_t *c)         { pthread_cond_broadcast(c); }
+#endif
@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+"""gen_imgui_lua.py - generate the Lua binding for the cimgui API
+
+Reads the dear_bindings header (libs/cimgui/cimgui.h) and writes
+include/cimgui_lua.gen.h, which module_cimgui.c includes. Every ig*
+function of the end-user API section whose argument and return types
+map onto plain Lua values gets a lua_CFunction; every ImGui enum value
+becomes an integer in the `imgui` table (ImGuiCond_Once -> imgui.Cond_Once).
+
+    python tools/gen_imgui_lua.py [cimgui.h] [output.h]
+    cmake --build build --target imgui_lua_bindings
+
+Argument mapping (Lua stack slot i = C argument i, left to right):
+    const char*              string (nil allowed when the C default is NULL)
+    const char* fmt, ...     string, printed with "%s"
+    bool / int / enums       boolean / integer
+    float / double           number
+    ImVec2 / ImVec4          vmath.vec2/vec4 or {x,y[,z,w]} / {1,2[,3,4]}
+    bool* int* float* ...    current value in, new value returned
+    float v[N] / int v[N]    table or vmath vector, updated in place
+    char* buf, size_t size   string in, edited string returned
+Functions with anything else (callbacks, void*, ImFont* ...) are skipped.
+"""
+import re
+import sys
+
+SECTION_BEGIN = "// [SECTION] Dear ImGui end-user API functions"
+SECTION_END = "// [SECTION] Flags & Enumerations"
+
+# frame control belongs to sokol_imgui, not to scripts
+SKIP = {"igNewFrame", "igEndFrame", "igRender"}
+
+INT_TYPES = {"int", "unsigned int", "size_t"}
+FLOAT_TYPES = {"float", "double"}
+
+
+def strip_line_comment(line):
+    out, i, in_str = [], 0, False
+    while i < len(line):
+        c = line[i]
+        if c == '"' and (i == 0 or line[i - 1] != "\\"):
+            in_str = not in_str
+        if not in_str and line.startswith("//", i):
+            break
+        out.append(c)
+        i += 1
+    return "".join(out)
+
+
+def split_args(s):
+    args, depth, cur = [], 0, ""
+    for c in s:
+        if c in "([":
+            depth += 1
+        elif c in ")]":
+            depth -= 1
+        if c == "," and depth == 0:
+            args.append(cur.strip())
+            cur = ""
+        else:
+            cur += c
+    if cur.strip():
+        args.append(cur.strip())
+    return args
+
+
+def c_default(expr):
+    """C++ default argument -> C expression"""
+    expr = expr.strip()
+    m = re.match(r"ImVec([24])\((.*)\)$", expr)
+    if m:
+        return "(ImVec%s){ %s }" % (m.group(1), m.group(2))
+    return expr
+
+
+class Arg:
+    def __init__(self, text):
+        m = re.search(r"/\*\s*=\s*(.*?)\s*\*/", text)
+        self.default = c_default(m.group(1)) if m else None
+        text = re.sub(r"/\*.*?\*/", "", text).strip()
+        self.text = text
+        m = re.match(r"(.*?)\s*\b(\w+)\s*(?:\[(\d+)\])?$", text)
+        if text == "...":
+            self.type, self.name, self.count = "...", "...", None
+        elif m:
+            self.type = re.sub(r"\s+", " ", m.group(1)).replace(" *", "*").strip()
+            self.name, self.count = m.group(2), int(m.group(3)) if m.group(3) else None
+        else:
+            self.type, self.name, self.count = text, "", None
+
+
+def parse_int_typedefs(src):
+    types = set(INT_TYPES)
+    for m in re.finditer(r"^typedef\s+(?:signed |unsigned )?(?:int|short|char)\s+(\w+);", src, re.M):
+        types.add(m.group(1))
+    return types
+
+
+def parse_functions(lines):
+    funcs, depth = [], 0
+    for line in lines:
+        if line.startswith("#if"):
+            depth += 1
+        elif line.startswith("#endif"):
+            depth -= 1
+        if depth or not line.startswith("CIMGUI_API"):
+            continue
+        line = strip_line_comment(line).strip()
+        m = re.match(r"CIMGUI_API\s+(.*?)\s*\b(ig\w+)\s*\((.*?)\)\s*(?:IM_FMT\w+\(\d+\))?\s*;$", line)
+        if not m:
+            continue
+        ret = re.sub(r"\s+", " ", m.group(1)).replace(" *", "*").strip()
+        args = [] if m.group(3).strip() == "void" else [Arg(a) for a in split_args(m.group(3))]
+        funcs.append((ret, m.group(2), args))
+    return funcs
+
+
+def parse_enums(src):
+    values, depth, in_enum = [], 0, False
+    for line in src.splitlines():
+        s = line.strip()
+        if s.startswith("#if"):
+            depth += 1
+        elif s.startswith("#endif"):
+            depth -= 1
+        if re.match(r"(typedef\s+)?enum\b", s):
+            in_enum = True
+            continue
+        if in_enum and s.startswith("}"):
+            in_enum = False
+            continue
+        if in_enum and not depth:
+            m = re.match(r"(ImGui\w+)\s*(=|,|$)", strip_line_comment(s).strip())
+            if m:
+                values.append(m.group(1))
+    return values
+
+
+class Gen:
+    def __init__(self, int_types):
+        self.int_types = int_types
+
+    def is_int(self, t):
+        return t in self.int_types
+
+    def emit(self, ret, name, args):
+        """C source for one binding, or None when a type is unsupported"""
+        body, call, outs, writes = [], [], [], []   # outs push a result, writes update in place
+        slot = 1
+        i = 0
+        while i < len(args):
+            a = args[i]
+            nxt = args[i + 1] if i + 1 < len(args) else None
+            t, n, d = a.type, a.name, a.default
+            if t == "const char*" and nxt is not None and nxt.type == "...":
+                body.append("    const char* %s = luaL_checkstring(L, %d);" % (n, slot))
+                call += ['"%s"', n]
+                slot += 1
+                i += 2
+                continue
+            if t == "char*" and nxt is not None and nxt.type == "size_t":
+                body.append("    size_t %s_len;" % n)
+                body.append("    const char* %s_in = luaL_checklstring(L, %d, &%s_len);" % (n, slot, n))
+                body.append("    char* %s = gen_text_buffer(%s_in, %s_len);" % (n, n, n))
+                call += [n, "CIMGUI_LUA_TEXT_CAPACITY"]
+                outs.append("    lua_pushstring(L, %s);" % n)
+                slot += 1
+                i += 2
+                continue
+            if t == "const char*" and n.endswith("_end"):
+                call.append("NULL")
+            elif t == "const char*":
+                fn = "lua_tostring(L, %d)" % slot if d == "NULL" else (
+                     "luaL_optstring(L, %d, %s)" % (slot, d) if d else "luaL_checkstring(L, %d)" % slot)
+                body.append("    const char* %s = %s;" % (n, fn))
+                call.append(n)
+                slot += 1
+            elif t == "bool" and a.count is None:
+                if d:
+                    body.append("    bool %s = lua_isnoneornil(L, %d) ? %s : lua_toboolean(L, %d);" % (n, slot, d, slot))
+                else:
+                    body.append("    bool %s = lua_toboolean(L, %d);" % (n, slot))
+                call.append(n)
+                slot += 1
+            elif self.is_int(t) and a.count is None:
+                fn = "luaL_optinteger(L, %d, %s)" % (slot, d) if d else "luaL_checkinteger(L, %d)" % slot
+                body.append("    %s %s = (%s)%s;" % (t, n, t, fn))
+                call.append(n)
+                slot += 1
+            elif t in FLOAT_TYPES and a.count is None:
+                fn = "luaL_optnumber(L, %d, %s)" % (slot, d) if d else "luaL_checknumber(L, %d)" % slot
+                body.append("    %s %s = (%s)%s;" % (t, n, t, fn))
+                call.append(n)
+                slot += 1
+            elif t in ("ImVec2", "ImVec4"):
+                fn = "check_im%s(L, %d)" % (t[2:].lower(), slot)
+                if d:
+                    fn = "lua_isnoneornil(L, %d) ? %s : %s" % (slot, d, fn)
+                body.append("    %s %s = %s;" % (t, n, fn))
+                call.append(n)
+                slot += 1
+            elif t.endswith("*") and (t[:-1] == "bool" or t[:-1] in FLOAT_TYPES or self.is_int(t[:-1])) \
+                    and not t.startswith("const") and a.count is None:
+                base = t[:-1]
+                if base == "bool":
+                    read, push = "lua_toboolean(L, %d)" % slot, "lua_pushboolean(L, %s_v)" % n
+                elif base in FLOAT_TYPES:
+                    read, push = "(%s)luaL_optnumber(L, %d, 0)" % (base, slot), "lua_pushnumber(L, %s_v)" % n
+                else:
+                    read, push = "(%s)luaL_optinteger(L, %d, 0)" % (base, slot), "lua_pushinteger(L, (lua_Integer)%s_v)" % n
+                body.append("    %s %s_v = %s;" % (base, n, read))
+                if d == "NULL":
+                    body.append("    bool %s_set = !lua_isnoneornil(L, %d);" % (n, slot))
+                    call.append("%s_set ? &%s_v : NULL" % (n, n))
+                    outs.append("    if (%s_set) %s; else lua_pushnil(L);" % (n, push))
+                else:
+                    call.append("&%s_v" % n)
+                    outs.append("    %s;" % push)
+                slot += 1
+            elif a.count and (t == "float" or t == "int"):
+                body.append("    %s %s[%d];" % (t, n, a.count))
+                body.append("    gen_read_%ss(L, %d, %s, %d);" % (t, slot, n, a.count))
+                call.append(n)
+                writes.append("    gen_write_%ss(L, %d, %s, %d);" % (t, slot, n, a.count))
+                slot += 1
+            else:
+                return None
+            i += 1
+
+        if ret == "void":
+            pre, push, nret = "", [], 0
+        elif ret == "bool":
+            pre, push, nret = "bool ret = ", ["    lua_pushboolean(L, ret);"], 1
+        elif self.is_int(ret):
+            pre, push, nret = "%s ret = " % ret, ["    lua_pushinteger(L, (lua_Integer)ret);"], 1
+        elif ret in FLOAT_TYPES:
+            pre, push, nret = "%s ret = " % ret, ["    lua_pushnumber(L, ret);"], 1
+        elif ret == "const char*":
+            pre, push, nret = "const char* ret = ", ["    lua_pushstring(L, ret);"], 1
+        elif ret == "ImVec2":
+            pre, push, nret = "ImVec2 ret = ", ["    lua_pushnumber(L, ret.x);", "    lua_pushnumber(L, ret.y);"], 2
+        elif ret == "ImVec4":
+            pre, push, nret = "ImVec4 ret = ", ["    lua_pushnumber(L, ret.x);", "    lua_pushnumber(L, ret.y);",
+                                                "    lua_pushnumber(L, ret.z);", "    lua_pushnumber(L, ret.w);"], 4
+        else:
+            return None
+
+        lua_name = name[2:]
+        out = ["static int cimgui_gen_%s(lua_State *L)" % lua_name, "{"]
+        if not body and nret == 0 and not outs and not writes:
+            out.append("    (void)L;")
+        out += body
+        out.append("    %s%s(%s);" % (pre, name, ", ".join(call)))
+        out += writes + push + outs
+        out.append("    return %d;" % (nret + len(outs)))
+        out.append("}")
+        return lua_name, "\n".join(out)
+
+
+def main():
+    src_path = sys.argv[1] if len(sys.argv) > 1 else "libs/cimgui/cimgui.h"
+    out_path = sys.argv[2] if len(sys.argv) > 2 else "include/cimgui_lua.gen.h"
+    src = open(src_path, encoding="utf-8").read()
+
+    begin = src.index(SECTION_BEGIN, src.index(SECTION_END) + 1)
+    end = src.index(SECTION_END, begin)
+    api = src[begin:end].splitlines()
+
+    gen = Gen(parse_int_typedefs(src))
+    bindings, skipped = [], []
+    for ret, name, args in parse_functions(api):
+        r = None if name in SKIP else gen.emit(ret, name, args)
+        (bindings if r else skipped).append(r or name)
+
+    enums = parse_enums(src[end:])
+
+    o = []
+    o.append("#pragma once")
+    o.append("/*")
+    o.append("    #version:1# (machine generated, don't edit!)")
+    o.append("")
+    o.append("    Generated by tools/gen_imgui_lua.py from %s" % src_path.replace("\\", "/"))
+    o.append("")
+    o.append("    %d functions bound, %d skipped (unsupported types), %d enum values." % (len(bindings), len(skipped), len(enums)))
+    o.append("    Include from module_cimgui.c only - expects check_imvec2(), check_imvec4(),")
+    o.append("    gen_read_floats()/ints(), gen_write_floats()/ints() and gen_text_buffer().")
+    o.append("*/")
+    o.append("")
+    for _, code in bindings:
+        o.append(code)
+        o.append("")
+    o.append("static const luaL_Reg cimgui_gen_funcs[] = {")
+    for lua_name, _ in bindings:
+        o.append('    { "%s", cimgui_gen_%s },' % (lua_name, lua_name))
+    o.append("    { NULL, NULL }")
+    o.append("};")
+    o.append("")
+    o.append("static const struct { const char *name; lua_Integer value; } cimgui_gen_enums[] = {")
+    for e in enums:
+        o.append('    { "%s", %s },' % (e[len("ImGui"):], e))
+    o.append("    { NULL, 0 }")
+    o.append("};")
+    o.append("")
+    o.append("/* fill the table on top of the stack */")
+    o.append("static void cimgui_gen_register(lua_State *L)")
+    o.append("{")
+    o.append("    luaL_setfuncs(L, cimgui_gen_funcs, 0);")
+    o.append("    for (int i = 0; cimgui_gen_enums[i].name; i++) {")
+    o.append("        lua_pushinteger(L, cimgui_gen_enums[i].value);")
+    o.append("        lua_setfield(L, -2, cimgui_gen_enums[i].name);")
+    o.append("    }")
+    o.append("}")
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(o) + "\n")
+    print("gen_imgui_lua: %d functions, %d skipped, %d enums -> %s" % (len(bindings), len(skipped), len(enums), out_path))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,235 @@
+/*======================================================================
+  log_decode.c  –  binary custom_log files → text
+
+      log_decode demo.clog.2 demo.clog.1 demo.clog > demo.log
+      cmake --build build --target log_decode
+
+  Records of all files are merged and ordered by timestamp (threads
+  drain in batches, so file order is only per-thread order). Lines
+  look like the text mode of custom_log, plus the producer thread.
+======================================================================*/
+
+#include "custom_log_format.h"
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct site_t {
+    uint32_t level, line;
+    char    *tag, *file, *fmt;
+} site_t;
+
+typedef struct line_t {
+    uint64_t time;
+    size_t   order;             // file order, keeps the sort stable
+    char    *text;
+} line_t;
+
+static line_t *lines;
+static size_t  num_lines, cap_lines;
+
+/* ------------------------------------------------------------------ */
+/*  Reading                                                           */
+/* ------------------------------------------------------------------ */
+typedef struct reader_t {
+    const uint8_t *p, *end;
+    int ok;
+} reader_t;
+
+static void rd(reader_t *r, void *dst, size_t n)
+{
+    if (!r->ok || (size_t)(r->end - r->p) < n) {
+        r->ok = 0;
+        memset(dst, 0, n);
+        return;
+    }
+    memcpy(dst, r->p, n);
+    r->p += n;
+}
+
+static uint32_t rd_u32(reader_t *r) { uint32_t v; rd(r, &v, 4); return v; }
+static uint64_t rd_u64(reader_t *r) { uint64_t v; rd(r, &v, 8); return v; }
+
+/* malloc'd copy, NULL for CLOG_STR_NULL */
+static char* rd_str(reader_t *r)
+{
+    uint16_t len;
+    rd(r, &len, 2);
+    if (!r->ok || len == CLOG_STR_NULL) return NULL;
+    char *s = (char*)malloc((size_t)len + 1);
+    if (!s) { r->ok = 0; return NULL; }
+    rd(r, s, len);
+    s[len] = 0;
+    return s;
+}
+
+static const char* level_name(uint32_t level)
+{
+    switch (level) {
+        case 0:  return "panic";
+        case 1:  return "error";
+        case 2:  return "warn";
+        case 3:  return "info";
+        default: return "debug";
+    }
+}
+
+static const char* base_name(const char *path)
+{
+    const char *name = path ? path : "";
+    for (const char *p = name; *p; p++) {
+        if (*p == '/' || *p == '\\') name = p + 1;
+    }
+    return name;
+}
+
+static void add_line(uint64_t time, const char *fmt, ...)
+{
+    char buf[4096];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    size_t len = n < 0 ? 0 : (size_t)n < sizeof(buf) ? (size_t)n : sizeof(buf) - 1;
+
+    if (num_lines == cap_lines) {
+        cap_lines = cap_lines ? cap_lines * 2 : 1024;
+        lines = (line_t*)realloc(lines, cap_lines * sizeof(line_t));
+        if (!lines) { fprintf(stderr, "log_decode: out of memory\n"); exit(1); }
+    }
+    char *text = (char*)malloc(len + 1);
+    if (!text) { fprintf(stderr, "log_decode: out of memory\n"); exit(1); }
+    memcpy(text, buf, len);
+    text[len] = 0;
+    lines[num_lines] = (line_t){ time, num_lines, text };
+    num_lines++;
+}
+
+/* ------------------------------------------------------------------ */
+/*  One file                                                          */
+/* ------------------------------------------------------------------ */
+static int decode_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "log_decode: cannot open %s\n", path);
+        return 0;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = (uint8_t*)malloc(size > 0 ? (size_t)size : 1);
+    if (!data || fread(data, 1, (size_t)size, f) != (size_t)size) {
+        fprintf(stderr, "log_decode: cannot read %s\n", path);
+        fclose(f);
+        free(data);
+        return 0;
+    }
+    fclose(f);
+
+    if (size < CLOG_MAGIC_LEN || memcmp(data, CLOG_MAGIC, CLOG_MAGIC_LEN) != 0) {
+        fprintf(stderr, "log_decode: %s is not a binary custom_log file\n", path);
+        free(data);
+        return 0;
+    }
+
+    site_t *sites = NULL;
+    uint32_t num_sites = 0;
+    reader_t r = { data + CLOG_MAGIC_LEN, data + size, 1 };
+
+    while (r.ok && r.p < r.end) {
+        uint8_t type = *r.p++;
+        switch (type) {
+        case CLOG_REC_SITE: {
+            uint32_t id = rd_u32(&r);
+            if (id >= num_sites) {
+                uint32_t n = id + 64;
+                sites = (site_t*)realloc(sites, n * sizeof(site_t));
+                if (!sites) { fprintf(stderr, "log_decode: out of memory\n"); exit(1); }
+                memset(sites + num_sites, 0, (n - num_sites) * sizeof(site_t));
+                num_sites = n;
+            }
+            site_t *s = &sites[id];
+            s->level = rd_u32(&r);
+            s->line = rd_u32(&r);
+            s->tag = rd_str(&r);
+            s->file = rd_str(&r);
+            s->fmt = rd_str(&r);
+        } break;
+        case CLOG_REC_EVENT: {
+            uint32_t id = rd_u32(&r);
+            uint32_t thread = rd_u32(&r);
+            uint64_t time = rd_u64(&r);
+            uint32_t payload = rd_u32(&r);
+            if (!r.ok || (size_t)(r.end - r.p) < payload || id >= num_sites) {
+                r.ok = 0;
+                break;
+            }
+            const site_t *s = &sites[id];
+            char msg[2048];
+            clog_format(s->fmt, r.p, payload, msg, sizeof(msg));
+            r.p += payload;
+            add_line(time, "[%10.3f][%-5s][%s][t%u] %s  (%s:%u)", time * 1e-9,
+                     level_name(s->level), s->tag ? s->tag : "", thread, msg, base_name(s->file), s->line);
+        } break;
+        case CLOG_REC_TEXT: {
+            uint32_t level = rd_u32(&r);
+            uint32_t line = rd_u32(&r);
+            uint64_t time = rd_u64(&r);
+            char *tag = rd_str(&r), *file = rd_str(&r), *msg = rd_str(&r);
+            if (r.ok) {
+                add_line(time, "[%10.3f][%-5s][%s] %s  (%s:%u)", time * 1e-9, level_name(level),
+                         tag ? tag : "", msg ? msg : "", base_name(file), line);
+            }
+            free(tag); free(file); free(msg);
+        } break;
+        case CLOG_REC_DROPPED: {
+            uint64_t time = rd_u64(&r);
+            uint64_t count = rd_u64(&r);
+            add_line(time, "[%10.3f][warn ][log] ring full, %llu message(s) dropped",
+                     time * 1e-9, (unsigned long long)count);
+        } break;
+        default:
+            r.ok = 0;
+            break;
+        }
+    }
+    if (!r.ok) {
+        fprintf(stderr, "log_decode: %s: damaged or truncated at offset %ld\n",
+                path, (long)(r.p - data));
+    }
+
+    for (uint32_t i = 0; i < num_sites; i++) {
+        free(sites[i].tag); free(sites[i].file); free(sites[i].fmt);
+    }
+    free(sites);
+    free(data);
+    return 1;
+}
+
+static int by_time(const void *a, const void *b)
+{
+    const line_t *x = (const line_t*)a, *y = (const line_t*)b;
+    if (x->time != y->time) return x->time < y->time ? -1 : 1;
+    return x->order < y->order ? -1 : (x->order > y->order);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: log_decode <file.clog> [more files, oldest first]\n");
+        return 1;
+    }
+    int ok = 1;
+    for (int i = 1; i < argc; i++) ok &= decode_file(argv[i]);
+
+    qsort(lines, num_lines, sizeof(line_t), by_time);
+    for (size_t i = 0; i < num_lines; i++) {
+        puts(lines[i].text);
+        free(lines[i].text);
+    }
+    free(lines);
+    return ok ? 0 : 1;
+}
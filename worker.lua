@@ -0,0 +1,20 @@
+-- runs in every jobs worker thread (own lua_State: base libs + vmath only)
+-- jobs.start("worker.lua"); local id = jobs.post("sum_range", 1, 1e7)
+-- then each frame: local id, ok, result = jobs.poll()
+
+function sum_range(first, last)
+    local s = 0
+    for i = first, last do s = s + i end
+    return s
+end
+
+-- n vmath.floats of y = sin(x * freq), sent back as one message
+function sine_table(n, freq)
+    local f = vmath.floats(n)
+    for i = 1, n do f[i] = math.sin((i - 1) * freq) end
+    return f
+end
+
+function whoami()
+    return WORKER_ID
+end